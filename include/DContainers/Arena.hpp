@@ -0,0 +1,200 @@
+/*
+ *   Copyright 2022 Alberto Guarnieri
+ *
+ *   Licensed under the Apache License, Version 2.0 (the "License");
+ *   you may not use this file except in compliance with the License.
+ *   You may obtain a copy of the License at
+ *
+ *       http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *   Unless required by applicable law or agreed to in writing, software
+ *   distributed under the License is distributed on an "AS IS" BASIS,
+ *   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *   See the License for the specific language governing permissions and
+ *   limitations under the License.
+ */
+
+#ifndef DCONTAINERS_ARENA_HPP
+#define DCONTAINERS_ARENA_HPP
+
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <memory>
+#include <memory_resource>
+#include <vector>
+
+
+namespace mdc::pmr {
+
+/***
+ * @brief Memory resource for the many small buffers of nested DVectors, such as mdc::pmr::DVector.
+ *        Memory is carved from large chunks obtained from an upstream resource, by bumping a pointer.
+ *        Blocks up to maxPooledSize bytes are rounded to a power of two and, once deallocated (e.g. when a row
+ *        grows and moves to a larger buffer), kept in a free list for their size, ready for the next row.
+ *        Larger blocks are only reclaimed by reset().
+ *        Calling reset() makes all chunks available again without returning them upstream, hence building
+ *        and dropping a DVector of the same shape repeatedly performs no upstream allocation after the first time.
+ * @code
+ * mdc::pmr::Arena arena;
+ * for (const auto &request: requests) {
+ *     mdc::pmr::DVector<3, float> scratch(std::allocator_arg, &arena, 16, 16, 16);
+ *     // ...
+ *     arena.reset(); // after scratch is destroyed
+ * }
+ * @endcode
+ * @warning Arena is not thread-safe, and every container using it must be destroyed before reset() or release()
+ */
+    class Arena : public std::pmr::memory_resource {
+    public:
+        // Size of the first chunk allocated by default, following chunks are twice as large as the previous one
+        static constexpr std::size_t defaultChunkSize = 64 * 1024;
+        // Largest block kept in a free list once deallocated
+        static constexpr std::size_t maxPooledSize = 4096;
+
+    private:
+        static constexpr std::size_t blockAlignment = alignof(std::max_align_t);
+        static constexpr std::size_t pooledClasses = std::bit_width(maxPooledSize / blockAlignment);
+
+        struct Chunk {
+            std::byte *data;
+            std::size_t size;
+        };
+
+        struct FreeBlock {
+            FreeBlock *next;
+        };
+
+        std::pmr::memory_resource *_upstream;
+        std::size_t _chunkSize;
+        std::size_t _nextChunkSize;
+        std::vector<Chunk> _chunks;
+        std::size_t _current = 0;
+        std::size_t _offset = 0;
+        std::array<FreeBlock *, pooledClasses> _free{};
+
+        static constexpr bool pooled(std::size_t bytes, std::size_t alignment) noexcept {
+            return bytes <= maxPooledSize && alignment <= blockAlignment;
+        }
+
+        // Index of the smallest power of two, multiple of blockAlignment, holding bytes
+        static constexpr std::size_t sizeClass(std::size_t bytes) noexcept {
+            return bytes <= blockAlignment ? 0 : std::bit_width((bytes - 1) / blockAlignment);
+        }
+
+        void *bump(std::size_t bytes, std::size_t alignment) {
+            while (true) {
+                if (_current < _chunks.size()) {
+                    const auto &chunk = _chunks[_current];
+                    void *top = chunk.data + _offset;
+                    std::size_t space = chunk.size - _offset;
+                    if (std::align(alignment, bytes, top, space)) {
+                        _offset = chunk.size - space + bytes;
+                        return top;
+                    }
+                    // chunks kept by reset() are skipped if too small, until the next reset()
+                    if (++_current < _chunks.size()) {
+                        _offset = 0;
+                        continue;
+                    }
+                }
+                std::size_t size = std::max(_nextChunkSize, bytes + alignment);
+                _chunks.push_back({static_cast<std::byte *>(_upstream->allocate(size, blockAlignment)), size});
+                _nextChunkSize *= 2;
+                _current = _chunks.size() - 1;
+                _offset = 0;
+            }
+        }
+
+    protected:
+        void *do_allocate(std::size_t bytes, std::size_t alignment) override {
+            if (!pooled(bytes, alignment))
+                return bump(bytes, alignment);
+            auto index = sizeClass(bytes);
+            if (FreeBlock *block = _free[index]) {
+                _free[index] = block->next;
+                return block;
+            }
+            return bump(blockAlignment << index, blockAlignment);
+        }
+
+        void do_deallocate(void *pointer, std::size_t bytes, std::size_t alignment) override {
+            if (!pooled(bytes, alignment))
+                return;
+            auto index = sizeClass(bytes);
+            _free[index] = ::new(pointer) FreeBlock{_free[index]};
+        }
+
+        bool do_is_equal(const std::pmr::memory_resource &other) const noexcept override {
+            return this == &other;
+        }
+
+    public:
+        /***
+         * @param chunkSize Size in bytes of the first chunk requested to upstream
+         * @param upstream Resource providing the chunks
+         */
+        explicit Arena(std::size_t chunkSize = defaultChunkSize,
+                       std::pmr::memory_resource *upstream = std::pmr::get_default_resource())
+                : _upstream(upstream), _chunkSize(std::max<std::size_t>(chunkSize, blockAlignment)),
+                  _nextChunkSize(_chunkSize) {}
+
+        Arena(const Arena &) = delete;
+
+        Arena &operator=(const Arena &) = delete;
+
+        ~Arena() override {
+            release();
+        }
+
+        /***
+         * @brief Make all memory available again, keeping every chunk for the following allocations
+         */
+        void reset() noexcept {
+            _current = 0;
+            _offset = 0;
+            _free.fill(nullptr);
+        }
+
+        /***
+         * @brief Return all chunks to the upstream resource
+         */
+        void release() noexcept {
+            for (const auto &chunk: _chunks)
+                _upstream->deallocate(chunk.data, chunk.size, blockAlignment);
+            _chunks.clear();
+            _nextChunkSize = _chunkSize;
+            reset();
+        }
+
+        /***
+         * @return Number of bytes held in chunks obtained from the upstream resource
+         */
+        std::size_t capacity() const noexcept {
+            std::size_t bytes = 0;
+            for (const auto &chunk: _chunks)
+                bytes += chunk.size;
+            return bytes;
+        }
+
+        /***
+         * @return Number of chunks obtained from the upstream resource
+         */
+        std::size_t chunks() const noexcept {
+            return _chunks.size();
+        }
+
+        /***
+         * @return Resource providing the chunks
+         */
+        std::pmr::memory_resource *upstream_resource() const noexcept {
+            return _upstream;
+        }
+    };
+
+}
+
+
+#endif //DCONTAINERS_ARENA_HPP
@@ -0,0 +1,67 @@
+/*
+ *   Copyright 2022 Alberto Guarnieri
+ *
+ *   Licensed under the Apache License, Version 2.0 (the "License");
+ *   you may not use this file except in compliance with the License.
+ *   You may obtain a copy of the License at
+ *
+ *       http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *   Unless required by applicable law or agreed to in writing, software
+ *   distributed under the License is distributed on an "AS IS" BASIS,
+ *   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *   See the License for the specific language governing permissions and
+ *   limitations under the License.
+ */
+
+#ifndef DCONTAINERS_BOUNDSCHECK_HPP
+#define DCONTAINERS_BOUNDSCHECK_HPP
+
+#include <cstddef>
+#include <cstdio>
+#include <cstdlib>
+
+
+namespace mdc {
+
+    /***
+     * @brief Policies describing how indices are validated by the unchecked access operator(),
+     *        as opposed to at() which always throws std::out_of_range.
+     *        The policy used by every container is BoundsCheck::Default, which asserts in debug builds
+     *        and performs no check when NDEBUG is defined. The choice can be forced by defining
+     *        DCONTAINERS_BOUNDS_CHECK (always assert) or DCONTAINERS_NO_BOUNDS_CHECK (never check).
+     */
+    struct BoundsCheck {
+        /***
+         * @brief No validation at all, an index out of range is undefined behaviour
+         */
+        struct None {
+            static constexpr bool enabled = false;
+
+            static constexpr void check(std::size_t, std::size_t) noexcept {}
+        };
+
+        /***
+         * @brief Abort the program, reporting the index out of range, independently of NDEBUG
+         */
+        struct Assert {
+            static constexpr bool enabled = true;
+
+            static constexpr void check(std::size_t index, std::size_t extent) noexcept {
+                if (index >= extent) [[unlikely]] {
+                    std::fprintf(stderr, "DContainers: index %zu is out of range (extent=%zu)\n", index, extent);
+                    std::abort();
+                }
+            }
+        };
+
+#if defined(DCONTAINERS_BOUNDS_CHECK) || (!defined(NDEBUG) && !defined(DCONTAINERS_NO_BOUNDS_CHECK))
+        using Default = Assert;
+#else
+        using Default = None;
+#endif
+    };
+
+}
+
+#endif //DCONTAINERS_BOUNDSCHECK_HPP
@@ -18,14 +18,45 @@
 #define DCONTAINERS_DARRAY_HPP
 
 
+#include <algorithm>
 #include <array>
+#include <concepts>
+#include <functional>
 #include <iostream>
+#include <span>
+#include "DContainers/BoundsCheck.hpp"
 #include "DContainers/Span/DSpanning.hpp"
+#include "DContainers/DView.hpp"
+#include "DContainers/Expression.hpp"
+#include "DContainers/Format.hpp"
 
 namespace mdc {
 
+    namespace detail {
+
+        /***
+         * @brief Assign to each element of a DArray of D dimensions the value computed from its indices
+         */
+        template<std::size_t D, typename A, typename Fn, typename... I>
+        constexpr void generateInto(A &array, Fn &generator, I... indices) {
+            for (std::size_t i = 0; i < array.size(); ++i) {
+                if constexpr (D == 1)
+                    array[i] = generator(indices..., i);
+                else
+                    generateInto<D - 1>(array[i], generator, indices..., i);
+            }
+        }
+
+    }
+
 /***
- * @brief Represent an array with a fixed size for each dimension
+ * @brief Represent an array with a fixed size for each dimension.
+ *        Every operation but flat access and views can be used in constant expressions,
+ *        hence lookup tables can be built at compile time:
+ * @code
+ * constexpr mdc::DArray<int, 3, 3> identity([](std::size_t i, std::size_t j) { return i == j ? 1 : 0; });
+ * static_assert(identity.at(1, 1) == 1);
+ * @endcode
  * @tparam T Type of the elements stored
  * @tparam N Size of the outer-most dimension
  * @tparam O Parameter pack of the following sizes
@@ -34,7 +65,7 @@ namespace mdc {
     class DArray : public std::array<DArray<T, O...>, N> {
     private:
         template<typename U, std::size_t ...I>
-        constexpr std::array<U, N> array_initializer_extractor(const U *const data, std::index_sequence<I...>) {
+        static constexpr std::array<U, N> array_initializer_extractor(const U *const data, std::index_sequence<I...>) {
             return {data[I]...};
         }
 
@@ -54,7 +85,7 @@ namespace mdc {
          * @return Array containing all elements of list
          */
         template<typename U>
-        constexpr std::array<U, N> array_initializer(std::initializer_list<U> list) {
+        static constexpr std::array<U, N> array_initializer(std::initializer_list<U> list) {
             return array_initializer_extractor(std::data(list), std::make_index_sequence<N>());
         }
 
@@ -68,7 +99,7 @@ namespace mdc {
          * @brief Constructor of DArray with a nested initializer_list of DArrays of lower dimensions
          * @param values initializer_list of sub-arrays
          */
-        DArray(std::initializer_list<DArray<T, O...>> values) : std::array<DArray<T, O...>, N>(
+        constexpr DArray(std::initializer_list<DArray<T, O...>> values) : std::array<DArray<T, O...>, N>(
                 array_initializer(values)) {}
 
 
@@ -76,13 +107,45 @@ namespace mdc {
          * @brief Construct DArray as copy of a std::array
          * @param array Array to be copied
          */
-        DArray(const std::array<DArray<T, O...>, N> &array) : std::array<DArray<T, O...>, N>(array) {}
+        constexpr DArray(const std::array<DArray<T, O...>, N> &array) : std::array<DArray<T, O...>, N>(array) {}
 
         /***
          * @brief Construct DArray moving r-value std::array
          * @param array Array to be moved
          */
-        DArray(std::array<DArray<T, O...>, N> &&array) : std::array<DArray<T, O...>, N>(std::move(array)) {}
+        constexpr DArray(std::array<DArray<T, O...>, N> &&array) : std::array<DArray<T, O...>, N>(std::move(array)) {}
+
+        /***
+         * @brief Construct DArray evaluating an element-wise expression, in a single pass over all elements
+         * @param expression Expression with the same shape of DArray
+         * @see ArrayExpression
+         */
+        template<typename Op, typename... E>
+        constexpr DArray(const ArrayExpression<Op, E...> &expression) {
+            detail::evaluate(expression, *this);
+        }
+
+        /***
+         * @brief Constructor of elements computed from their indices, usable in constant expressions
+         * @param generator Function called with the D indices of each element, in row-major order,
+         *                  returning its value
+         */
+        template<typename Fn>
+        constexpr explicit DArray(Fn generator) requires detail::Generator<Fn, T, D> {
+            detail::generateInto<D>(*this, generator);
+        }
+
+        /***
+         * @brief Assign the value of an element-wise expression to each element, in a single pass
+         * @param expression Expression with the same shape of DArray
+         * @return Reference to this DArray
+         * @see ArrayExpression
+         */
+        template<typename Op, typename... E>
+        constexpr DArray &operator=(const ArrayExpression<Op, E...> &expression) {
+            detail::evaluate(expression, *this);
+            return *this;
+        }
 
         /***
          * @brief Get a reference to a specific element held by DArray, specifying its position.
@@ -119,6 +182,39 @@ namespace mdc {
             return this->at(index).at(indices...);
         }
 
+        /***
+         * @brief Get a reference to a specific element (or sub-array) held by DArray,
+         *        without throwing on invalid indices.
+         *        Indices are validated according to BoundsCheck::Default, i.e. only in debug builds by default.
+         * @param index Index of the higher (i.e. left-most) dimension
+         * @param indices Parameter pack of the indices for the lower dimensions
+         * @return Reference to the requested element, or sub-array if fewer indices than dimensions are given
+         * @see BoundsCheck
+         */
+        template<std::integral Idx, std::integral... Indices>
+        constexpr decltype(auto)
+        operator()(Idx index, Indices... indices) noexcept requires (sizeof...(Indices) < D) {
+            mdc::BoundsCheck::Default::check(static_cast<std::size_t>(index), N);
+            if constexpr (sizeof...(Indices) == 0)
+                return (*this)[index];
+            else
+                return (*this)[index](indices...);
+        }
+
+        /***
+         * @see DArray<T,N,O...>::operator()(Idx index, Indices... indices)
+         * @return Constant reference to the requested element, or sub-array
+         */
+        template<std::integral Idx, std::integral... Indices>
+        constexpr decltype(auto)
+        operator()(Idx index, Indices... indices) const noexcept requires (sizeof...(Indices) < D) {
+            mdc::BoundsCheck::Default::check(static_cast<std::size_t>(index), N);
+            if constexpr (sizeof...(Indices) == 0)
+                return (*this)[index];
+            else
+                return (*this)[index](indices...);
+        }
+
         /***
          * @brief View sub-array corresponding to intervals given by DSpan objects,
          *        specialization with the first span being a full span (i.e. DSpan<SpanSize::All>)
@@ -128,8 +224,9 @@ namespace mdc {
          *         dimension of the DArray returned corresponds to the size (i.e. length) of each DSpan
          */
         template<typename... U>
-        decltype(auto)
-        at(mdc::DSpanning<mdc::SpanSize::All> span, U... spans) const requires (sizeof...(U) == sizeof...(O)) {
+        constexpr decltype(auto)
+        at(mdc::DSpanning<mdc::SpanSize::All> span, U... spans) const
+        requires (sizeof...(U) == sizeof...(O)) && (detail::StaticSpanning<U> && ...) {
             return at(mdc::DSpanning<mdc::SpanSize::Interval<0, N - 1>>(), spans...);
         }
 
@@ -143,8 +240,8 @@ namespace mdc {
          *         dimension of the DArray returned corresponds to the size (i.e. length) of each DSpan
          */
         template<std::size_t Value, typename... U>
-        decltype(auto) at(mdc::DSpanning<mdc::SpanSize::Index<Value>> span, U... spans) const requires (
-                sizeof...(U) == sizeof...(O) && Value < N) {
+        constexpr decltype(auto) at(mdc::DSpanning<mdc::SpanSize::Index<Value>> span, U... spans) const requires (
+                sizeof...(U) == sizeof...(O) && Value < N) && (detail::StaticSpanning<U> && ...) {
             std::array<decltype(this->at(Value).at(spans...)), 1> data = {this->at(Value).at(spans...)};
             return fromArray(std::move(data));
         }
@@ -161,8 +258,8 @@ namespace mdc {
          *         dimension of the DArray returned corresponds to the size (i.e. length) of each DSpan
          */
         template<std::size_t From, std::size_t To, typename... U>
-        decltype(auto) at(mdc::DSpanning<mdc::SpanSize::Interval<From, To>> span, U... spans) const requires (
-                sizeof...(U) == sizeof...(O) && From < N && To < N) {
+        constexpr decltype(auto) at(mdc::DSpanning<mdc::SpanSize::Interval<From, To>> span, U... spans) const requires (
+                sizeof...(U) == sizeof...(O) && From < N && To < N) && (detail::StaticSpanning<U> && ...) {
             std::array<decltype(this->at(0).at(spans...)), To - From + 1> data;
             auto j = 0;
             for (auto i = From; i <= To; ++i)
@@ -170,6 +267,28 @@ namespace mdc {
             return fromArray(std::move(data));
         }
 
+        /***
+         * @brief View sub-array corresponding to intervals given by DSpan objects,
+         *        specialization with the first span being a strided interval between two indices
+         *        (i.e. DSpan<SpanSize::Interval<From, To, Step>>)
+         * @tparam From Index of the first element spanned
+         * @tparam To Index of the last element spanned (included only if reached by a multiple of Step)
+         * @tparam Step Distance between two consecutive elements spanned
+         * @param span First DSpan object which represents an interval for the higher (i.e. left-most) dimension
+         * @param spans Parameter pack of subsequent DSpan objects for lower dimensions
+         * @return DArray containing copies of the elements spanned,
+         *         dimension of the DArray returned corresponds to the size (i.e. length) of each DSpan
+         */
+        template<std::size_t From, std::size_t To, std::size_t Step, typename... U>
+        constexpr decltype(auto) at(mdc::DSpanning<mdc::SpanSize::Interval<From, To, Step>> span, U... spans) const requires (
+                sizeof...(U) == sizeof...(O) && From < N && To < N) && (detail::StaticSpanning<U> && ...) {
+            std::array<decltype(this->at(0).at(spans...)), decltype(span)::Size> data;
+            auto i = From;
+            for (std::size_t j = 0; j < decltype(span)::Size; ++j, i += Step)
+                data.at(j) = this->at(i).at(spans...);
+            return fromArray(std::move(data));
+        }
+
         /***
          * @brief View sub-array corresponding to intervals given by DSpan objects,
          *        specialization with the first span being an interval of fixed size (i.e. DSpan<SpanSize::Interval<Size>>)
@@ -180,15 +299,189 @@ namespace mdc {
          *         dimension of the DArray returned corresponds to the size (i.e. length) of each DSpan
          */
         template<std::size_t Size, typename... U>
-        decltype(auto) at(mdc::DSpanning<mdc::SpanSize::Interval<Size>> span, U... spans) const requires (
-                sizeof...(U) == sizeof...(O) && Size <= N) {
+        constexpr decltype(auto) at(mdc::DSpanning<mdc::SpanSize::Interval<Size>> span, U... spans) const requires (
+                sizeof...(U) == sizeof...(O) && Size <= N) && (detail::StaticSpanning<U> && ...) {
             std::array<decltype(this->at(0).at(spans...)), Size> data;
-            auto j = 0;
-            for (auto i = span.from; i <= span.to; ++i)
-                data.at(j++) = this->at(i).at(spans...);
+            auto i = span.from;
+            for (std::size_t j = 0; j < Size; ++j, i += span.step)
+                data.at(j) = this->at(i).at(spans...);
             return fromArray(std::move(data));
         }
 
+        /***
+         * @brief Slice the array with Span objects known only at runtime (e.g. Span::of(from, to)), mixed with
+         *        any DSpan object, without copying any element.
+         *        Intervals exceeding the extent of a dimension are truncated, as in DView<D,T>::at(J span, K... spans)
+         * @param span Span object for the higher dimension, followed by a Span object for each lower dimension
+         * @return View over the elements represented by the given Span objects, whose extents are set at runtime
+         * @see DArray<T,N,O...>::view(J span, K... spans)
+         */
+        template<typename J, typename... K>
+        DView<D, T> at(J span, K... spans)
+        requires (sizeof...(K) == D - 1) && detail::RuntimeSpannings<J, K...> {
+            return view().at(span, spans...);
+        }
+
+        /***
+         * @see DArray<T,N,O...>::at(J span, K... spans)
+         * @return Read-only view over the elements represented by the given Span objects
+         */
+        template<typename J, typename... K>
+        DView<D, const T> at(J span, K... spans) const
+        requires (sizeof...(K) == D - 1) && detail::RuntimeSpannings<J, K...> {
+            return view().at(span, spans...);
+        }
+
+        /***
+         * @brief View the whole DArray without copying its elements
+         * @return View over all elements of DArray
+         */
+        DView<D, T> view() noexcept {
+            static_assert(sizeof(DArray) == sizeof(T) * N * (O * ...), "DArray elements must be contiguous");
+            return {reinterpret_cast<T *>(this->data()), {N, O...}};
+        }
+
+        /***
+         * @see DArray<T,N,O...>::view()
+         * @return Read-only view over all elements of DArray
+         */
+        DView<D, const T> view() const noexcept {
+            static_assert(sizeof(DArray) == sizeof(T) * N * (O * ...), "DArray elements must be contiguous");
+            return {reinterpret_cast<const T *>(this->data()), {N, O...}};
+        }
+
+        /***
+         * @brief View specific intervals of the array using Span objects for each dimension,
+         *        without copying any element
+         * @param span Span object for the higher dimension, followed by a Span object for each lower dimension
+         * @return View over the elements represented by the given Span objects
+         * @see DView<D,T>::at(J span, K... spans)
+         */
+        template<typename J, typename... K>
+        DView<D, T> view(J span, K... spans)
+        requires (sizeof...(K) == D - 1)
+                 && std::is_convertible_v<J, mdc::Spanning> && (std::is_convertible_v<K, mdc::Spanning> && ...) {
+            return view().at(span, spans...);
+        }
+
+        /***
+         * @see DArray<T,N,O...>::view(J span, K... spans)
+         * @return Read-only view over the elements represented by the given Span objects
+         */
+        template<typename J, typename... K>
+        DView<D, const T> view(J span, K... spans) const
+        requires (sizeof...(K) == D - 1)
+                 && std::is_convertible_v<J, mdc::Spanning> && (std::is_convertible_v<K, mdc::Spanning> && ...) {
+            return view().at(span, spans...);
+        }
+
+        /***
+         * @brief View the array with the order of its dimensions reversed, without copying any element
+         * @return View where the element at (i_0, ..., i_D-1) is the one of DArray at (i_D-1, ..., i_0)
+         * @see DView<D,T>::transpose()
+         */
+        DView<D, T> transpose() noexcept {
+            return view().transpose();
+        }
+
+        /***
+         * @see DArray<T,N,O...>::transpose()
+         * @return Read-only view with the order of dimensions reversed
+         */
+        DView<D, const T> transpose() const noexcept {
+            return view().transpose();
+        }
+
+        /***
+         * @brief View the array with its dimensions reordered, without copying any element
+         * @tparam P Dimension of DArray placed at each position, e.g. <2, 0, 1> moves the last dimension first
+         * @return View where the element at (i_0, ..., i_D-1) is the one of DArray with index i_d for dimension P_d
+         * @see DView<D,T>::permute()
+         */
+        template<std::size_t... P>
+        DView<D, T> permute() noexcept requires (sizeof...(P) == D) && (detail::isPermutation<D>({P...})) {
+            return view().template permute<P...>();
+        }
+
+        /***
+         * @see DArray<T,N,O...>::permute()
+         * @return Read-only view with the dimensions reordered
+         */
+        template<std::size_t... P>
+        DView<D, const T> permute() const noexcept requires (sizeof...(P) == D) && (detail::isPermutation<D>({P...})) {
+            return view().template permute<P...>();
+        }
+
+        /***
+         * @brief Copy the array with its dimensions reordered, in cache-sized blocks
+         * @tparam P Dimension of DArray placed at each position
+         * @return DArray whose shape, deduced at compile time, holds the extent of dimension P_d at position d
+         * @see DArray<T,N,O...>::permute()
+         */
+        template<std::size_t... P>
+        auto permuted() const requires (sizeof...(P) == D) && (detail::isPermutation<D>({P...})) {
+            constexpr std::array<std::size_t, D> extents{N, O...};
+            DArray<T, extents[P]...> result;
+            const auto source = permute<P...>();
+            detail::copyBlocked<D>(source.data(), source.strides(), result.flat_begin(),
+                                   detail::rowMajorStrides(source.shape()), source.shape());
+            return result;
+        }
+
+        /***
+         * @brief Copy the array with the order of its dimensions reversed, in cache-sized blocks
+         * @return DArray<T, ..., O_0, N>, e.g. the transpose of a matrix
+         */
+        auto transposed() const {
+            return [this]<std::size_t... I>(std::index_sequence<I...>) {
+                return this->template permuted<(D - 1 - I)...>();
+            }(std::make_index_sequence<D>());
+        }
+
+        /***
+         * @return Pointer to the first element stored, elements of DArray being contiguous in row-major order
+         */
+        T *flat_begin() noexcept {
+            static_assert(sizeof(DArray) == sizeof(T) * N * (O * ...), "DArray elements must be contiguous");
+            return reinterpret_cast<T *>(this->data());
+        }
+
+        /***
+         * @see DArray<T,N,O...>::flat_begin()
+         */
+        const T *flat_begin() const noexcept {
+            static_assert(sizeof(DArray) == sizeof(T) * N * (O * ...), "DArray elements must be contiguous");
+            return reinterpret_cast<const T *>(this->data());
+        }
+
+        /***
+         * @return Pointer past the last element stored
+         */
+        T *flat_end() noexcept {
+            return flat_begin() + N * (O * ...);
+        }
+
+        /***
+         * @see DArray<T,N,O...>::flat_end()
+         */
+        const T *flat_end() const noexcept {
+            return flat_begin() + N * (O * ...);
+        }
+
+        /***
+         * @return Contiguous range over all elements stored, in row-major order
+         */
+        std::span<T, N * (O * ...)> elements() noexcept {
+            return std::span<T, N * (O * ...)>(flat_begin(), N * (O * ...));
+        }
+
+        /***
+         * @see DArray<T,N,O...>::elements()
+         */
+        std::span<const T, N * (O * ...)> elements() const noexcept {
+            return std::span<const T, N * (O * ...)>(flat_begin(), N * (O * ...));
+        }
+
         /***
          * @return Return total amount of elements stored
          */
@@ -197,58 +490,6 @@ namespace mdc {
         }
     };
 
-    /***
-     * @brief Print function for n-dimentional DArrays.
-     *        DArrays with an higher dimension than 2 will print their dimension and current allocation
-     *        for each dimension, while lower dimensions will resemble an handwritten matrix.
-     *        Format example:
-     * @code
-     * DArray<2,3,2>{
-     * |0.5, 0.51|
-     * |1.5, 1.51|
-     * |2.5, 2.51|,
-     *
-     * |3.5, 3.51|
-     * |3.55, 4.51|
-     * |5.5, 5.51|
-     * }
-     * @endcode
-     * @see operator<<(std::ostream &, const DArray<U,M1,M2> &)
-     * @see operator<<(std::ostream &, const DArray<U,M> &)
-     */
-    template<typename U, std::size_t M, size_t... P>
-    std::ostream &operator<<(std::ostream &os, const mdc::DArray<U, M, P...> &dArray)requires (sizeof...(P) > 0) {
-        auto size = dArray.size();
-        os << "DArray<" << M;
-        ((os << ',' << P), ...);
-        os << ">{\n";
-        for (std::size_t i = 0; i < size; ++i) {
-            os << dArray.at(i);
-            if (i < size - 1)
-                os << ",\n\n";
-        }
-        return os << "\n}";
-    }
-
-    /***
-     * @brief Print function for 2-dimentional DArrays.
-     *        Format example:
-     * @code
-     * |42.0, 10.5|
-     * |5.55, 11.2|
-     * |-9.0, 0.01|
-     * @endcode
-     */
-    template<typename U, std::size_t M1, std::size_t M2>
-    std::ostream &operator<<(std::ostream &os, const mdc::DArray<U, M1, M2> &dArray) {
-        for (std::size_t i = 0; i < M1; ++i) {
-            os << dArray.at(i);
-            if (i < M1 - 1)
-                os << '\n';
-        }
-        return os;
-    }
-
     /***
      * @brief Template specialization of DArray with a single dimension
      * @tparam T Type of elements stored
@@ -267,19 +508,73 @@ namespace mdc {
          * @tparam U Type of parameters initialized, must be the same as typename T of DArray
          */
         template<typename ...U>
-        DArray(const U &...values) requires (std::is_convertible_v<U, T> &&...) : std::array<T, N>({values...}) {}
+        constexpr DArray(const U &...values) requires (std::is_convertible_v<U, T> &&...) : std::array<T, N>({values...}) {}
 
         /***
          * @brief Construct DArray as copy of a std::array
          * @param array Array to be copied
          */
-        DArray(const std::array<T, N> &array) : std::array<T, N>(array) {}
+        constexpr DArray(const std::array<T, N> &array) : std::array<T, N>(array) {}
 
         /***
          * @brief Construct DArray moving r-value std::array
          * @param array Array to be moved
          */
-        DArray(std::array<T, N> &&array) : std::array<T, N>(std::move(array)) {}
+        constexpr DArray(std::array<T, N> &&array) : std::array<T, N>(std::move(array)) {}
+
+        /***
+         * @brief Construct DArray evaluating an element-wise expression, in a single pass over all elements
+         * @param expression Expression with the same shape of DArray
+         * @see ArrayExpression
+         */
+        template<typename Op, typename... E>
+        constexpr DArray(const ArrayExpression<Op, E...> &expression) {
+            detail::evaluate(expression, *this);
+        }
+
+        /***
+         * @brief Constructor of elements computed from their index, usable in constant expressions
+         * @param generator Function called with the index of each element, in order, returning its value
+         */
+        template<typename Fn>
+        constexpr explicit DArray(Fn generator) requires detail::Generator<Fn, T, 1> {
+            detail::generateInto<1>(*this, generator);
+        }
+
+        /***
+         * @brief Assign the value of an element-wise expression to each element, in a single pass
+         * @param expression Expression with the same shape of DArray
+         * @return Reference to this DArray
+         * @see ArrayExpression
+         */
+        template<typename Op, typename... E>
+        constexpr DArray &operator=(const ArrayExpression<Op, E...> &expression) {
+            detail::evaluate(expression, *this);
+            return *this;
+        }
+
+        /***
+         * @brief Get a reference to a specific element held by DArray, without throwing on an invalid index.
+         *        The index is validated according to BoundsCheck::Default, i.e. only in debug builds by default.
+         * @param index Position of the element
+         * @return Reference to the requested element
+         * @see BoundsCheck
+         */
+        template<std::integral Idx>
+        constexpr T &operator()(Idx index) noexcept {
+            mdc::BoundsCheck::Default::check(static_cast<std::size_t>(index), N);
+            return (*this)[index];
+        }
+
+        /***
+         * @see DArray<T,N>::operator()(Idx index)
+         * @return Constant reference to the requested element
+         */
+        template<std::integral Idx>
+        constexpr const T &operator()(Idx index) const noexcept {
+            mdc::BoundsCheck::Default::check(static_cast<std::size_t>(index), N);
+            return (*this)[index];
+        }
 
         /***
          * @brief View sub-array corresponding to a span interval,
@@ -288,7 +583,7 @@ namespace mdc {
          * @return DArray containing copies of the elements spanned,
          *         dimension of the DArray returned corresponds to the size (i.e. length) of the span
          */
-        DArray<T, N> at(const mdc::DSpanning<mdc::SpanSize::All> span) const {
+        constexpr DArray<T, N> at(const mdc::DSpanning<mdc::SpanSize::All> span) const {
             return *this;
         }
 
@@ -301,7 +596,7 @@ namespace mdc {
          *         dimension of the DArray returned corresponds to the size (i.e. length) of the span
          */
         template<std::size_t Value>
-        DArray<T, 1> at(const mdc::DSpanning<mdc::SpanSize::Index<Value>> span) const {
+        constexpr DArray<T, 1> at(const mdc::DSpanning<mdc::SpanSize::Index<Value>> span) const {
             return {this->at(Value)};
         }
 
@@ -316,7 +611,7 @@ namespace mdc {
          *         dimension of the DArray returned corresponds to the size (i.e. length) of the span
          */
         template<std::size_t From, std::size_t To>
-        DArray<T, To - From + 1>
+        constexpr DArray<T, To - From + 1>
         at(const mdc::DSpanning<mdc::SpanSize::Interval<From, To>> span) const requires (From < N && To < N) {
             std::array<T, To - From + 1> data;
             auto j = 0;
@@ -325,6 +620,27 @@ namespace mdc {
             return data;
         }
 
+        /***
+         * @brief View sub-array corresponding to a span interval,
+         *        specialization with the interval being a strided interval between two indices
+         *        (i.e. DSpan<SpanSize::Interval<From, To, Step>>)
+         * @tparam From Index of the first element spanned
+         * @tparam To Index of the last element spanned (included only if reached by a multiple of Step)
+         * @tparam Step Distance between two consecutive elements spanned
+         * @param span Span object describing an interval of elements
+         * @return DArray containing copies of the elements spanned,
+         *         dimension of the DArray returned corresponds to the size (i.e. length) of the span
+         */
+        template<std::size_t From, std::size_t To, std::size_t Step>
+        constexpr DArray<T, mdc::DSpanning<mdc::SpanSize::Interval<From, To, Step>>::Size>
+        at(const mdc::DSpanning<mdc::SpanSize::Interval<From, To, Step>> span) const requires (From < N && To < N) {
+            std::array<T, decltype(span)::Size> data;
+            auto i = From;
+            for (std::size_t j = 0; j < decltype(span)::Size; ++j, i += Step)
+                data.at(j) = this->at(i);
+            return data;
+        }
+
         /***
          * @brief View sub-array corresponding to a span interval,
          *        specialization with the interval being an interval of fixed size (i.e. DSpan<SpanSize::Interval<Size>>)
@@ -334,15 +650,118 @@ namespace mdc {
          *         dimension of the DArray returned corresponds to the size (i.e. length) of the span
          */
         template<std::size_t Size>
-        DArray<T, Size>
+        constexpr DArray<T, Size>
         at(const mdc::DSpanning<mdc::SpanSize::Interval<Size>> span) const requires (Size <= N) {
             std::array<T, Size> data;
-            auto j = 0;
-            for (auto i = span.from; i <= span.to; ++i)
-                data.at(j++) = this->at(i);
+            auto i = span.from;
+            for (std::size_t j = 0; j < Size; ++j, i += span.step)
+                data.at(j) = this->at(i);
             return data;
         }
 
+        /***
+         * @brief Slice the array with a Span object known only at runtime (e.g. Span::of(from, to)),
+         *        without copying any element. Intervals exceeding the size of DArray are truncated
+         * @param span Span object representing the elements viewed
+         * @return View over the elements represented by span, whose extent is set at runtime
+         * @see DArray<T,N>::view(J span)
+         */
+        template<typename J>
+        DView<1, T> at(J span) requires detail::RuntimeSpannings<J> {
+            return view().at(span);
+        }
+
+        /***
+         * @see DArray<T,N>::at(J span)
+         * @return Read-only view over the elements represented by span
+         */
+        template<typename J>
+        DView<1, const T> at(J span) const requires detail::RuntimeSpannings<J> {
+            return view().at(span);
+        }
+
+        /***
+         * @brief View the whole DArray without copying its elements
+         * @return View over all elements of DArray
+         */
+        DView<1, T> view() noexcept {
+            static_assert(sizeof(DArray) == sizeof(T) * N, "DArray elements must be contiguous");
+            return {this->data(), {N}};
+        }
+
+        /***
+         * @see DArray<T,N>::view()
+         * @return Read-only view over all elements of DArray
+         */
+        DView<1, const T> view() const noexcept {
+            static_assert(sizeof(DArray) == sizeof(T) * N, "DArray elements must be contiguous");
+            return {this->data(), {N}};
+        }
+
+        /***
+         * @brief View a sub-array corresponding to a given interval, without copying any element
+         * @param span Span object describing an interval of elements
+         * @return View over the elements represented by the given Span objects
+         * @see DView<D,T>::at(J span, K... spans)
+         */
+        template<typename J>
+        DView<1, T> view(J span)
+        requires std::is_convertible_v<J, mdc::Spanning> {
+            return view().at(span);
+        }
+
+        /***
+         * @see DArray<T,N>::view(J span)
+         * @return Read-only view over the elements represented by the given Span objects
+         */
+        template<typename J>
+        DView<1, const T> view(J span) const
+        requires std::is_convertible_v<J, mdc::Spanning> {
+            return view().at(span);
+        }
+
+        /***
+         * @return Pointer to the first element stored
+         */
+        constexpr T *flat_begin() noexcept {
+            return this->data();
+        }
+
+        /***
+         * @see DArray<T,N>::flat_begin()
+         */
+        constexpr const T *flat_begin() const noexcept {
+            return this->data();
+        }
+
+        /***
+         * @return Pointer past the last element stored
+         */
+        constexpr T *flat_end() noexcept {
+            return this->data() + N;
+        }
+
+        /***
+         * @see DArray<T,N>::flat_end()
+         */
+        constexpr const T *flat_end() const noexcept {
+            return this->data() + N;
+        }
+
+        /***
+         * @return Contiguous range over all elements stored
+         */
+        constexpr std::span<T, N> elements() noexcept {
+            return std::span<T, N>(this->data(), N);
+        }
+
+        /***
+         * @see DArray<T,N>::elements()
+         */
+        constexpr std::span<const T, N> elements() const noexcept {
+            return std::span<const T, N>(this->data(), N);
+        }
+
         /***
          * @return Number of elements stored
          */
@@ -352,21 +771,73 @@ namespace mdc {
     };
 
     /***
-     * @brief Print function for 1-dimentional DArrays.
+     * @brief Assign the same value to every element of a DArray, also in constant expressions
+     * @param dArray DArray modified
+     * @param value Value copied into each element
+     */
+    template<typename T, std::size_t N, std::size_t... O>
+    constexpr void fill(DArray<T, N, O...> &dArray, const std::type_identity_t<T> &value) {
+        if constexpr (sizeof...(O) == 0)
+            dArray.fill(value);
+        else
+            for (auto &sub: dArray)
+                mdc::fill(sub, value);
+    }
+
+    /***
+     * @brief Apply a function to every element of a DArray, also in constant expressions
+     * @param dArray DArray read
+     * @param fn Function called with each element, in row-major order
+     * @return DArray of the same shape, holding the results of fn
+     */
+    template<typename T, std::size_t N, std::size_t... O, std::invocable<const T &> Fn>
+    constexpr auto transform(const DArray<T, N, O...> &dArray, Fn fn) {
+        DArray<std::invoke_result_t<Fn &, const T &>, N, O...> result;
+        if (std::is_constant_evaluated()) {
+            for (std::size_t i = 0; i < (N * ... * O); ++i)
+                detail::flatAt(result, i) = fn(detail::flatAt(dArray, i));
+        } else {
+            std::transform(dArray.flat_begin(), dArray.flat_end(), result.flat_begin(), fn);
+        }
+        return result;
+    }
+
+    /***
+     * @brief Write a DArray through a Formatter, one row for the last dimension, one matrix for the last two,
+     *        and one block for each higher dimension
+     * @see Formatter
+     */
+    template<typename U, std::size_t M, size_t... P>
+    Formatter &operator<<(Formatter &formatter, const mdc::DArray<U, M, P...> &dArray) {
+        if constexpr (sizeof...(P) == 0)
+            return formatter.row(M, [&dArray](std::size_t i) -> decltype(auto) { return dArray[i]; });
+        else if constexpr (sizeof...(P) == 1)
+            return formatter.matrix(M, [&](std::size_t i) { formatter << dArray[i]; });
+        else
+            return formatter.block("DArray", {M, P...}, M, [&](std::size_t i) { formatter << dArray[i]; });
+    }
+
+    /***
+     * @brief Print function for DArrays, through a buffered Formatter.
+     *        DArrays with an higher dimension than 2 will print their dimension and current allocation
+     *        for each dimension, while lower dimensions will resemble an handwritten matrix.
      *        Format example:
      * @code
-     * |0.0, 3.0, 4.3|
+     * DArray<2,3,2>{
+     * |0.5, 0.51|
+     * |1.5, 1.51|
+     * |2.5, 2.51|,
+     *
+     * |3.5, 3.51|
+     * |3.55, 4.51|
+     * |5.5, 5.51|
+     * }
      * @endcode
+     *        Floating points follow the precision and notation (std::fixed, std::scientific) set on the stream.
      */
-    template<typename U, std::size_t M>
-    std::ostream &operator<<(std::ostream &os, const mdc::DArray<U, M> &dArray) {
-        os << '|';
-        for (std::size_t i = 0; i < M; ++i) {
-            os << dArray.at(i);
-            if (i < M - 1)
-                os << ", ";
-        }
-        return os << '|';
+    template<typename U, std::size_t M, size_t... P>
+    std::ostream &operator<<(std::ostream &os, const mdc::DArray<U, M, P...> &dArray) {
+        return detail::print(os, dArray);
     }
 
 }
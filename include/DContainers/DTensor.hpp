@@ -0,0 +1,535 @@
+/*
+ *   Copyright 2022 Alberto Guarnieri
+ *
+ *   Licensed under the Apache License, Version 2.0 (the "License");
+ *   you may not use this file except in compliance with the License.
+ *   You may obtain a copy of the License at
+ *
+ *       http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *   Unless required by applicable law or agreed to in writing, software
+ *   distributed under the License is distributed on an "AS IS" BASIS,
+ *   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *   See the License for the specific language governing permissions and
+ *   limitations under the License.
+ */
+
+#ifndef DCONTAINERS_DTENSOR_HPP
+#define DCONTAINERS_DTENSOR_HPP
+
+
+#include <algorithm>
+#include <array>
+#include <concepts>
+#include <initializer_list>
+#include <iostream>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "DContainers/BoundsCheck.hpp"
+#include "DContainers/DVector.hpp"
+#include "DContainers/DView.hpp"
+#include "DContainers/Format.hpp"
+#include "DContainers/Span/Spanning.hpp"
+
+
+namespace mdc {
+
+    namespace detail {
+
+        /***
+         * @brief Nested initializer_list of depth D, whose inner-most level holds elements of type T
+         */
+        template<std::size_t D, typename T>
+        struct NestedInitializerList {
+            using type = std::initializer_list<typename NestedInitializerList<D - 1, T>::type>;
+        };
+
+        template<typename T>
+        struct NestedInitializerList<1, T> {
+            using type = std::initializer_list<T>;
+        };
+
+    }
+
+/***
+ * @brief Represent a rectangular tensor with a fixed dimension, storing all of its elements in a single
+ *        contiguous buffer (row-major), described by a shape and the corresponding strides
+ * @tparam D Tensor dimension
+ * @tparam T Type of the elements stored
+ * @note Unlike DVector, each dimension has the same extent across all sub-tensors,
+ *       hence a DTensor is allocated with a single allocation regardless of its dimension
+ * @note bool is not supported, as its elements could not be addressed through data() nor elements()
+ */
+    template<std::size_t D, typename T>
+    class DTensor {
+        static_assert(D > 0, "DTensor must have at least one dimension");
+        static_assert(!std::is_same_v<std::remove_cv_t<T>, bool>,
+                      "DTensor cannot hold bool, since std::vector<bool> is packed: use char or std::uint8_t instead");
+
+    public:
+        using value_type = T;
+        using shape_type = std::array<std::size_t, D>;
+
+    private:
+        shape_type _shape;
+        shape_type _strides;
+        std::vector<T> _data;
+
+        static constexpr std::size_t countOf(const shape_type &shape) noexcept {
+            std::size_t count = 1;
+            for (auto extent: shape)
+                count *= extent;
+            return count;
+        }
+
+        static constexpr shape_type filledShape(std::size_t alloc) noexcept {
+            shape_type shape{};
+            shape.fill(alloc);
+            return shape;
+        }
+
+        template<typename... Indices>
+        std::size_t offsetOf(Indices... indices) const {
+            const shape_type position{static_cast<std::size_t>(indices)...};
+            std::size_t offset = 0;
+            for (std::size_t d = 0; d < D; ++d) {
+                if (position[d] >= _shape[d])
+                    throw std::out_of_range(
+                            "DTensor::at: index " + std::to_string(position[d]) + " of dimension " +
+                            std::to_string(d) + " is out of range (extent=" + std::to_string(_shape[d]) + ")");
+                offset += position[d] * _strides[d];
+            }
+            return offset;
+        }
+
+        template<typename... Indices>
+        constexpr std::size_t uncheckedOffsetOf(Indices... indices) const noexcept {
+            const shape_type position{static_cast<std::size_t>(indices)...};
+            std::size_t offset = 0;
+            for (std::size_t d = 0; d < D; ++d) {
+                mdc::BoundsCheck::Default::check(position[d], _shape[d]);
+                offset += position[d] * _strides[d];
+            }
+            return offset;
+        }
+
+        template<std::size_t L, typename List>
+        static void shapeOfList(const List &list, shape_type &shape) {
+            shape[D - L] = list.size();
+            if constexpr (L > 1)
+                if (list.size() > 0)
+                    shapeOfList<L - 1>(*list.begin(), shape);
+        }
+
+        template<std::size_t L, typename List>
+        void copyList(const List &list, T *first) {
+            if (list.size() != _shape[D - L])
+                throw std::invalid_argument("DTensor: initializer_list is not rectangular");
+            if constexpr (L == 1)
+                std::copy(list.begin(), list.end(), first);
+            else
+                for (const auto &subList: list) {
+                    copyList<L - 1>(subList, first);
+                    first += _strides[D - L];
+                }
+        }
+
+        template<std::size_t L, typename Allocator>
+        static void shapeOfDVector(const DVector<L, T, Allocator> &dVector, shape_type &shape) {
+            shape[D - L] = dVector.size();
+            if constexpr (L > 1)
+                if (!dVector.empty())
+                    shapeOfDVector<L - 1>(dVector.at(0), shape);
+        }
+
+        template<std::size_t L, typename Allocator>
+        void copyDVector(const DVector<L, T, Allocator> &dVector, T *first) {
+            if (dVector.size() != _shape[D - L])
+                throw std::invalid_argument("DTensor: DVector is not rectangular");
+            if constexpr (L == 1)
+                std::copy(dVector.begin(), dVector.end(), first);
+            else
+                for (const auto &subVector: dVector) {
+                    copyDVector<L - 1>(subVector, first);
+                    first += _strides[D - L];
+                }
+        }
+
+        template<std::size_t L>
+        DVector<L, T> makeDVector(const T *first) const {
+            if constexpr (L == 1) {
+                return DVector<1, T>(first, first + _shape[D - 1]);
+            } else {
+                DVector<L, T> dVector;
+                dVector.reserve(_shape[D - L]);
+                for (std::size_t i = 0; i < _shape[D - L]; ++i)
+                    dVector.push_back(makeDVector<L - 1>(first + i * _strides[D - L]));
+                return dVector;
+            }
+        }
+
+    public:
+        /***
+         * @brief Construct an empty DTensor, where every dimension has extent zero
+         */
+        DTensor() : _shape{}, _strides(detail::rowMajorStrides(_shape)), _data() {}
+
+        /***
+         * @brief Constructor with a single allocation size for all dimensions
+         * @param alloc Number of elements allocated for each dimension
+         */
+        explicit DTensor(std::size_t alloc) : DTensor(filledShape(alloc)) {}
+
+        /***
+         * @brief Constructor to specify a different allocation for each dimension.
+         * @param alloc Number of elements to allocate to the first (i.e. left most) dimension
+         * @param next_allocs Parameter pack for allocation of subsequent dimensions
+         */
+        template<std::integral Alloc, std::integral... Allocs>
+        explicit DTensor(Alloc alloc, Allocs... next_allocs) requires (sizeof...(Allocs) == D - 1)
+                : DTensor(shape_type{static_cast<std::size_t>(alloc), static_cast<std::size_t>(next_allocs)...}) {}
+
+        /***
+         * @brief Constructor given the extent of each dimension, with every element initialized to the same value
+         * @param shape Extent of each dimension, starting from the higher (i.e. left-most) one
+         * @param value Value copied into each element
+         */
+        explicit DTensor(const shape_type &shape, const T &value = T())
+                : _shape(shape), _strides(detail::rowMajorStrides(shape)), _data(countOf(shape), value) {}
+
+        /***
+         * @brief Constructor of DTensor with a nested initializer_list, one level for each dimension
+         * @param values Nested initializer_list of elements
+         * @throws std::invalid_argument If sub-lists of the same level have a different number of elements
+         */
+        DTensor(typename detail::NestedInitializerList<D, T>::type values) : _shape{} {
+            shapeOfList<D>(values, _shape);
+            _strides = detail::rowMajorStrides(_shape);
+            _data.resize(countOf(_shape));
+            copyList<D>(values, _data.data());
+        }
+
+        /***
+         * @brief Construct DTensor as a dense copy of a DVector
+         * @param dVector DVector to be copied
+         * @throws std::invalid_argument If dVector is jagged, i.e. sub-vectors of the same level differ in size
+         */
+        template<typename Allocator>
+        explicit DTensor(const DVector<D, T, Allocator> &dVector) : _shape{} {
+            shapeOfDVector<D>(dVector, _shape);
+            _strides = detail::rowMajorStrides(_shape);
+            _data.resize(countOf(_shape));
+            copyDVector<D>(dVector, _data.data());
+        }
+
+        /***
+         * @brief Convert DTensor into a nested DVector with the same shape
+         */
+        explicit operator DVector<D, T>() const {
+            return makeDVector<D>(_data.data());
+        }
+
+        /***
+         * @brief Get a reference to a specific element held by DTensor, specifying its position.
+         * @param index Index of the higher (i.e. left-most) dimension
+         * @param indices Parameter pack of the indices for the lower dimensions of the element
+         * @return Reference to the requested element
+         * @throws std::out_of_range If any index is not lower than the extent of its dimension
+         */
+        template<std::integral Idx, std::integral... Indices>
+        T &at(Idx index, Indices... indices) requires (sizeof...(Indices) == D - 1) {
+            return _data[offsetOf(index, indices...)];
+        }
+
+        /***
+         * @see DTensor<D,T>::at(Idx index, Indices... indices)
+         * @return Constant reference to the requested element
+         */
+        template<std::integral Idx, std::integral... Indices>
+        const T &at(Idx index, Indices... indices) const requires (sizeof...(Indices) == D - 1) {
+            return _data[offsetOf(index, indices...)];
+        }
+
+        /***
+         * @brief Get a reference to a specific element held by DTensor, without throwing on invalid indices.
+         *        Indices are validated according to BoundsCheck::Default, i.e. only in debug builds by default.
+         * @param index Index of the higher (i.e. left-most) dimension
+         * @param indices Parameter pack of the indices for the lower dimensions of the element
+         * @return Reference to the requested element
+         * @see BoundsCheck
+         */
+        template<std::integral Idx, std::integral... Indices>
+        T &operator()(Idx index, Indices... indices) noexcept requires (sizeof...(Indices) == D - 1) {
+            return _data[uncheckedOffsetOf(index, indices...)];
+        }
+
+        /***
+         * @see DTensor<D,T>::operator()(Idx index, Indices... indices)
+         * @return Constant reference to the requested element
+         */
+        template<std::integral Idx, std::integral... Indices>
+        const T &operator()(Idx index, Indices... indices) const noexcept requires (sizeof...(Indices) == D - 1) {
+            return _data[uncheckedOffsetOf(index, indices...)];
+        }
+
+        /***
+         * @brief View specific intervals of the tensor using Span objects for each dimension.
+         *        Intervals exceeding the extent of a dimension are truncated, as in DVector<1,T>::at(Spanning)
+         * @param span First Span object to dereference, corresponding to the higher dimension
+         * @param spans Parameter pack of following Span object
+         * @return DTensor containing copies of elements represented by the given Span objects
+         * @see Span
+         */
+        template<typename J, typename... K>
+        DTensor<D, T> at(J span, K... spans) const
+        requires (sizeof...(K) == D - 1)
+                 && std::is_convertible_v<J, mdc::Spanning> && (std::is_convertible_v<K, mdc::Spanning> && ...) {
+            return view(span, spans...).materialize();
+        }
+
+        /***
+         * @brief View the whole DTensor without copying its elements
+         * @return View over all elements of DTensor
+         */
+        DView<D, T> view() noexcept {
+            return {_data.data(), _shape, _strides};
+        }
+
+        /***
+         * @see DTensor<D,T>::view()
+         * @return Read-only view over all elements of DTensor
+         */
+        DView<D, const T> view() const noexcept {
+            return {_data.data(), _shape, _strides};
+        }
+
+        /***
+         * @brief View specific intervals of the tensor using Span objects for each dimension,
+         *        without copying any element
+         * @param span First Span object, corresponding to the higher dimension
+         * @param spans Parameter pack of following Span objects
+         * @return View over the elements represented by the given Span objects
+         * @see DView<D,T>::at(J span, K... spans)
+         */
+        template<typename J, typename... K>
+        DView<D, T> view(J span, K... spans)
+        requires (sizeof...(K) == D - 1)
+                 && std::is_convertible_v<J, mdc::Spanning> && (std::is_convertible_v<K, mdc::Spanning> && ...) {
+            return view().at(span, spans...);
+        }
+
+        /***
+         * @see DTensor<D,T>::view(J span, K... spans)
+         * @return Read-only view over the elements represented by the given Span objects
+         */
+        template<typename J, typename... K>
+        DView<D, const T> view(J span, K... spans) const
+        requires (sizeof...(K) == D - 1)
+                 && std::is_convertible_v<J, mdc::Spanning> && (std::is_convertible_v<K, mdc::Spanning> && ...) {
+            return view().at(span, spans...);
+        }
+
+        /***
+         * @brief View the tensor with the order of its dimensions reversed, without copying any element
+         * @see DView<D,T>::transpose()
+         */
+        DView<D, T> transpose() noexcept {
+            return view().transpose();
+        }
+
+        /***
+         * @see DTensor<D,T>::transpose()
+         * @return Read-only view with the order of dimensions reversed
+         */
+        DView<D, const T> transpose() const noexcept {
+            return view().transpose();
+        }
+
+        /***
+         * @brief View the tensor with its dimensions reordered, without copying any element.
+         *        A dense copy is obtained through DView<D,T>::materialize(), which copies in cache-sized blocks.
+         * @tparam P Dimension of DTensor placed at each position, e.g. <2, 0, 1> moves the last dimension first
+         * @see DView<D,T>::permute()
+         */
+        template<std::size_t... P>
+        DView<D, T> permute() noexcept requires (sizeof...(P) == D) && (detail::isPermutation<D>({P...})) {
+            return view().template permute<P...>();
+        }
+
+        /***
+         * @see DTensor<D,T>::permute()
+         * @return Read-only view with the dimensions reordered
+         */
+        template<std::size_t... P>
+        DView<D, const T> permute() const noexcept requires (sizeof...(P) == D) && (detail::isPermutation<D>({P...})) {
+            return view().template permute<P...>();
+        }
+
+        /***
+         * @return Iterator to the view of the first sub-tensor (or element) of the outer-most dimension
+         */
+        typename DView<D, T>::iterator begin() noexcept {
+            return view().begin();
+        }
+
+        typename DView<D, const T>::iterator begin() const noexcept {
+            return view().begin();
+        }
+
+        /***
+         * @return Iterator past the view of the last sub-tensor (or element) of the outer-most dimension
+         */
+        typename DView<D, T>::iterator end() noexcept {
+            return view().end();
+        }
+
+        typename DView<D, const T>::iterator end() const noexcept {
+            return view().end();
+        }
+
+        /***
+         * @return Number of sub-tensors (or elements) of the outer-most dimension
+         */
+        constexpr std::size_t size() const noexcept {
+            return _shape[0];
+        }
+
+        /***
+         * @return Extent of each dimension, starting from the higher (i.e. left-most) one
+         */
+        constexpr const shape_type &shape() const noexcept {
+            return _shape;
+        }
+
+        /***
+         * @param dim Dimension queried, where 0 is the higher (i.e. left-most) one
+         * @return Number of elements along dimension dim
+         */
+        constexpr std::size_t extent(std::size_t dim) const {
+            return _shape.at(dim);
+        }
+
+        /***
+         * @return Distance, in elements, between two consecutive indices of each dimension
+         */
+        constexpr const shape_type &strides() const noexcept {
+            return _strides;
+        }
+
+        /***
+         * @return Pointer to the contiguous buffer holding all elements, in row-major order
+         */
+        T *data() noexcept {
+            return _data.data();
+        }
+
+        /***
+         * @see DTensor<D,T>::data()
+         */
+        const T *data() const noexcept {
+            return _data.data();
+        }
+
+        /***
+         * @return Pointer to the first element stored, in row-major order
+         */
+        T *flat_begin() noexcept {
+            return _data.data();
+        }
+
+        /***
+         * @see DTensor<D,T>::flat_begin()
+         */
+        const T *flat_begin() const noexcept {
+            return _data.data();
+        }
+
+        /***
+         * @return Pointer past the last element stored
+         */
+        T *flat_end() noexcept {
+            return _data.data() + _data.size();
+        }
+
+        /***
+         * @see DTensor<D,T>::flat_end()
+         */
+        const T *flat_end() const noexcept {
+            return _data.data() + _data.size();
+        }
+
+        /***
+         * @return Contiguous range over all elements stored, in row-major order
+         */
+        std::span<T> elements() noexcept {
+            return _data;
+        }
+
+        /***
+         * @see DTensor<D,T>::elements()
+         */
+        std::span<const T> elements() const noexcept {
+            return _data;
+        }
+
+        /***
+         * @return Return total amount of elements stored, computed in constant time
+         */
+        constexpr std::size_t total() const noexcept {
+            return _data.size();
+        }
+
+        /***
+         * @return true iff the two tensors have the same shape and equal elements
+         */
+        bool operator==(const DTensor &other) const {
+            return _shape == other._shape && _data == other._data;
+        }
+    };
+
+    namespace detail {
+
+        template<typename T>
+        void formatTensor(Formatter &formatter, const T *first, const std::size_t *shape, const std::size_t *strides,
+                          std::size_t dims) {
+            if (dims == 1)
+                formatter.row(shape[0], [=](std::size_t i) -> const T & { return first[i * strides[0]]; });
+            else if (dims == 2)
+                formatter.matrix(shape[0], [&](std::size_t i) {
+                    formatTensor(formatter, first + i * strides[0], shape + 1, strides + 1, 1);
+                });
+            else
+                formatter.block("DTensor", {dims}, shape[0], [&](std::size_t i) {
+                    formatTensor(formatter, first + i * strides[0], shape + 1, strides + 1, dims - 1);
+                });
+        }
+
+    }
+
+    /***
+     * @brief Write a DTensor through a Formatter, with the same layout used for DVectors of equal dimension
+     * @see Formatter
+     */
+    template<std::size_t D, typename T>
+    Formatter &operator<<(Formatter &formatter, const mdc::DTensor<D, T> &dTensor) {
+        detail::formatTensor(formatter, dTensor.data(), dTensor.shape().data(), dTensor.strides().data(), D);
+        return formatter;
+    }
+
+    /***
+     * @brief Print function for DTensors, with the same format used for DVectors of equal dimension
+     * @see operator<<(std::ostream &, const DVector<D,T> &)
+     */
+    template<std::size_t D, typename T>
+    std::ostream &operator<<(std::ostream &os, const mdc::DTensor<D, T> &dTensor) {
+        return detail::print(os, dTensor);
+    }
+
+}
+
+
+#endif //DCONTAINERS_DTENSOR_HPP
@@ -19,32 +19,260 @@
 
 
 #include <vector>
+#include <algorithm>
 #include <array>
+#include <iterator>
+#include <memory>
+#include <memory_resource>
 #include <numeric>
 #include <iostream>
+#include <ranges>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
 
+#include "DContainers/BoundsCheck.hpp"
 #include "DContainers/Span/Spanning.hpp"
+#include "DContainers/DView.hpp"
+#include "DContainers/Format.hpp"
 
 
 namespace mdc {
 
+    namespace detail {
+
+        /***
+         * @brief Storage of a DVector<D,T,Allocator> with D > 1, i.e. a std::vector of sub-vectors
+         *        using Allocator rebound to the sub-vector type
+         */
+        template<std::size_t D, typename T, typename Allocator>
+        using NestedVector = std::vector<DVector<D - 1, T, Allocator>,
+                typename std::allocator_traits<Allocator>::template rebind_alloc<DVector<D - 1, T, Allocator>>>;
+
+        template<std::size_t D, typename T, bool Const, typename Allocator>
+        class SegmentedIterator;
+
+        /***
+         * @brief Iterator over all elements of a DVector<D,T,Allocator>, in row-major order
+         */
+        template<std::size_t D, typename T, bool Const, typename Allocator>
+        using FlatIterator = std::conditional_t<D == 1,
+                std::conditional_t<Const, typename std::vector<T, Allocator>::const_iterator,
+                        typename std::vector<T, Allocator>::iterator>,
+                SegmentedIterator<D, T, Const, Allocator>>;
+
+        /***
+         * @brief Forward iterator over all elements of a DVector<D,T> with D > 1, visiting each sub-vector in turn
+         *        and skipping empty ones
+         * @tparam D Dimension of the DVector iterated
+         * @tparam T Type of the elements stored
+         * @tparam Const true to iterate through constant references
+         * @tparam Allocator Allocator of the DVector iterated
+         */
+        template<std::size_t D, typename T, bool Const, typename Allocator>
+        class SegmentedIterator {
+        private:
+            using Rows = NestedVector<D, T, Allocator>;
+            using Outer = std::conditional_t<Const, typename Rows::const_iterator, typename Rows::iterator>;
+            using Inner = FlatIterator<D - 1, T, Const, Allocator>;
+
+            Outer _outer{}, _outerEnd{};
+            Inner _inner{}, _innerEnd{};
+
+            static Inner innerBegin(Outer row) {
+                if constexpr (D == 2)
+                    return row->begin();
+                else
+                    return Inner(row->begin(), row->end());
+            }
+
+            static Inner innerEnd(Outer row) {
+                if constexpr (D == 2)
+                    return row->end();
+                else
+                    return Inner(row->end(), row->end());
+            }
+
+            void skipEmpty() {
+                for (; _outer != _outerEnd; ++_outer) {
+                    _inner = innerBegin(_outer);
+                    _innerEnd = innerEnd(_outer);
+                    if (_inner != _innerEnd)
+                        return;
+                }
+            }
+
+        public:
+            using value_type = T;
+            using difference_type = std::ptrdiff_t;
+            using reference = std::conditional_t<Const, const T &, T &>;
+            using pointer = std::conditional_t<Const, const T *, T *>;
+            using iterator_concept = std::forward_iterator_tag;
+            using iterator_category = std::forward_iterator_tag;
+
+            SegmentedIterator() = default;
+
+            /***
+             * @param first Iterator to the first sub-vector visited
+             * @param last Iterator past the last sub-vector visited
+             */
+            SegmentedIterator(Outer first, Outer last) : _outer(first), _outerEnd(last) {
+                skipEmpty();
+            }
+
+            reference operator*() const {
+                return *_inner;
+            }
+
+            pointer operator->() const {
+                return std::addressof(*_inner);
+            }
+
+            SegmentedIterator &operator++() {
+                if (++_inner == _innerEnd) {
+                    ++_outer;
+                    skipEmpty();
+                }
+                return *this;
+            }
+
+            SegmentedIterator operator++(int) {
+                auto copy = *this;
+                ++*this;
+                return copy;
+            }
+
+            friend bool operator==(const SegmentedIterator &lhs, const SegmentedIterator &rhs) {
+                return lhs._outer == rhs._outer && (lhs._outer == lhs._outerEnd || lhs._inner == rhs._inner);
+            }
+        };
+
+        /***
+         * @brief Store in shape the largest size of the sub-vectors of each level, visiting sub-vectors only
+         * @tparam R Dimension of the outer-most DVector, i.e. of shape
+         */
+        template<std::size_t R, typename V>
+        void boundingShape(const V &dVector, std::array<std::size_t, R> &shape) noexcept {
+            constexpr std::size_t level = R - std::tuple_size_v<typename V::shape_type>;
+            shape[level] = std::max(shape[level], dVector.size());
+            if constexpr (level + 1 < R)
+                for (const auto &subVector: dVector)
+                    boundingShape(subVector, shape);
+        }
+
+        /***
+         * @brief Store in shape the size of the first sub-vector of each level
+         * @tparam R Dimension of the outer-most DVector, i.e. of shape
+         */
+        template<std::size_t R, typename V>
+        void firstShape(const V &dVector, std::array<std::size_t, R> &shape) noexcept {
+            constexpr std::size_t level = R - std::tuple_size_v<typename V::shape_type>;
+            shape[level] = dVector.size();
+            if constexpr (level + 1 < R)
+                if (!dVector.empty())
+                    firstShape(dVector.front(), shape);
+        }
+
+        /***
+         * @brief Check that the sub-vectors of each level have the size stored in shape
+         * @tparam R Dimension of the outer-most DVector, i.e. of shape
+         */
+        template<std::size_t R, typename V>
+        bool matchesShape(const V &dVector, const std::array<std::size_t, R> &shape) noexcept {
+            constexpr std::size_t level = R - std::tuple_size_v<typename V::shape_type>;
+            if (dVector.size() != shape[level])
+                return false;
+            if constexpr (level + 1 < R)
+                for (const auto &subVector: dVector)
+                    if (!matchesShape(subVector, shape))
+                        return false;
+            return true;
+        }
+
+        /***
+         * @return Largest size among the sub-vectors dim levels below dVector
+         */
+        template<typename V>
+        std::size_t maxExtent(const V &dVector, std::size_t dim) noexcept {
+            if (dim == 0)
+                return dVector.size();
+            std::size_t extent = 0;
+            if constexpr (std::tuple_size_v<typename V::shape_type> > 1)
+                for (const auto &subVector: dVector)
+                    extent = std::max(extent, maxExtent(subVector, dim - 1));
+            return extent;
+        }
+
+        /***
+         * @brief Fill an empty DVector with sub-vectors of the given extents, allocating each one exactly once.
+         *        Each sub-vector is built in place and then moved into its parent, hence nothing is copied.
+         * @param dVector Empty DVector with D > 1, whose allocator is propagated to its sub-vectors
+         * @param extents Number of elements of each dimension, starting from the one of dVector
+         * @param leaf Function filling each inner-most sub-vector, called with the sub-vector, its size
+         *             and its position
+         * @param indices Position of dVector
+         */
+        template<typename V, typename Leaf, typename... Indices>
+        void buildRectangular(V &dVector, const std::size_t *extents, const Leaf &leaf, Indices... indices) {
+            using Row = typename V::value_type;
+            dVector.reserve(extents[0]);
+            for (std::size_t i = 0; i < extents[0]; ++i) {
+                Row row(typename Row::allocator_type(dVector.get_allocator()));
+                if constexpr (std::tuple_size_v<typename Row::shape_type> == 1)
+                    leaf(row, extents[1], indices..., i);
+                else
+                    buildRectangular(row, extents + 1, leaf, indices..., i);
+                dVector.push_back(std::move(row));
+            }
+        }
+
+        inline constexpr auto valueInitialized = [](auto &row, std::size_t extent, auto...) {
+            row.resize(extent);
+        };
+
+        template<std::size_t D>
+        void checkDimension(std::size_t dim) {
+            if (dim >= D)
+                throw std::out_of_range("DVector: dimension " + std::to_string(dim) + " is out of range (D=" +
+                                        std::to_string(D) + ")");
+        }
+
+    }
+
+    /***
+     * @brief Tag selecting the constructors of elements meant to be overwritten,
+     *        in the spirit of std::make_unique_for_overwrite
+     */
+    struct for_overwrite_t {
+        explicit for_overwrite_t() = default;
+    };
+
+    inline constexpr for_overwrite_t for_overwrite{};
+
 /***
  * @brief Represent a vector with a fixed dimension
  * @tparam D Vector dimension
  * @tparam T Type of the elements stored
+ * @tparam Allocator Allocator of T, std::allocator<T> by default, rebound and propagated to every sub-vector
+ * @see mdc::pmr::DVector
  */
-    template<std::size_t D, typename T>
-    class DVector : public std::vector<DVector<D - 1, T>> {
+    template<std::size_t D, typename T, typename Allocator>
+    class DVector : public detail::NestedVector<D, T, Allocator> {
     public:
-        using std::vector<DVector<D - 1, T>>::vector;
-        using std::vector<DVector<D - 1, T>>::at;
+        using detail::NestedVector<D, T, Allocator>::vector;
+        using detail::NestedVector<D, T, Allocator>::at;
+
+        using shape_type = std::array<std::size_t, D>;
+        using flat_iterator = detail::FlatIterator<D, T, false, Allocator>;
+        using const_flat_iterator = detail::FlatIterator<D, T, true, Allocator>;
 
         /***
          * @brief Constructor with a single allocation size for all dimensions
          * @param alloc Number of elements allocated for each dimension
          */
-        explicit DVector(std::size_t alloc)
-                : std::vector<DVector<D - 1, T>>(alloc, DVector<D - 1, T>(alloc)) {}
+        explicit DVector(std::size_t alloc) : DVector(std::allocator_arg, Allocator(), alloc) {}
 
         /***
          * @brief Constructor to specify a different allocation for each dimension.
@@ -52,8 +280,82 @@ namespace mdc {
          * @param next_allocs  Parameter pack for allocation of subsequent dimensions
          */
         template<std::integral Alloc, std::integral... Allocs>
-        explicit DVector(Alloc alloc, Allocs... next_allocs)requires (sizeof...(Allocs) == D - 1) : std::vector<DVector<
-                D - 1, T>>(alloc, DVector<D - 1, T>(next_allocs...)) {}
+        explicit DVector(Alloc alloc, Allocs... next_allocs)requires (sizeof...(Allocs) == D - 1)
+                : DVector(std::allocator_arg, Allocator(), alloc, next_allocs...) {}
+
+        /***
+         * @brief Constructor with a single allocation size for all dimensions,
+         *        obtaining the memory of every sub-vector from a given allocator
+         * @param allocator Allocator used by DVector and all of its sub-vectors
+         * @param alloc Number of elements allocated for each dimension
+         */
+        DVector(std::allocator_arg_t, const Allocator &allocator, std::size_t alloc)
+                : detail::NestedVector<D, T, Allocator>(allocator) {
+            shape_type shape{};
+            shape.fill(alloc);
+            detail::buildRectangular(*this, shape.data(), detail::valueInitialized);
+        }
+
+        /***
+         * @brief Constructor to specify a different allocation for each dimension,
+         *        obtaining the memory of every sub-vector from a given allocator
+         * @param allocator Allocator used by DVector and all of its sub-vectors
+         * @param alloc Number of elements to allocate to the first (i.e. left most) dimension
+         * @param next_allocs  Parameter pack for allocation of subsequent dimensions
+         */
+        template<std::integral Alloc, std::integral... Allocs>
+        DVector(std::allocator_arg_t, const Allocator &allocator, Alloc alloc, Allocs... next_allocs)
+        requires (sizeof...(Allocs) == D - 1) : detail::NestedVector<D, T, Allocator>(allocator) {
+            const shape_type shape{static_cast<std::size_t>(alloc), static_cast<std::size_t>(next_allocs)...};
+            detail::buildRectangular(*this, shape.data(), detail::valueInitialized);
+        }
+
+        /***
+         * @brief Constructor of a rectangular DVector holding copies of the same value,
+         *        allocating each sub-vector exactly once
+         * @param shape Number of elements of each dimension
+         * @param value Value copied into every element
+         * @param allocator Allocator used by DVector and all of its sub-vectors
+         */
+        DVector(const shape_type &shape, const T &value, const Allocator &allocator = Allocator())
+                : detail::NestedVector<D, T, Allocator>(allocator) {
+            detail::buildRectangular(*this, shape.data(), [&value](auto &row, std::size_t extent, auto...) {
+                row.assign(extent, value);
+            });
+        }
+
+        /***
+         * @brief Constructor of a rectangular DVector whose elements are meant to be overwritten,
+         *        allocating each sub-vector exactly once.
+         *        Elements are constructed by Allocator without arguments, hence left uninitialized by
+         *        mdc::DefaultInitAllocator, while std::allocator<T> value-initializes (i.e. zeroes) them.
+         * @param shape Number of elements of each dimension
+         * @param allocator Allocator used by DVector and all of its sub-vectors
+         * @see mdc::DefaultInitAllocator
+         */
+        DVector(for_overwrite_t, const shape_type &shape, const Allocator &allocator = Allocator())
+        requires std::is_trivially_default_constructible_v<T> : detail::NestedVector<D, T, Allocator>(allocator) {
+            detail::buildRectangular(*this, shape.data(), detail::valueInitialized);
+        }
+
+        /***
+         * @brief Constructor of a rectangular DVector whose elements are computed from their indices,
+         *        allocating each sub-vector exactly once
+         * @param shape Number of elements of each dimension
+         * @param generator Function called with the D indices of each element, in row-major order,
+         *                  returning its value
+         * @param allocator Allocator used by DVector and all of its sub-vectors
+         */
+        template<typename Fn>
+        DVector(const shape_type &shape, Fn generator, const Allocator &allocator = Allocator())
+        requires detail::Generator<Fn, T, D> : detail::NestedVector<D, T, Allocator>(allocator) {
+            auto leaf = [&generator](auto &row, std::size_t extent, auto... indices) {
+                row.reserve(extent);
+                for (std::size_t i = 0; i < extent; ++i)
+                    row.emplace_back(generator(indices..., i));
+            };
+            detail::buildRectangular(*this, shape.data(), leaf);
+        }
 
         /***
          * @brief Get a reference to a specific element held by DVector, specifying its position.
@@ -85,7 +387,7 @@ namespace mdc {
          *          will be deleted before assigning the new one
          */
         template<std::integral Idx, std::integral... Indices>
-        DVector<D - sizeof...(Indices) - 1, T> &
+        DVector<D - sizeof...(Indices) - 1, T, Allocator> &
         at(Idx index, Indices... indices)requires (sizeof...(Indices) < D - 1) && (sizeof...(Indices) > 0) {
             return this->at(index).at(indices...);
         }
@@ -95,12 +397,45 @@ namespace mdc {
          * @return Constant reference to the requested sub-vector
          */
         template<std::integral Idx, std::integral... Indices>
-        const DVector<D - sizeof...(Indices) - 1, T> &
+        const DVector<D - sizeof...(Indices) - 1, T, Allocator> &
         at(Idx index, Indices... indices) const requires (sizeof...(Indices) < D - 1) &&
                                                                  (sizeof...(Indices) > 0) {
             return this->at(index).at(indices...);
         }
 
+        /***
+         * @brief Get a reference to a specific element (or sub-vector) held by DVector,
+         *        without throwing on invalid indices.
+         *        Indices are validated according to BoundsCheck::Default, i.e. only in debug builds by default.
+         * @param index Index of the higher (i.e. left-most) dimension
+         * @param indices Parameter pack of the indices for the lower dimensions
+         * @return Reference to the requested element, or sub-vector if fewer indices than dimensions are given
+         * @see BoundsCheck
+         */
+        template<std::integral Idx, std::integral... Indices>
+        constexpr decltype(auto)
+        operator()(Idx index, Indices... indices) noexcept requires (sizeof...(Indices) < D) {
+            mdc::BoundsCheck::Default::check(static_cast<std::size_t>(index), this->size());
+            if constexpr (sizeof...(Indices) == 0)
+                return (*this)[index];
+            else
+                return (*this)[index](indices...);
+        }
+
+        /***
+         * @see DVector<D,T>::operator()(Idx index, Indices... indices)
+         * @return Constant reference to the requested element, or sub-vector
+         */
+        template<std::integral Idx, std::integral... Indices>
+        constexpr decltype(auto)
+        operator()(Idx index, Indices... indices) const noexcept requires (sizeof...(Indices) < D) {
+            mdc::BoundsCheck::Default::check(static_cast<std::size_t>(index), this->size());
+            if constexpr (sizeof...(Indices) == 0)
+                return (*this)[index];
+            else
+                return (*this)[index](indices...);
+        }
+
         /***
          * @brief View specific intervals of the vector using Span objects for each dimension
          * @param span First Span object to dereference, corresponding to the higher dimension
@@ -110,87 +445,231 @@ namespace mdc {
          * @see SpanWrapper
          */
         template<typename J, typename... K>
-        DVector<D, T> at(J span, K... spans) const
+        DVector<D, T, Allocator> at(J span, K... spans) const
         requires (sizeof...(K) == D - 1)
                  && std::is_convertible_v<J, mdc::Spanning> && (std::is_convertible_v<K, mdc::Spanning> && ...) {
             std::size_t from = span.isAll ? 0 : span.from,
-                    to = span.isAll ? this->size() - 1 : span.to;
-            DVector<D, T> dVector(to - from + 1);
-            for (std::size_t i = from, j = 0; i <= to; ++i)
-                dVector.at(j++) = std::move(this->at(i).at(spans...));
+                    end = span.isAll ? this->size() : span.to + 1;
+            DVector<D, T, Allocator> dVector(this->get_allocator());
+            if (from >= end)
+                return dVector;
+            // reserve only the spanned sub-vectors, each one built directly with its final shape
+            dVector.reserve((end - from - 1) / span.step + 1);
+            for (std::size_t i = from; i < end; i += span.step)
+                dVector.push_back(this->at(i).at(spans...));
             return dVector;
         }
 
+        /***
+         * @brief View the whole DVector without copying its elements
+         * @return View over all elements of DVector
+         */
+        DVectorView<D, T, Allocator> view() noexcept {
+            return DVectorView<D, T, Allocator>(*this);
+        }
+
+        /***
+         * @see DVector<D,T>::view()
+         * @return Read-only view over all elements of DVector
+         */
+        DVectorView<D, const T, Allocator> view() const noexcept {
+            return DVectorView<D, const T, Allocator>(*this);
+        }
+
+        /***
+         * @brief View specific intervals of the vector using Span objects for each dimension,
+         *        without copying any element
+         * @param span Span object for the higher dimension, followed by a Span object for each lower dimension
+         * @return View over the elements represented by the given Span objects
+         * @see DVectorView<D,T>::at(J span, K... spans)
+         */
+        template<typename J, typename... K>
+        DVectorView<D, T, Allocator> view(J span, K... spans)
+        requires (sizeof...(K) == D - 1)
+                 && std::is_convertible_v<J, mdc::Spanning> && (std::is_convertible_v<K, mdc::Spanning> && ...) {
+            return view().at(span, spans...);
+        }
+
+        /***
+         * @see DVector<D,T>::view(J span, K... spans)
+         * @return Read-only view over the elements represented by the given Span objects
+         */
+        template<typename J, typename... K>
+        DVectorView<D, const T, Allocator> view(J span, K... spans) const
+        requires (sizeof...(K) == D - 1)
+                 && std::is_convertible_v<J, mdc::Spanning> && (std::is_convertible_v<K, mdc::Spanning> && ...) {
+            return view().at(span, spans...);
+        }
+
+        /***
+         * @return Iterator to the first element stored, visiting all elements of every sub-vector in row-major order
+         */
+        flat_iterator flat_begin() {
+            return {this->begin(), this->end()};
+        }
+
+        /***
+         * @see DVector<D,T>::flat_begin()
+         */
+        const_flat_iterator flat_begin() const {
+            return {this->begin(), this->end()};
+        }
+
+        /***
+         * @return Iterator past the last element stored
+         */
+        flat_iterator flat_end() {
+            return {this->end(), this->end()};
+        }
+
+        /***
+         * @see DVector<D,T>::flat_end()
+         */
+        const_flat_iterator flat_end() const {
+            return {this->end(), this->end()};
+        }
+
+        /***
+         * @return Range over all elements stored, in row-major order, skipping empty sub-vectors
+         */
+        std::ranges::subrange<flat_iterator> elements() {
+            return {flat_begin(), flat_end()};
+        }
+
+        /***
+         * @see DVector<D,T>::elements()
+         */
+        std::ranges::subrange<const_flat_iterator> elements() const {
+            return {flat_begin(), flat_end()};
+        }
+
         /***
          * @return Return total amount of elements stored
+         * @note Only sub-vectors are visited, adding up the sizes of the inner-most ones, never the elements
          */
         constexpr std::size_t total() const noexcept {
-            return std::accumulate(this->begin(), this->end(), 0,
-                                   [](auto sum, const auto &dVector) { return sum + dVector.total(); });
+            std::size_t count = 0;
+            for (const auto &dVector: *this)
+                count += dVector.total();
+            return count;
         }
-    };
 
-    /***
-     * @brief Print function for n-dimentional DVectors.
-     *        DVectors with an higher dimension than 2 will print their dimension and current allocation
-     *        for each dimension, while lower dimensions will resemble an handwritten matrix.
-     *        Format example:
-     * @code
-     * DVector<3>{
-     * |0.5, 0.51|
-     * |1.5, 1.51|
-     * |2.5, 2.51|,
-     *
-     * |3.5, 3.51|
-     * |3.55, 4.51|
-     * |5.5, 5.51|
-     * }
-     * @endcode
-     * @see operator<<(std::ostream &, const DVector<2,U> &)
-     * @see operator<<(std::ostream &, const DVector<1,U> &)
-     */
-    template<std::size_t D, typename T>
-    std::ostream &operator<<(std::ostream &os, const mdc::DVector<D, T> &dVector) {
-        auto size = dVector.size();
-        os << "DVector<" << D << ">{\n";
-        for (std::size_t i = 0; i < size; ++i) {
-            os << dVector.at(i);
-            if (i < size - 1)
-                os << ",\n\n";
-        }
-        return os << "\n}";
-    }
+        /***
+         * @brief Get the smallest shape holding every sub-vector, i.e. the largest size of each level.
+         *        For a rectangular DVector this is its actual shape.
+         *        Only sub-vectors are visited, never the elements.
+         * @return Largest size among the sub-vectors of each dimension
+         * @see DVector<D,T,Allocator>::is_rectangular()
+         */
+        shape_type shape() const noexcept {
+            shape_type shape{};
+            detail::boundingShape(*this, shape);
+            return shape;
+        }
 
-    /***
-     * @brief Print function for 2-dimentional DVectors.
-     *        Format example:
-     * @code
-     * |42.0, 10.5|
-     * |5.55, 11.2|
-     * |-9.0, 0.01|
-     * @endcode
-     */
-    template<typename T>
-    std::ostream &operator<<(std::ostream &os, const mdc::DVector<2, T> &dVector) {
-        auto size = dVector.size();
-        for (std::size_t i = 0; i < size; ++i) {
-            os << dVector.at(i);
-            if (i < size - 1)
-                os << '\n';
-        }
-        return os;
-    }
+        /***
+         * @param dim Dimension queried, where 0 is the higher (i.e. left-most) one
+         * @return Largest size among the sub-vectors of dimension dim, visiting only the levels above it
+         * @throws std::out_of_range If dim is not lower than D
+         */
+        std::size_t max_extent(std::size_t dim) const {
+            detail::checkDimension<D>(dim);
+            return detail::maxExtent(*this, dim);
+        }
+
+        /***
+         * @return true iff all sub-vectors of the same level have the same size, as for DTensor,
+         *         stopping at the first sub-vector of a different size
+         */
+        bool is_rectangular() const noexcept {
+            shape_type shape{};
+            detail::firstShape(*this, shape);
+            return detail::matchesShape(*this, shape);
+        }
+    };
 
 /***
  * @brief Template specialization of DVector with a single dimension
  * @tparam T Type of elements stored
+ * @tparam Allocator Allocator of T
  * @see DVector
  */
-    template<typename T>
-    class DVector<1, T> : public std::vector<T> {
+    template<typename T, typename Allocator>
+    class DVector<1, T, Allocator> : public std::vector<T, Allocator> {
     public:
-        using std::vector<T>::vector;
-        using std::vector<T>::at;
+        using std::vector<T, Allocator>::vector;
+        using std::vector<T, Allocator>::at;
+
+        using shape_type = std::array<std::size_t, 1>;
+        using flat_iterator = detail::FlatIterator<1, T, false, Allocator>;
+        using const_flat_iterator = detail::FlatIterator<1, T, true, Allocator>;
+
+        /***
+         * @brief Constructor allocating a given number of elements from a given allocator,
+         *        matching DVector<D,T,Allocator>::DVector(std::allocator_arg_t, const Allocator &, std::size_t)
+         * @param allocator Allocator used by DVector
+         * @param alloc Number of elements allocated
+         */
+        DVector(std::allocator_arg_t, const Allocator &allocator, std::size_t alloc)
+                : std::vector<T, Allocator>(alloc, allocator) {}
+
+        /***
+         * @brief Constructor holding copies of the same value, matching
+         *        DVector<D,T,Allocator>::DVector(const shape_type &, const T &, const Allocator &)
+         * @param shape Number of elements
+         * @param value Value copied into every element
+         * @param allocator Allocator used by DVector
+         */
+        DVector(const shape_type &shape, const T &value, const Allocator &allocator = Allocator())
+                : std::vector<T, Allocator>(shape[0], value, allocator) {}
+
+        /***
+         * @brief Constructor of elements meant to be overwritten
+         * @param shape Number of elements
+         * @param allocator Allocator used by DVector
+         * @see DVector<D,T,Allocator>::DVector(for_overwrite_t, const shape_type &, const Allocator &)
+         */
+        DVector(for_overwrite_t, const shape_type &shape, const Allocator &allocator = Allocator())
+        requires std::is_trivially_default_constructible_v<T> : std::vector<T, Allocator>(allocator) {
+            this->resize(shape[0]);
+        }
+
+        /***
+         * @brief Constructor of elements computed from their index
+         * @param shape Number of elements
+         * @param generator Function called with the index of each element, in order, returning its value
+         * @param allocator Allocator used by DVector
+         */
+        template<typename Fn>
+        DVector(const shape_type &shape, Fn generator, const Allocator &allocator = Allocator())
+        requires detail::Generator<Fn, T, 1> : std::vector<T, Allocator>(allocator) {
+            this->reserve(shape[0]);
+            for (std::size_t i = 0; i < shape[0]; ++i)
+                this->emplace_back(generator(i));
+        }
+
+        /***
+         * @brief Get a reference to a specific element held by DVector, without throwing on an invalid index.
+         *        The index is validated according to BoundsCheck::Default, i.e. only in debug builds by default.
+         * @param index Position of the element
+         * @return Reference to the requested element
+         * @see BoundsCheck
+         */
+        template<std::integral Idx>
+        constexpr T &operator()(Idx index) noexcept {
+            mdc::BoundsCheck::Default::check(static_cast<std::size_t>(index), this->size());
+            return (*this)[index];
+        }
+
+        /***
+         * @see DVector<1,T>::operator()(Idx index)
+         * @return Constant reference to the requested element
+         */
+        template<std::integral Idx>
+        constexpr const T &operator()(Idx index) const noexcept {
+            mdc::BoundsCheck::Default::check(static_cast<std::size_t>(index), this->size());
+            return (*this)[index];
+        }
 
         /***
          * @brief View a sub-vector corresponding to a given interval
@@ -199,13 +678,100 @@ namespace mdc {
          * @see Span
          * @see SpanWrapper
          */
-        DVector<1, T> at(mdc::Spanning span) const {
+        DVector<1, T, Allocator> at(mdc::Spanning span) const {
             if (span.isAll)
-                return *this;
-            if (span.from >= this->size())
-                return {};
+                return DVector<1, T, Allocator>(*this, this->get_allocator());
+            if (span.from >= this->size() || span.to < span.from)
+                return DVector<1, T, Allocator>(this->get_allocator());
             auto to = span.to >= this->size() ? this->size() - 1 : span.to;
-            return {this->begin() + span.from, this->end() - this->size() + to + 1};
+            if (span.step == 1)
+                return DVector<1, T, Allocator>(this->begin() + span.from, this->begin() + to + 1,
+                                                this->get_allocator());
+            DVector<1, T, Allocator> dVector(this->get_allocator());
+            dVector.reserve((to - span.from) / span.step + 1);
+            for (auto i = span.from; i <= to; i += span.step)
+                dVector.push_back((*this)[i]);
+            return dVector;
+        }
+
+        /***
+         * @brief View the whole DVector without copying its elements
+         * @return View over all elements of DVector
+         */
+        DVectorView<1, T, Allocator> view() noexcept {
+            return DVectorView<1, T, Allocator>(*this);
+        }
+
+        /***
+         * @see DVector<D,T>::view()
+         * @return Read-only view over all elements of DVector
+         */
+        DVectorView<1, const T, Allocator> view() const noexcept {
+            return DVectorView<1, const T, Allocator>(*this);
+        }
+
+        /***
+         * @brief View a sub-vector corresponding to a given interval, without copying any element
+         * @param span Span object describing an interval of elements
+         * @return View over the elements represented by the given Span objects
+         * @see DVectorView<D,T>::at(J span, K... spans)
+         */
+        template<typename J>
+        DVectorView<1, T, Allocator> view(J span)
+        requires std::is_convertible_v<J, mdc::Spanning> {
+            return view().at(span);
+        }
+
+        /***
+         * @see DVector<D,T>::view(J span)
+         * @return Read-only view over the elements represented by the given Span objects
+         */
+        template<typename J>
+        DVectorView<1, const T, Allocator> view(J span) const
+        requires std::is_convertible_v<J, mdc::Spanning> {
+            return view().at(span);
+        }
+
+        /***
+         * @return Iterator to the first element stored
+         */
+        flat_iterator flat_begin() noexcept {
+            return this->begin();
+        }
+
+        /***
+         * @see DVector<1,T>::flat_begin()
+         */
+        const_flat_iterator flat_begin() const noexcept {
+            return this->begin();
+        }
+
+        /***
+         * @return Iterator past the last element stored
+         */
+        flat_iterator flat_end() noexcept {
+            return this->end();
+        }
+
+        /***
+         * @see DVector<1,T>::flat_end()
+         */
+        const_flat_iterator flat_end() const noexcept {
+            return this->end();
+        }
+
+        /***
+         * @return Contiguous range over all elements stored
+         */
+        std::span<T> elements() noexcept {
+            return {this->data(), this->size()};
+        }
+
+        /***
+         * @see DVector<1,T>::elements()
+         */
+        std::span<const T> elements() const noexcept {
+            return {this->data(), this->size()};
         }
 
         /***
@@ -214,25 +780,123 @@ namespace mdc {
         constexpr std::size_t total() const noexcept {
             return this->size();
         }
+
+        /***
+         * @return Number of elements held by DVector, as a shape
+         */
+        constexpr shape_type shape() const noexcept {
+            return {this->size()};
+        }
+
+        /***
+         * @param dim Dimension queried, which must be 0
+         * @return Number of elements held by DVector
+         * @throws std::out_of_range If dim is not 0
+         */
+        std::size_t max_extent(std::size_t dim) const {
+            detail::checkDimension<1>(dim);
+            return this->size();
+        }
+
+        /***
+         * @return true, since a DVector with a single dimension is always rectangular
+         */
+        constexpr bool is_rectangular() const noexcept {
+            return true;
+        }
     };
 
     /***
-     * @brief Print function for 1-dimentional vectors.
+     * @brief Write a DVector through a Formatter, one row for the last dimension, one matrix for the last two,
+     *        and one block for each higher dimension
+     * @see Formatter
+     */
+    template<std::size_t D, typename T, typename Allocator>
+    Formatter &operator<<(Formatter &formatter, const mdc::DVector<D, T, Allocator> &dVector) {
+        if constexpr (D == 1)
+            return formatter.row(dVector.size(), [&dVector](std::size_t i) -> decltype(auto) { return dVector[i]; });
+        else if constexpr (D == 2)
+            return formatter.matrix(dVector.size(), [&](std::size_t i) { formatter << dVector[i]; });
+        else
+            return formatter.block("DVector", {D}, dVector.size(), [&](std::size_t i) { formatter << dVector[i]; });
+    }
+
+    /***
+     * @brief Print function for DVectors, through a buffered Formatter.
+     *        DVectors with an higher dimension than 2 will print their dimension and current allocation
+     *        for each dimension, while lower dimensions will resemble an handwritten matrix.
      *        Format example:
      * @code
-     * |0.0, 3.0, 4.3|
+     * DVector<3>{
+     * |0.5, 0.51|
+     * |1.5, 1.51|
+     * |2.5, 2.51|,
+     *
+     * |3.5, 3.51|
+     * |3.55, 4.51|
+     * |5.5, 5.51|
+     * }
      * @endcode
+     *        Floating points follow the precision and notation (std::fixed, std::scientific) set on the stream.
      */
-    template<typename T>
-    std::ostream &operator<<(std::ostream &os, const mdc::DVector<1, T> &dVector) {
-        auto size = dVector.size();
-        os << '|';
-        for (std::size_t i = 0; i < size; ++i) {
-            os << dVector.at(i);
-            if (i < size - 1)
-                os << ", ";
-        }
-        return os << '|';
+    template<std::size_t D, typename T, typename Allocator>
+    std::ostream &operator<<(std::ostream &os, const mdc::DVector<D, T, Allocator> &dVector) {
+        return detail::print(os, dVector);
+    }
+
+/***
+ * @brief Allocator adaptor constructing elements by default-initialization, instead of value-initialization,
+ *        when no argument is given, hence leaving trivial types (e.g. double) uninitialized on resize.
+ *        All other operations are forwarded to the adapted allocator.
+ * @tparam T Type of the elements allocated
+ * @tparam Allocator Allocator adapted
+ * @see DVector<D,T,Allocator>::DVector(for_overwrite_t, const shape_type &, const Allocator &)
+ */
+    template<typename T, typename Allocator = std::allocator<T>>
+    class DefaultInitAllocator : public Allocator {
+    private:
+        using Traits = std::allocator_traits<Allocator>;
+
+    public:
+        template<typename U>
+        struct rebind {
+            using other = DefaultInitAllocator<U, typename Traits::template rebind_alloc<U>>;
+        };
+
+        using Allocator::Allocator;
+
+        DefaultInitAllocator() = default;
+
+        /***
+         * @brief Convert an adaptor of another element type, as required when rebinding
+         */
+        template<typename U, typename A>
+        DefaultInitAllocator(const DefaultInitAllocator<U, A> &other) noexcept
+                : Allocator(static_cast<const A &>(other)) {}
+
+        template<typename U>
+        void construct(U *pointer) noexcept(std::is_nothrow_default_constructible_v<U>) {
+            ::new(static_cast<void *>(pointer)) U;
+        }
+
+        template<typename U, typename... Args>
+        void construct(U *pointer, Args &&... args) {
+            Traits::construct(static_cast<Allocator &>(*this), pointer, std::forward<Args>(args)...);
+        }
+    };
+
+    namespace pmr {
+
+        /***
+         * @brief DVector obtaining the memory of all of its sub-vectors from a std::pmr::memory_resource,
+         *        such as mdc::pmr::Arena
+         * @tparam D Vector dimension
+         * @tparam T Type of the elements stored
+         * @see mdc::pmr::Arena
+         */
+        template<std::size_t D, typename T>
+        using DVector = mdc::DVector<D, T, std::pmr::polymorphic_allocator<T>>;
+
     }
 
 }
@@ -0,0 +1,804 @@
+/*
+ *   Copyright 2022 Alberto Guarnieri
+ *
+ *   Licensed under the Apache License, Version 2.0 (the "License");
+ *   you may not use this file except in compliance with the License.
+ *   You may obtain a copy of the License at
+ *
+ *       http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *   Unless required by applicable law or agreed to in writing, software
+ *   distributed under the License is distributed on an "AS IS" BASIS,
+ *   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *   See the License for the specific language governing permissions and
+ *   limitations under the License.
+ */
+
+#ifndef DCONTAINERS_DVIEW_HPP
+#define DCONTAINERS_DVIEW_HPP
+
+
+#include <algorithm>
+#include <array>
+#include <compare>
+#include <concepts>
+#include <cstddef>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+#include "DContainers/BoundsCheck.hpp"
+#include "DContainers/Span/Spanning.hpp"
+
+
+namespace mdc {
+
+    template<std::size_t D, typename T, typename Allocator = std::allocator<T>>
+    class DVector;
+
+    template<std::size_t D, typename T>
+    class DTensor;
+
+    namespace detail {
+
+        /***
+         * @brief Compute strides of a row-major layout, i.e. where the right-most index is contiguous
+         * @param shape Extent of each dimension
+         * @return Distance, in elements, between two consecutive indices of each dimension
+         */
+        template<std::size_t D>
+        constexpr std::array<std::size_t, D> rowMajorStrides(const std::array<std::size_t, D> &shape) noexcept {
+            std::array<std::size_t, D> strides{};
+            std::size_t stride = 1;
+            for (std::size_t d = D; d-- > 0;) {
+                strides[d] = stride;
+                stride *= shape[d];
+            }
+            return strides;
+        }
+
+        /***
+         * @brief Drop the first K values of an array
+         */
+        template<std::size_t K, typename V, std::size_t D>
+        constexpr std::array<V, D - K> tail(const std::array<V, D> &values) noexcept {
+            std::array<V, D - K> result{};
+            std::copy(values.begin() + K, values.end(), result.begin());
+            return result;
+        }
+
+        template<typename Fn, typename T, std::size_t... I>
+        constexpr bool generates(std::index_sequence<I...>) noexcept {
+            if constexpr (std::is_invocable_v<Fn &, decltype(I)...>)
+                return std::is_convertible_v<std::invoke_result_t<Fn &, decltype(I)...>, T>;
+            else
+                return false;
+        }
+
+        /***
+         * @brief Function computing an element of type T from D indices
+         */
+        template<typename Fn, typename T, std::size_t D>
+        concept Generator = generates<Fn, T>(std::make_index_sequence<D>{});
+
+        /***
+         * @brief Copy a strided region of D dimensions into another strided region with the same extents
+         */
+        template<std::size_t D, typename T, typename U>
+        constexpr void copyStrided(const T *source, const std::size_t *sourceStrides, U *destination,
+                                   const std::size_t *destinationStrides, const std::size_t *extents) {
+            if constexpr (D == 1) {
+                if (sourceStrides[0] == 1 && destinationStrides[0] == 1)
+                    std::copy_n(source, extents[0], destination);
+                else
+                    for (std::size_t i = 0; i < extents[0]; ++i)
+                        destination[i * destinationStrides[0]] = source[i * sourceStrides[0]];
+            } else {
+                for (std::size_t i = 0; i < extents[0]; ++i)
+                    copyStrided<D - 1>(source + i * sourceStrides[0], sourceStrides + 1,
+                                       destination + i * destinationStrides[0], destinationStrides + 1, extents + 1);
+            }
+        }
+
+        /***
+         * @brief Copy a strided region whose two last dimensions are contiguous in the destination and in the
+         *        source respectively, in square blocks, so that both sides are accessed within a few cache lines
+         */
+        template<std::size_t D, typename T, typename U>
+        void copyTiles(const T *source, const std::size_t *sourceStrides, U *destination,
+                       const std::size_t *destinationStrides, const std::size_t *extents) {
+            if constexpr (D == 2) {
+                constexpr std::size_t block = std::max<std::size_t>(8, 256 / sizeof(U));
+                for (std::size_t ib = 0; ib < extents[0]; ib += block) {
+                    const std::size_t iEnd = std::min(ib + block, extents[0]);
+                    for (std::size_t jb = 0; jb < extents[1]; jb += block) {
+                        const std::size_t jEnd = std::min(jb + block, extents[1]);
+                        for (std::size_t i = ib; i < iEnd; ++i)
+                            for (std::size_t j = jb; j < jEnd; ++j)
+                                destination[i * destinationStrides[0] + j * destinationStrides[1]] =
+                                        source[i * sourceStrides[0] + j * sourceStrides[1]];
+                    }
+                }
+            } else {
+                for (std::size_t i = 0; i < extents[0]; ++i)
+                    copyTiles<D - 1>(source + i * sourceStrides[0], sourceStrides + 1,
+                                     destination + i * destinationStrides[0], destinationStrides + 1, extents + 1);
+            }
+        }
+
+        /***
+         * @brief Copy a strided region of D dimensions into another strided region with the same extents.
+         *        When the dimension with the smallest stride differs between source and destination,
+         *        as when copying a transposed view, the copy proceeds in blocks over those two dimensions.
+         */
+        template<std::size_t D, typename T, typename U>
+        void copyBlocked(const T *source, const std::array<std::size_t, D> &sourceStrides, U *destination,
+                         const std::array<std::size_t, D> &destinationStrides,
+                         const std::array<std::size_t, D> &extents) {
+            auto innermost = [&extents](const std::array<std::size_t, D> &strides) {
+                std::size_t inner = D;
+                for (std::size_t d = 0; d < D; ++d)
+                    if (extents[d] > 1 && (inner == D || strides[d] < strides[inner]))
+                        inner = d;
+                return inner;
+            };
+            const std::size_t read = innermost(sourceStrides), write = innermost(destinationStrides);
+            if constexpr (D > 1) {
+                if (read != write && read < D && write < D) {
+                    // move the two contiguous dimensions last, which does not change the elements copied
+                    std::array<std::size_t, D> order{};
+                    std::size_t next = 0;
+                    for (std::size_t d = 0; d < D; ++d)
+                        if (d != read && d != write)
+                            order[next++] = d;
+                    order[D - 2] = read;
+                    order[D - 1] = write;
+                    std::array<std::size_t, D> ss{}, ds{}, ex{};
+                    for (std::size_t d = 0; d < D; ++d) {
+                        ss[d] = sourceStrides[order[d]];
+                        ds[d] = destinationStrides[order[d]];
+                        ex[d] = extents[order[d]];
+                    }
+                    copyTiles<D>(source, ss.data(), destination, ds.data(), ex.data());
+                    return;
+                }
+            }
+            copyStrided<D>(source, sourceStrides.data(), destination, destinationStrides.data(), extents.data());
+        }
+
+        /***
+         * @return true iff axes holds each dimension lower than D exactly once
+         */
+        template<std::size_t D>
+        constexpr bool isPermutation(const std::array<std::size_t, D> &axes) noexcept {
+            std::array<bool, D> seen{};
+            for (auto axis: axes) {
+                if (axis >= D || seen[axis])
+                    return false;
+                seen[axis] = true;
+            }
+            return true;
+        }
+
+        /***
+         * @brief Random access iterator over the outer-most dimension of a view,
+         *        dereferencing to a sub-view (or to an element, for views of a single dimension)
+         * @tparam View Type of the view iterated
+         */
+        template<typename View>
+        class ViewIterator {
+        private:
+            View _view;
+            std::ptrdiff_t _index;
+
+        public:
+            using reference = decltype(std::declval<const View &>().row(0));
+            using value_type = std::remove_cvref_t<reference>;
+            using difference_type = std::ptrdiff_t;
+            using iterator_concept = std::random_access_iterator_tag;
+            using iterator_category = std::conditional_t<std::is_lvalue_reference_v<reference>,
+                    std::random_access_iterator_tag, std::input_iterator_tag>;
+
+            constexpr ViewIterator() : _view(), _index(0) {}
+
+            constexpr ViewIterator(const View &view, std::ptrdiff_t index) : _view(view), _index(index) {}
+
+            constexpr reference operator*() const {
+                return _view.row(static_cast<std::size_t>(_index));
+            }
+
+            constexpr reference operator[](difference_type n) const {
+                return _view.row(static_cast<std::size_t>(_index + n));
+            }
+
+            constexpr ViewIterator &operator++() {
+                ++_index;
+                return *this;
+            }
+
+            constexpr ViewIterator operator++(int) {
+                auto copy = *this;
+                ++_index;
+                return copy;
+            }
+
+            constexpr ViewIterator &operator--() {
+                --_index;
+                return *this;
+            }
+
+            constexpr ViewIterator operator--(int) {
+                auto copy = *this;
+                --_index;
+                return copy;
+            }
+
+            constexpr ViewIterator &operator+=(difference_type n) {
+                _index += n;
+                return *this;
+            }
+
+            constexpr ViewIterator &operator-=(difference_type n) {
+                _index -= n;
+                return *this;
+            }
+
+            friend constexpr ViewIterator operator+(ViewIterator it, difference_type n) {
+                return it += n;
+            }
+
+            friend constexpr ViewIterator operator+(difference_type n, ViewIterator it) {
+                return it += n;
+            }
+
+            friend constexpr ViewIterator operator-(ViewIterator it, difference_type n) {
+                return it -= n;
+            }
+
+            friend constexpr difference_type operator-(const ViewIterator &lhs, const ViewIterator &rhs) {
+                return lhs._index - rhs._index;
+            }
+
+            friend constexpr bool operator==(const ViewIterator &lhs, const ViewIterator &rhs) {
+                return lhs._index == rhs._index;
+            }
+
+            friend constexpr std::strong_ordering operator<=>(const ViewIterator &lhs, const ViewIterator &rhs) {
+                return lhs._index <=> rhs._index;
+            }
+        };
+
+        inline void checkViewIndex(std::size_t dim, std::size_t index, std::size_t extent) {
+            if (index >= extent)
+                throw std::out_of_range(
+                        "view::at: index " + std::to_string(index) + " of dimension " + std::to_string(dim) +
+                        " is out of range (extent=" + std::to_string(extent) + ")");
+        }
+
+    }
+
+/***
+ * @brief Non-owning view over elements laid out with a constant stride for each dimension,
+ *        such as the contiguous storage of DArray and DTensor.
+ *        Elements are never copied, so writing through a view modifies the viewed container.
+ * @tparam D View dimension
+ * @tparam T Type of the elements viewed, const-qualified for read-only views
+ * @warning A view does not extend the lifetime of the container it refers to
+ */
+    template<std::size_t D, typename T>
+    class DView {
+        static_assert(D > 0, "DView must have at least one dimension");
+
+    public:
+        using value_type = std::remove_cv_t<T>;
+        using shape_type = std::array<std::size_t, D>;
+        using iterator = detail::ViewIterator<DView>;
+
+    private:
+        T *_data;
+        shape_type _shape;
+        shape_type _strides;
+
+        constexpr decltype(auto) row(std::size_t index) const {
+            if constexpr (D == 1)
+                return _data[index * _strides[0]];
+            else
+                return DView<D - 1, T>(_data + index * _strides[0], detail::tail<1>(_shape),
+                                       detail::tail<1>(_strides));
+        }
+
+        friend class detail::ViewIterator<DView>;
+
+    public:
+        /***
+         * @brief Construct an empty view, not referring to any element
+         */
+        constexpr DView() noexcept : _data(nullptr), _shape{}, _strides{} {}
+
+        /***
+         * @brief Construct a view over strided elements
+         * @param data Pointer to the first element viewed
+         * @param shape Extent of each dimension, starting from the higher (i.e. left-most) one
+         * @param strides Distance, in elements, between two consecutive indices of each dimension
+         */
+        constexpr DView(T *data, const shape_type &shape, const shape_type &strides) noexcept
+                : _data(data), _shape(shape), _strides(strides) {}
+
+        /***
+         * @brief Construct a view over contiguous elements laid out in row-major order
+         * @param data Pointer to the first element viewed
+         * @param shape Extent of each dimension, starting from the higher (i.e. left-most) one
+         */
+        constexpr DView(T *data, const shape_type &shape) noexcept
+                : _data(data), _shape(shape), _strides(detail::rowMajorStrides(shape)) {}
+
+        /***
+         * @brief Convert a view into a read-only view of the same elements
+         */
+        template<typename U>
+        constexpr DView(const DView<D, U> &other) noexcept requires (std::is_same_v<const U, T> &&
+                                                                     !std::is_same_v<U, T>)
+                : _data(other.data()), _shape(other.shape()), _strides(other.strides()) {}
+
+        /***
+         * @brief Get a reference to a specific element viewed, specifying its position.
+         * @param index Index of the higher (i.e. left-most) dimension
+         * @param indices Parameter pack of the indices for the lower dimensions of the element
+         * @return Reference to the requested element, inside the viewed container
+         * @throws std::out_of_range If any index is not lower than the extent of its dimension
+         */
+        template<std::integral Idx, std::integral... Indices>
+        constexpr T &at(Idx index, Indices... indices) const requires (sizeof...(Indices) == D - 1) {
+            const shape_type position{static_cast<std::size_t>(index), static_cast<std::size_t>(indices)...};
+            std::size_t offset = 0;
+            for (std::size_t d = 0; d < D; ++d) {
+                detail::checkViewIndex(d, position[d], _shape[d]);
+                offset += position[d] * _strides[d];
+            }
+            return _data[offset];
+        }
+
+        /***
+         * @brief Get a reference to a specific element viewed, without throwing on invalid indices.
+         *        Indices are validated according to BoundsCheck::Default, i.e. only in debug builds by default.
+         * @param index Index of the higher (i.e. left-most) dimension
+         * @param indices Parameter pack of the indices for the lower dimensions of the element
+         * @return Reference to the requested element, inside the viewed container
+         * @see BoundsCheck
+         */
+        template<std::integral Idx, std::integral... Indices>
+        constexpr T &operator()(Idx index, Indices... indices) const noexcept requires (sizeof...(Indices) == D - 1) {
+            const shape_type position{static_cast<std::size_t>(index), static_cast<std::size_t>(indices)...};
+            std::size_t offset = 0;
+            for (std::size_t d = 0; d < D; ++d) {
+                mdc::BoundsCheck::Default::check(position[d], _shape[d]);
+                offset += position[d] * _strides[d];
+            }
+            return _data[offset];
+        }
+
+        /***
+         * @brief Get a view of the sub-container at a given position
+         * @param index Index of the higher (i.e. left-most) dimension
+         * @param indices Parameter pack of the indices for the lower dimensions of the sub-container
+         * @return View of lower dimension over the requested sub-container
+         */
+        template<std::integral Idx, std::integral... Indices>
+        constexpr DView<D - sizeof...(Indices) - 1, T>
+        at(Idx index, Indices... indices) const requires (sizeof...(Indices) < D - 1) {
+            constexpr std::size_t K = sizeof...(Indices) + 1;
+            const std::array<std::size_t, K> position{static_cast<std::size_t>(index),
+                                                      static_cast<std::size_t>(indices)...};
+            std::size_t offset = 0;
+            for (std::size_t d = 0; d < K; ++d) {
+                detail::checkViewIndex(d, position[d], _shape[d]);
+                offset += position[d] * _strides[d];
+            }
+            return {_data + offset, detail::tail<K>(_shape), detail::tail<K>(_strides)};
+        }
+
+        /***
+         * @brief View specific intervals using Span objects for each dimension, without copying any element.
+         *        Intervals exceeding the extent of a dimension are truncated,
+         *        while strided intervals multiply the stride of their dimension.
+         * @param span First Span object, corresponding to the higher dimension
+         * @param spans Parameter pack of following Span objects
+         * @return View over the elements represented by the given Span objects
+         * @see Span
+         */
+        template<typename J, typename... K>
+        constexpr DView<D, T> at(J span, K... spans) const
+        requires (sizeof...(K) == D - 1)
+                 && std::is_convertible_v<J, mdc::Spanning> && (std::is_convertible_v<K, mdc::Spanning> && ...) {
+            const std::array<mdc::Spanning, D> spanning{static_cast<mdc::Spanning>(span),
+                                                        static_cast<mdc::Spanning>(spans)...};
+            shape_type extents{}, strides{};
+            std::size_t offset = 0;
+            for (std::size_t d = 0; d < D; ++d) {
+                const auto &s = spanning[d];
+                std::size_t from = s.isAll ? 0 : s.from,
+                        to = s.isAll || s.to >= _shape[d] ? _shape[d] : s.to + 1;
+                extents[d] = from < to ? (to - from - 1) / s.step + 1 : 0;
+                strides[d] = _strides[d] * s.step;
+                if (extents[d] > 0)
+                    offset += from * _strides[d];
+            }
+            return {_data + offset, extents, strides};
+        }
+
+        /***
+         * @brief Reorder the dimensions of the view, without copying any element
+         * @param axes Dimension of this view placed at each position, e.g. {2, 0, 1} moves the last dimension first
+         * @return View where the element at (i_0, ..., i_D-1) is the one of this view with index i_d for axes[d]
+         * @throws std::invalid_argument If axes is not a permutation of the dimensions
+         */
+        constexpr DView permute(const shape_type &axes) const {
+            if (!detail::isPermutation(axes))
+                throw std::invalid_argument("DView::permute: axes are not a permutation of the dimensions");
+            shape_type extents{}, strides{};
+            for (std::size_t d = 0; d < D; ++d) {
+                extents[d] = _shape[axes[d]];
+                strides[d] = _strides[axes[d]];
+            }
+            return {_data, extents, strides};
+        }
+
+        /***
+         * @see DView<D,T>::permute(const shape_type &axes)
+         * @tparam P Dimension of this view placed at each position, checked at compile time
+         */
+        template<std::size_t... P>
+        constexpr DView permute() const requires (sizeof...(P) == D) && (detail::isPermutation<D>({P...})) {
+            return permute({P...});
+        }
+
+        /***
+         * @brief Reverse the order of dimensions, without copying any element; a matrix view becomes its transpose
+         * @return View where the element at (i_0, ..., i_D-1) is the one of this view at (i_D-1, ..., i_0)
+         */
+        constexpr DView transpose() const noexcept {
+            shape_type extents{}, strides{};
+            for (std::size_t d = 0; d < D; ++d) {
+                extents[d] = _shape[D - 1 - d];
+                strides[d] = _strides[D - 1 - d];
+            }
+            return {_data, extents, strides};
+        }
+
+        /***
+         * @return Iterator to the first sub-view (or element) of the outer-most dimension
+         */
+        constexpr iterator begin() const {
+            return {*this, 0};
+        }
+
+        /***
+         * @return Iterator past the last sub-view (or element) of the outer-most dimension
+         */
+        constexpr iterator end() const {
+            return {*this, static_cast<std::ptrdiff_t>(_shape[0])};
+        }
+
+        /***
+         * @return Number of elements of the outer-most dimension
+         */
+        constexpr std::size_t size() const noexcept {
+            return _shape[0];
+        }
+
+        /***
+         * @return Extent of each dimension, starting from the higher (i.e. left-most) one
+         */
+        constexpr const shape_type &shape() const noexcept {
+            return _shape;
+        }
+
+        /***
+         * @param dim Dimension queried, where 0 is the higher (i.e. left-most) one
+         * @return Number of elements viewed along dimension dim
+         */
+        constexpr std::size_t extent(std::size_t dim) const {
+            return _shape.at(dim);
+        }
+
+        /***
+         * @return Distance, in elements, between two consecutive indices of each dimension
+         */
+        constexpr const shape_type &strides() const noexcept {
+            return _strides;
+        }
+
+        /***
+         * @return Pointer to the first element viewed
+         */
+        constexpr T *data() const noexcept {
+            return _data;
+        }
+
+        /***
+         * @return Total amount of elements viewed
+         */
+        constexpr std::size_t total() const noexcept {
+            std::size_t count = 1;
+            for (auto extent: _shape)
+                count *= extent;
+            return count;
+        }
+
+        /***
+         * @return true iff the view has no element, i.e. at least one dimension has extent zero
+         */
+        constexpr bool empty() const noexcept {
+            return total() == 0;
+        }
+
+        /***
+         * @return true iff elements viewed are laid out contiguously in row-major order
+         */
+        constexpr bool contiguous() const noexcept {
+            return empty() || _strides == detail::rowMajorStrides(_shape);
+        }
+
+        /***
+         * @brief Copy all elements viewed into a new, dense container.
+         *        Views whose contiguous dimension is not the last one, e.g. transposed views, are copied in
+         *        cache-sized blocks rather than element by element along the last dimension.
+         * @return DTensor holding copies of the elements viewed, with the same shape of the view
+         */
+        DTensor<D, value_type> materialize() const {
+            DTensor<D, value_type> dTensor(_shape);
+            if (!empty())
+                detail::copyBlocked<D>(_data, _strides, dTensor.data(), dTensor.strides(), _shape);
+            return dTensor;
+        }
+    };
+
+/***
+ * @brief Non-owning view over intervals of a (possibly jagged) DVector.
+ *        The view stores a pointer to the viewed DVector, plus an offset, an extent and a step for each dimension,
+ *        hence elements are never copied and writing through a view modifies the viewed DVector.
+ *        Extents are truncated independently for each sub-vector, following its actual size.
+ * @tparam D View dimension
+ * @tparam T Type of the elements viewed, const-qualified for read-only views
+ * @tparam Allocator Allocator of the viewed DVector
+ * @warning Views are invalidated by any operation that reallocates the viewed DVector or its sub-vectors
+ */
+    template<std::size_t D, typename T, typename Allocator = std::allocator<std::remove_cv_t<T>>>
+    class DVectorView {
+        static_assert(D > 0, "DVectorView must have at least one dimension");
+
+    public:
+        using value_type = std::remove_cv_t<T>;
+        using vector_type = std::conditional_t<std::is_const_v<T>,
+                const DVector<D, value_type, Allocator>, DVector<D, value_type, Allocator>>;
+        using shape_type = std::array<std::size_t, D>;
+        using iterator = detail::ViewIterator<DVectorView>;
+
+    private:
+        vector_type *_vector;
+        shape_type _offsets;
+        shape_type _extents;
+        shape_type _steps;
+
+        static constexpr shape_type filled(std::size_t value) noexcept {
+            shape_type values{};
+            values.fill(value);
+            return values;
+        }
+
+        decltype(auto) row(std::size_t index) const {
+            auto &element = (*_vector)[_offsets[0] + index * _steps[0]];
+            if constexpr (D == 1)
+                return (element);
+            else
+                return DVectorView<D - 1, T, Allocator>(element, detail::tail<1>(_offsets),
+                                                        detail::tail<1>(_extents), detail::tail<1>(_steps));
+        }
+
+        friend class detail::ViewIterator<DVectorView>;
+
+    public:
+        /***
+         * @brief Construct an empty view, not referring to any DVector
+         */
+        DVectorView() noexcept : _vector(nullptr), _offsets{}, _extents{}, _steps(filled(1)) {}
+
+        /***
+         * @brief Construct a view over a whole DVector
+         * @param dVector DVector viewed
+         */
+        explicit DVectorView(vector_type &dVector) noexcept
+                : _vector(&dVector), _offsets{},
+                  _extents(filled(std::numeric_limits<std::size_t>::max())), _steps(filled(1)) {}
+
+        /***
+         * @brief Construct a view over intervals of a DVector
+         * @param dVector DVector viewed
+         * @param offsets First index viewed for each dimension
+         * @param extents Maximum number of elements viewed for each dimension
+         * @param steps Distance between two consecutive indices viewed for each dimension
+         */
+        DVectorView(vector_type &dVector, const shape_type &offsets, const shape_type &extents,
+                    const shape_type &steps = filled(1)) noexcept
+                : _vector(&dVector), _offsets(offsets), _extents(extents), _steps(steps) {}
+
+        /***
+         * @brief Convert a view into a read-only view of the same elements
+         */
+        template<typename U>
+        DVectorView(const DVectorView<D, U, Allocator> &other) noexcept requires (std::is_same_v<const U, T> &&
+                                                                       !std::is_same_v<U, T>)
+                : _vector(other.vector()), _offsets(other.offsets()), _extents(other.extents()),
+                  _steps(other.steps()) {}
+
+        /***
+         * @brief Get a reference to a specific element viewed, specifying its position.
+         * @param index Index of the higher (i.e. left-most) dimension
+         * @param indices Parameter pack of the indices for the lower dimensions of the element
+         * @return Reference to the requested element, inside the viewed DVector
+         * @throws std::out_of_range If any index is outside the viewed interval of its sub-vector
+         */
+        template<std::integral Idx, std::integral... Indices>
+        T &at(Idx index, Indices... indices) const requires (sizeof...(Indices) == D - 1) {
+            detail::checkViewIndex(0, static_cast<std::size_t>(index), size());
+            if constexpr (sizeof...(Indices) == 0)
+                return row(static_cast<std::size_t>(index));
+            else
+                return row(static_cast<std::size_t>(index)).at(indices...);
+        }
+
+        /***
+         * @brief Get a reference to a specific element viewed, without throwing on invalid indices.
+         *        Indices are validated according to BoundsCheck::Default, i.e. only in debug builds by default.
+         * @param index Index of the higher (i.e. left-most) dimension
+         * @param indices Parameter pack of the indices for the lower dimensions of the element
+         * @return Reference to the requested element, inside the viewed DVector
+         * @see BoundsCheck
+         */
+        template<std::integral Idx, std::integral... Indices>
+        T &operator()(Idx index, Indices... indices) const noexcept requires (sizeof...(Indices) == D - 1) {
+            if constexpr (mdc::BoundsCheck::Default::enabled)
+                mdc::BoundsCheck::Default::check(static_cast<std::size_t>(index), size());
+            if constexpr (sizeof...(Indices) == 0)
+                return row(static_cast<std::size_t>(index));
+            else
+                return row(static_cast<std::size_t>(index))(indices...);
+        }
+
+        /***
+         * @brief Get a view of the sub-vector at a given position
+         * @param index Index of the higher (i.e. left-most) dimension
+         * @param indices Parameter pack of the indices for the lower dimensions of the sub-vector
+         * @return View of lower dimension over the requested sub-vector
+         */
+        template<std::integral Idx, std::integral... Indices>
+        DVectorView<D - sizeof...(Indices) - 1, T, Allocator>
+        at(Idx index, Indices... indices) const requires (sizeof...(Indices) < D - 1) {
+            detail::checkViewIndex(0, static_cast<std::size_t>(index), size());
+            if constexpr (sizeof...(Indices) == 0)
+                return row(static_cast<std::size_t>(index));
+            else
+                return row(static_cast<std::size_t>(index)).at(indices...);
+        }
+
+        /***
+         * @brief View specific intervals using Span objects for each dimension, without copying any element
+         * @param span First Span object, corresponding to the higher dimension
+         * @param spans Parameter pack of following Span objects
+         * @return View over the elements represented by the given Span objects
+         * @see Span
+         */
+        template<typename J, typename... K>
+        DVectorView<D, T, Allocator> at(J span, K... spans) const
+        requires (sizeof...(K) == D - 1)
+                 && std::is_convertible_v<J, mdc::Spanning> && (std::is_convertible_v<K, mdc::Spanning> && ...) {
+            const std::array<mdc::Spanning, D> spanning{static_cast<mdc::Spanning>(span),
+                                                        static_cast<mdc::Spanning>(spans)...};
+            shape_type offsets = _offsets, extents{}, steps{};
+            for (std::size_t d = 0; d < D; ++d) {
+                const auto &s = spanning[d];
+                std::size_t from = s.isAll ? 0 : s.from,
+                        count = s.isAll ? std::numeric_limits<std::size_t>::max() : s.size();
+                offsets[d] += from * _steps[d];
+                extents[d] = from >= _extents[d] ? 0 : std::min((_extents[d] - from - 1) / s.step + 1, count);
+                steps[d] = _steps[d] * s.step;
+            }
+            return {*_vector, offsets, extents, steps};
+        }
+
+        iterator begin() const {
+            return {*this, 0};
+        }
+
+        iterator end() const {
+            return {*this, static_cast<std::ptrdiff_t>(size())};
+        }
+
+        /***
+         * @return Number of sub-vectors (or elements) viewed in the outer-most dimension
+         */
+        std::size_t size() const noexcept {
+            if (_vector == nullptr || _offsets[0] >= _vector->size())
+                return 0;
+            return std::min(_extents[0], (_vector->size() - _offsets[0] - 1) / _steps[0] + 1);
+        }
+
+        /***
+         * @return true iff no sub-vector (or element) is viewed in the outer-most dimension
+         */
+        bool empty() const noexcept {
+            return size() == 0;
+        }
+
+        /***
+         * @return Total amount of elements viewed
+         */
+        std::size_t total() const noexcept {
+            if constexpr (D == 1) {
+                return size();
+            } else {
+                std::size_t count = 0;
+                for (auto subView: *this)
+                    count += subView.total();
+                return count;
+            }
+        }
+
+        /***
+         * @return Pointer to the DVector viewed
+         */
+        vector_type *vector() const noexcept {
+            return _vector;
+        }
+
+        /***
+         * @return First index viewed for each dimension
+         */
+        const shape_type &offsets() const noexcept {
+            return _offsets;
+        }
+
+        /***
+         * @return Maximum number of elements viewed for each dimension
+         */
+        const shape_type &extents() const noexcept {
+            return _extents;
+        }
+
+        /***
+         * @return Distance between two consecutive indices viewed for each dimension
+         */
+        const shape_type &steps() const noexcept {
+            return _steps;
+        }
+
+        /***
+         * @brief Copy all elements viewed into a new DVector
+         * @return DVector holding copies of the elements viewed, preserving the length of each sub-vector
+         */
+        DVector<D, value_type, Allocator> materialize() const {
+            using allocator_type = typename DVector<D, value_type, Allocator>::allocator_type;
+            // copies share the memory resource of the viewed DVector, if any
+            DVector<D, value_type, Allocator> dVector(_vector == nullptr ? allocator_type() : _vector->get_allocator());
+            dVector.reserve(size());
+            for (decltype(auto) element: *this) {
+                if constexpr (D == 1)
+                    dVector.push_back(element);
+                else
+                    dVector.push_back(element.materialize());
+            }
+            return dVector;
+        }
+    };
+
+}
+
+#include "DContainers/DVector.hpp"
+#include "DContainers/DTensor.hpp"
+
+
+#endif //DCONTAINERS_DVIEW_HPP
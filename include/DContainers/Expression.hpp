@@ -0,0 +1,482 @@
+/*
+ *   Copyright 2022 Alberto Guarnieri
+ *
+ *   Licensed under the Apache License, Version 2.0 (the "License");
+ *   you may not use this file except in compliance with the License.
+ *   You may obtain a copy of the License at
+ *
+ *       http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *   Unless required by applicable law or agreed to in writing, software
+ *   distributed under the License is distributed on an "AS IS" BASIS,
+ *   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *   See the License for the specific language governing permissions and
+ *   limitations under the License.
+ */
+
+
+#ifndef DCONTAINERS_EXPRESSION_HPP
+#define DCONTAINERS_EXPRESSION_HPP
+
+
+#include <cmath>
+#include <concepts>
+#include <cstddef>
+#include <functional>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+
+namespace mdc {
+
+    template<typename T, std::size_t N, std::size_t... O>
+    class DArray;
+
+    template<typename Op, typename... E>
+    class ArrayExpression;
+
+    namespace detail {
+
+        template<typename E>
+        struct IsDArray : std::false_type {};
+
+        template<typename T, std::size_t N, std::size_t... O>
+        struct IsDArray<DArray<T, N, O...>> : std::true_type {};
+
+        template<typename E>
+        struct IsArrayExpression : std::false_type {};
+
+        template<typename Op, typename... E>
+        struct IsArrayExpression<ArrayExpression<Op, E...>> : std::true_type {};
+
+        /***
+         * @brief Operand of an element-wise expression with a shape, i.e. a DArray or another expression
+         */
+        template<typename E>
+        concept ArrayOperand = IsDArray<std::remove_cvref_t<E>>::value
+                               || IsArrayExpression<std::remove_cvref_t<E>>::value;
+
+        /***
+         * @brief Operand of an element-wise expression broadcast to every element
+         */
+        template<typename E>
+        concept ScalarOperand = std::is_arithmetic_v<std::remove_cvref_t<E>>;
+
+        template<typename E>
+        concept ElementWiseOperand = ArrayOperand<E> || ScalarOperand<E>;
+
+        /***
+         * @brief Shape of scalar operands, compatible with any other shape
+         */
+        struct ScalarShape {};
+
+        /***
+         * @brief Common shape of two operands, void if they have different shapes
+         */
+        template<typename L, typename R>
+        struct CommonShape {
+            using type = std::conditional_t<std::is_same_v<L, R>, L, void>;
+        };
+
+        template<typename R>
+        struct CommonShape<ScalarShape, R> {
+            using type = R;
+        };
+
+        template<typename L>
+        struct CommonShape<L, ScalarShape> {
+            using type = L;
+        };
+
+        template<>
+        struct CommonShape<ScalarShape, ScalarShape> {
+            using type = ScalarShape;
+        };
+
+        template<typename S, typename... Shapes>
+        struct FoldShape {
+            using type = S;
+        };
+
+        template<typename S, typename Shape, typename... Shapes>
+        struct FoldShape<S, Shape, Shapes...> {
+            using type = typename FoldShape<typename CommonShape<S, Shape>::type, Shapes...>::type;
+        };
+
+        template<typename Shape, typename... Shapes>
+        struct FoldShape<void, Shape, Shapes...> {
+            using type = void;
+        };
+
+        template<typename E>
+        struct ShapeOf {
+            using type = ScalarShape;
+        };
+
+        template<typename T, std::size_t N, std::size_t... O>
+        struct ShapeOf<DArray<T, N, O...>> {
+            using type = std::index_sequence<N, O...>;
+        };
+
+        template<typename Op, typename... E>
+        struct ShapeOf<ArrayExpression<Op, E...>> {
+            using type = typename ArrayExpression<Op, E...>::shape;
+        };
+
+        /***
+         * @brief Operands with the same shape, ignoring scalars which are broadcast to any shape
+         */
+        template<typename... E>
+        concept SameShape = !std::is_void_v<typename FoldShape<ScalarShape,
+                typename ShapeOf<std::remove_cvref_t<E>>::type...>::type>;
+
+        /***
+         * @brief Operands of an element-wise expression, at least one of which has a shape
+         */
+        template<typename... E>
+        concept ElementWiseOperands = (ElementWiseOperand<E> && ...) && (ArrayOperand<E> || ...) && SameShape<E...>;
+
+        /***
+         * @brief Operands of an element-wise ordering operator. Two DArrays are excluded, hence they keep the
+         *        lexicographic ordering of std::array (e.g. as keys of std::map), see less() and its siblings
+         */
+        template<typename L, typename R>
+        concept OrderingOperands = ElementWiseOperands<L, R> &&
+                                   !(IsDArray<std::remove_cvref_t<L>>::value && IsDArray<std::remove_cvref_t<R>>::value);
+
+        /***
+         * @brief Element of a DArray at a given position in row-major order, reached through each sub-array
+         *        instead of a flat pointer, hence usable in constant expressions
+         */
+        template<typename T, std::size_t N, std::size_t... O>
+        constexpr T &flatAt(DArray<T, N, O...> &array, std::size_t index) noexcept {
+            if constexpr (sizeof...(O) == 0)
+                return array[index];
+            else
+                return flatAt(array[index / (O * ...)], index % (O * ...));
+        }
+
+        template<typename T, std::size_t N, std::size_t... O>
+        constexpr const T &flatAt(const DArray<T, N, O...> &array, std::size_t index) noexcept {
+            if constexpr (sizeof...(O) == 0)
+                return array[index];
+            else
+                return flatAt(array[index / (O * ...)], index % (O * ...));
+        }
+
+        /***
+         * @brief Leaf of an expression, referring to the elements of a DArray
+         */
+        template<typename A>
+        class ArrayTerminal;
+
+        template<typename T, std::size_t N, std::size_t... O>
+        class ArrayTerminal<DArray<T, N, O...>> {
+        private:
+            const DArray<T, N, O...> *_array;
+            // Flat pointer to the elements, unavailable in constant expressions
+            const T *_data;
+
+        public:
+            using value_type = T;
+            using shape = std::index_sequence<N, O...>;
+
+            constexpr explicit ArrayTerminal(const DArray<T, N, O...> &array) noexcept
+                    : _array(&array), _data(std::is_constant_evaluated() ? nullptr : array.flat_begin()) {}
+
+            constexpr const T &operator[](std::size_t index) const noexcept {
+                if (std::is_constant_evaluated())
+                    return flatAt(*_array, index);
+                return _data[index];
+            }
+        };
+
+        /***
+         * @brief Leaf of an expression, holding a single value broadcast to every element
+         */
+        template<typename T>
+        class ScalarTerminal {
+        private:
+            T _value;
+
+        public:
+            using value_type = T;
+            using shape = ScalarShape;
+
+            constexpr explicit ScalarTerminal(T value) noexcept : _value(value) {}
+
+            constexpr const T &operator[](std::size_t) const noexcept {
+                return _value;
+            }
+        };
+
+        /***
+         * @brief Wrap an operand into the node stored by an expression: DArrays are referred to, while scalars
+         *        and sub-expressions are copied
+         */
+        template<ElementWiseOperand E>
+        constexpr auto wrap(const E &operand) noexcept {
+            if constexpr (IsDArray<E>::value)
+                return ArrayTerminal<E>(operand);
+            else if constexpr (ScalarOperand<E>)
+                return ScalarTerminal<E>(operand);
+            else
+                return operand;
+        }
+
+        template<typename Op, typename... E>
+        constexpr auto makeExpression(Op op, const E &... operands) {
+            return ArrayExpression<Op, decltype(wrap(operands))...>(op, wrap(operands)...);
+        }
+
+        struct Fma {
+            template<typename A, typename B, typename C>
+            constexpr auto operator()(const A &a, const B &b, const C &c) const {
+                if constexpr (std::is_floating_point_v<std::common_type_t<A, B, C>>) {
+                    // std::fma is not usable in constant expressions
+                    if (std::is_constant_evaluated())
+                        return static_cast<decltype(std::fma(a, b, c))>(a * b + c);
+                    return std::fma(a, b, c);
+                } else {
+                    return a * b + c;
+                }
+            }
+        };
+
+        struct Abs {
+            template<typename A>
+            constexpr auto operator()(const A &a) const {
+                if constexpr (std::is_unsigned_v<A>)
+                    return a;
+                else
+                    return a < A(0) ? -a : a;
+            }
+        };
+
+        struct Where {
+            template<typename C, typename A, typename B>
+            constexpr std::common_type_t<A, B> operator()(const C &condition, const A &a, const B &b) const {
+                return condition ? a : b;
+            }
+        };
+
+        /***
+         * @brief Evaluate an expression into an array of the same shape, in a single pass over all elements
+         */
+        template<typename T, std::size_t N, std::size_t... O, typename Op, typename... E>
+        constexpr void evaluate(const ArrayExpression<Op, E...> &expression, DArray<T, N, O...> &array) {
+            static_assert(std::is_same_v<typename ArrayExpression<Op, E...>::shape, std::index_sequence<N, O...>>,
+                          "Expression must have the same shape of the DArray it is assigned to");
+            if (std::is_constant_evaluated()) {
+                for (std::size_t i = 0; i < (N * ... * O); ++i)
+                    flatAt(array, i) = static_cast<T>(expression[i]);
+                return;
+            }
+            T *first = array.flat_begin();
+            for (std::size_t i = 0; i < (N * ... * O); ++i)
+                first[i] = static_cast<T>(expression[i]);
+        }
+
+        template<typename T, std::size_t... S>
+        struct ArrayOfShape;
+
+        template<typename T, std::size_t N, std::size_t... O>
+        struct ArrayOfShape<T, N, O...> {
+            using type = DArray<T, N, O...>;
+        };
+
+        template<typename T, typename Shape>
+        struct ArrayOf;
+
+        template<typename T, std::size_t... S>
+        struct ArrayOf<T, std::index_sequence<S...>> {
+            using type = typename ArrayOfShape<T, S...>::type;
+        };
+
+    }
+
+/***
+ * @brief Lazy element-wise expression over DArrays and scalars, created by the arithmetic operators and functions
+ *        of DArray. No element is computed until the expression is assigned to a DArray, so that a compound
+ *        expression is evaluated in a single pass, without intermediate arrays.
+ *        Operands must have the same shape, checked at compile time, while scalars are broadcast to every element.
+ * @tparam Op Function object applied to the elements of each operand
+ * @tparam E Parameter pack of the operands
+ * @warning Expressions refer to the DArrays they were built from, hence they should be assigned before any of them
+ *          goes out of scope, and not stored with auto
+ */
+    template<typename Op, typename... E>
+    class ArrayExpression {
+    public:
+        using shape = typename detail::FoldShape<detail::ScalarShape, typename E::shape...>::type;
+        using value_type = std::remove_cvref_t<std::invoke_result_t<const Op &, typename E::value_type...>>;
+
+        static_assert(!std::is_void_v<shape>, "Operands of an element-wise expression must have the same shape");
+
+    private:
+        Op _op;
+        std::tuple<E...> _operands;
+
+    public:
+        constexpr ArrayExpression(Op op, const E &... operands) : _op(op), _operands(operands...) {}
+
+        /***
+         * @param index Position of the element, in row-major order
+         * @return Value of the element of the expression at the given position
+         */
+        constexpr value_type operator[](std::size_t index) const {
+            return std::apply([this, index](const auto &... operands) {
+                return static_cast<value_type>(_op(operands[index]...));
+            }, _operands);
+        }
+    };
+
+    /***
+     * @brief Evaluate an expression into a new DArray of the same shape
+     * @param expression Expression evaluated
+     * @return DArray holding the value of each element of the expression
+     */
+    template<typename Op, typename... E>
+    constexpr auto evaluate(const ArrayExpression<Op, E...> &expression) {
+        typename detail::ArrayOf<typename ArrayExpression<Op, E...>::value_type,
+                typename ArrayExpression<Op, E...>::shape>::type array;
+        detail::evaluate(expression, array);
+        return array;
+    }
+
+    /***
+     * @brief Element-wise arithmetic between DArrays, expressions and scalars, yielding lazy expressions.
+     *        Scalars are broadcast to every element, while operands with different shapes do not compile.
+     */
+    template<typename L, typename R> requires detail::ElementWiseOperands<L, R>
+    constexpr auto operator+(const L &lhs, const R &rhs) {
+        return detail::makeExpression(std::plus<>(), lhs, rhs);
+    }
+
+    template<typename L, typename R> requires detail::ElementWiseOperands<L, R>
+    constexpr auto operator-(const L &lhs, const R &rhs) {
+        return detail::makeExpression(std::minus<>(), lhs, rhs);
+    }
+
+    template<typename L, typename R> requires detail::ElementWiseOperands<L, R>
+    constexpr auto operator*(const L &lhs, const R &rhs) {
+        return detail::makeExpression(std::multiplies<>(), lhs, rhs);
+    }
+
+    template<typename L, typename R> requires detail::ElementWiseOperands<L, R>
+    constexpr auto operator/(const L &lhs, const R &rhs) {
+        return detail::makeExpression(std::divides<>(), lhs, rhs);
+    }
+
+    template<detail::ArrayOperand E>
+    constexpr auto operator-(const E &operand) {
+        return detail::makeExpression(std::negate<>(), operand);
+    }
+
+    /***
+     * @brief Element-wise comparisons, yielding expressions of bool.
+     * @note Comparing two DArrays keeps yielding a bool, i.e. operator== and operator!= test whole DArrays,
+     *       while ordering operators compare them lexicographically like std::array. See equal(), not_equal(),
+     *       less(), less_equal(), greater() and greater_equal() for their element-wise counterparts.
+     */
+    template<typename L, typename R> requires detail::OrderingOperands<L, R>
+    constexpr auto operator<(const L &lhs, const R &rhs) {
+        return detail::makeExpression(std::less<>(), lhs, rhs);
+    }
+
+    template<typename L, typename R> requires detail::OrderingOperands<L, R>
+    constexpr auto operator<=(const L &lhs, const R &rhs) {
+        return detail::makeExpression(std::less_equal<>(), lhs, rhs);
+    }
+
+    template<typename L, typename R> requires detail::OrderingOperands<L, R>
+    constexpr auto operator>(const L &lhs, const R &rhs) {
+        return detail::makeExpression(std::greater<>(), lhs, rhs);
+    }
+
+    template<typename L, typename R> requires detail::OrderingOperands<L, R>
+    constexpr auto operator>=(const L &lhs, const R &rhs) {
+        return detail::makeExpression(std::greater_equal<>(), lhs, rhs);
+    }
+
+    /***
+     * @return Expression testing whether each element of lhs is less than the one of rhs
+     */
+    template<typename L, typename R> requires detail::ElementWiseOperands<L, R>
+    constexpr auto less(const L &lhs, const R &rhs) {
+        return detail::makeExpression(std::less<>(), lhs, rhs);
+    }
+
+    /***
+     * @return Expression testing whether each element of lhs is less than or equal to the one of rhs
+     */
+    template<typename L, typename R> requires detail::ElementWiseOperands<L, R>
+    constexpr auto less_equal(const L &lhs, const R &rhs) {
+        return detail::makeExpression(std::less_equal<>(), lhs, rhs);
+    }
+
+    /***
+     * @return Expression testing whether each element of lhs is greater than the one of rhs
+     */
+    template<typename L, typename R> requires detail::ElementWiseOperands<L, R>
+    constexpr auto greater(const L &lhs, const R &rhs) {
+        return detail::makeExpression(std::greater<>(), lhs, rhs);
+    }
+
+    /***
+     * @return Expression testing whether each element of lhs is greater than or equal to the one of rhs
+     */
+    template<typename L, typename R> requires detail::ElementWiseOperands<L, R>
+    constexpr auto greater_equal(const L &lhs, const R &rhs) {
+        return detail::makeExpression(std::greater_equal<>(), lhs, rhs);
+    }
+
+    /***
+     * @return Expression comparing each element of lhs and rhs for equality
+     */
+    template<typename L, typename R> requires detail::ElementWiseOperands<L, R>
+    constexpr auto equal(const L &lhs, const R &rhs) {
+        return detail::makeExpression(std::equal_to<>(), lhs, rhs);
+    }
+
+    /***
+     * @return Expression comparing each element of lhs and rhs for inequality
+     */
+    template<typename L, typename R> requires detail::ElementWiseOperands<L, R>
+    constexpr auto not_equal(const L &lhs, const R &rhs) {
+        return detail::makeExpression(std::not_equal_to<>(), lhs, rhs);
+    }
+
+    /***
+     * @return Expression computing a * b + c for each element, rounded once for floating point types
+     */
+    template<typename A, typename B, typename C> requires detail::ElementWiseOperands<A, B, C>
+    constexpr auto fma(const A &a, const B &b, const C &c) {
+        return detail::makeExpression(detail::Fma(), a, b, c);
+    }
+
+    /***
+     * @return Expression computing the absolute value of each element
+     */
+    template<detail::ArrayOperand E>
+    constexpr auto abs(const E &operand) {
+        return detail::makeExpression(detail::Abs(), operand);
+    }
+
+    /***
+     * @brief Select, for each element, the value of a or b depending on a condition
+     * @param condition Expression (or DArray) of values convertible to bool
+     * @param a Value selected where condition is true
+     * @param b Value selected where condition is false
+     * @return Expression with the elements of a where condition is true, and of b elsewhere
+     */
+    template<detail::ArrayOperand C, typename A, typename B> requires detail::ElementWiseOperands<C, A, B>
+    constexpr auto where(const C &condition, const A &a, const B &b) {
+        return detail::makeExpression(detail::Where(), condition, a, b);
+    }
+
+}
+
+
+#endif //DCONTAINERS_EXPRESSION_HPP
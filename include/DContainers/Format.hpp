@@ -0,0 +1,454 @@
+/*
+ *   Copyright 2022 Alberto Guarnieri
+ *
+ *   Licensed under the Apache License, Version 2.0 (the "License");
+ *   you may not use this file except in compliance with the License.
+ *   You may obtain a copy of the License at
+ *
+ *       http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *   Unless required by applicable law or agreed to in writing, software
+ *   distributed under the License is distributed on an "AS IS" BASIS,
+ *   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *   See the License for the specific language governing permissions and
+ *   limitations under the License.
+ */
+
+#ifndef DCONTAINERS_FORMAT_HPP
+#define DCONTAINERS_FORMAT_HPP
+
+
+#include <charconv>
+#include <cmath>
+#include <cstddef>
+#include <initializer_list>
+#include <ios>
+#include <locale>
+#include <ostream>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+
+
+namespace mdc {
+
+/***
+ * @brief Layout and number formatting used by Formatter.
+ *        A container is written as nested levels: rows (the inner-most dimension) hold elements,
+ *        matrices (the two inner-most dimensions) hold rows, and blocks hold any higher dimension.
+ *        The default layout is the one of operator<<, e.g. for a DVector<3>:
+ * @code
+ * DVector<3>{
+ * |1, 2, 3|
+ * |4, 5|,
+ *
+ * |6|
+ * }
+ * @endcode
+ */
+    struct Format {
+        // Text around each row, and between its elements
+        std::string_view rowOpen = "|";
+        std::string_view rowClose = "|";
+        std::string_view elementSeparator = ", ";
+        // Text around each matrix, and between its rows
+        std::string_view matrixOpen = "";
+        std::string_view matrixClose = "";
+        std::string_view rowSeparator = "\n";
+        // Text around each block of higher dimension, and between its sub-containers
+        std::string_view blockOpen = "";
+        std::string_view blockClose = "";
+        std::string_view blockSeparator = ",\n\n";
+        // Blocks open with the type of their container (e.g. "DVector<3>{\n") and close with "\n}"
+        bool typeHeaders = true;
+        // Significant digits (general), or digits after the decimal point (fixed, scientific), of floating points;
+        // a negative value prints the shortest representation that reads back to the same value
+        int precision = -1;
+        std::chars_format floating = std::chars_format::general;
+        // Text replacing infinities and NaNs, when not empty
+        std::string_view nonFinite = "";
+        // Characters and non-arithmetic elements are written as quoted strings, escaped as in JSON
+        bool quoteText = false;
+
+        /***
+         * @return Comma-separated values, one row per line and an empty line between matrices
+         */
+        static constexpr Format csv() noexcept {
+            return {"", "", ",", "", "", "\n", "", "", "\n\n", false};
+        }
+
+        /***
+         * @return Tab-separated values, one row per line and an empty line between matrices
+         */
+        static constexpr Format tsv() noexcept {
+            return {"", "", "\t", "", "", "\n", "", "", "\n\n", false};
+        }
+
+        /***
+         * @return Nested JSON arrays, with null in place of infinities and NaNs, and strings in place of
+         *         characters and non-arithmetic elements
+         */
+        static constexpr Format json() noexcept {
+            return {"[", "]", ",", "[", "]", ",", "[", "]", ",", false, -1, std::chars_format::general, "null", true};
+        }
+    };
+
+/***
+ * @brief Buffered text writer for containers, converting numbers with std::to_chars instead of formatting each
+ *        element through iostreams. Text is accumulated in a buffer, reused by all formatters of the same thread,
+ *        and written to the stream in chunks of flushSize bytes.
+ *        Containers are written with operator<<(Formatter &, const Container &), which is also how the
+ *        operator<< of each container for std::ostream is implemented.
+ * @code
+ * mdc::Formatter formatter(file, mdc::Format::csv());
+ * formatter << matrix;
+ * @endcode
+ * @see format(const C &, const Format &)
+ */
+    class Formatter {
+    public:
+        // Amount of buffered text written to the stream at once
+        static constexpr std::size_t flushSize = 64 * 1024;
+
+    private:
+        std::ostream *_os;
+        Format _format;
+        // Elements are written by the stream itself, for flags and locales not supported by std::to_chars
+        bool _streamed = false;
+        bool _shared = false;
+        // Width of the stream, padding the first non-empty text written as operator<< does for a single value
+        std::streamsize _width = 0;
+        std::string _own;
+        std::string *_buffer;
+
+        static std::string &sharedBuffer() noexcept {
+            static thread_local std::string buffer;
+            return buffer;
+        }
+
+        static bool &sharedBusy() noexcept {
+            static thread_local bool busy = false;
+            return busy;
+        }
+
+        void acquire() {
+            if (_os && !sharedBusy()) {
+                sharedBusy() = true;
+                _shared = true;
+                _buffer = &sharedBuffer();
+                _buffer->reserve(flushSize + flushSize / 4);
+            }
+        }
+
+        static Format formatOf(const std::ostream &os) {
+            Format format;
+            format.precision = static_cast<int>(os.precision());
+            const auto floatField = os.flags() & std::ios_base::floatfield;
+            if (floatField == std::ios_base::fixed)
+                format.floating = std::chars_format::fixed;
+            else if (floatField == std::ios_base::scientific)
+                format.floating = std::chars_format::scientific;
+            return format;
+        }
+
+        static bool streamedBy(const std::ostream &os) {
+            constexpr auto unsupported = std::ios_base::showpos | std::ios_base::showpoint | std::ios_base::uppercase |
+                                         std::ios_base::showbase | std::ios_base::boolalpha;
+            const auto baseField = os.flags() & std::ios_base::basefield;
+            return (os.flags() & unsupported) || (baseField && baseField != std::ios_base::dec) ||
+                   (os.flags() & std::ios_base::floatfield) == std::ios_base::floatfield ||
+                   os.getloc() != std::locale::classic();
+        }
+
+        void pad(std::size_t from) {
+            const auto size = static_cast<std::streamsize>(_buffer->size() - from);
+            if (size < _width) {
+                const std::string fill(static_cast<std::size_t>(_width - size), _os->fill());
+                if ((_os->flags() & std::ios_base::adjustfield) == std::ios_base::left)
+                    _buffer->append(fill);
+                else
+                    _buffer->insert(from, fill);
+            }
+            _width = 0;
+        }
+
+        template<typename T>
+        void stream(const T &value) {
+            flush();
+            _os->width(std::exchange(_width, 0));
+            *_os << value;
+        }
+
+        void quoted(std::string_view chars) {
+            constexpr char hex[] = "0123456789abcdef";
+            _buffer->push_back('"');
+            for (char c: chars) {
+                const auto code = static_cast<unsigned char>(c);
+                if (c == '"' || c == '\\') {
+                    _buffer->push_back('\\');
+                    _buffer->push_back(c);
+                } else if (c == '\n') {
+                    _buffer->append("\\n");
+                } else if (c == '\t') {
+                    _buffer->append("\\t");
+                } else if (code < 0x20) {
+                    _buffer->append("\\u00");
+                    _buffer->push_back(hex[code >> 4]);
+                    _buffer->push_back(hex[code & 0xF]);
+                } else {
+                    _buffer->push_back(c);
+                }
+            }
+            _buffer->push_back('"');
+        }
+
+        template<typename T>
+        void convert(T value) {
+            char digits[128];
+            std::to_chars_result result;
+            if constexpr (std::is_floating_point_v<T>) {
+                if (!_format.nonFinite.empty() && !std::isfinite(value)) {
+                    text(_format.nonFinite);
+                    return;
+                }
+                result = _format.precision < 0
+                         ? std::to_chars(digits, digits + sizeof(digits), value, _format.floating)
+                         : std::to_chars(digits, digits + sizeof(digits), value, _format.floating, _format.precision);
+                if (result.ec != std::errc()) {
+                    // fixed notation of very large values, with a high precision, may not fit
+                    std::ostringstream os;
+                    os.imbue(std::locale::classic());
+                    os.precision(_format.precision < 0 ? 17 : _format.precision);
+                    if (_format.floating == std::chars_format::fixed)
+                        os << std::fixed;
+                    else if (_format.floating == std::chars_format::scientific)
+                        os << std::scientific;
+                    os << value;
+                    text(os.str());
+                    return;
+                }
+            } else {
+                result = std::to_chars(digits, digits + sizeof(digits), value);
+            }
+            _buffer->append(digits, result.ptr);
+        }
+
+    public:
+        /***
+         * @brief Write containers to a stream with the layout of operator<<, formatting numbers according to the
+         *        precision and floating point notation of the stream.
+         *        Elements are still written through the stream when it sets other flags (e.g. std::showpos)
+         *        or a locale different from the classic one.
+         *        As for any single value, the width of the stream pads the first text written and is then reset.
+         * @param os Stream written
+         */
+        explicit Formatter(std::ostream &os)
+                : _os(&os), _format(formatOf(os)), _streamed(streamedBy(os)), _width(os.width(0)), _buffer(&_own) {
+            acquire();
+        }
+
+        /***
+         * @brief Write containers to a stream with a given layout
+         * @param os Stream written, whose width pads the first text written and is then reset
+         * @param format Layout and number formatting
+         */
+        Formatter(std::ostream &os, const Format &format)
+                : _os(&os), _format(format), _width(os.width(0)), _buffer(&_own) {
+            acquire();
+        }
+
+        /***
+         * @brief Write containers into a string, available through str()
+         * @param format Layout and number formatting
+         */
+        explicit Formatter(const Format &format = {}) : _os(nullptr), _format(format), _buffer(&_own) {}
+
+        Formatter(const Formatter &) = delete;
+
+        Formatter &operator=(const Formatter &) = delete;
+
+        ~Formatter() {
+            try {
+                flush();
+            } catch (...) {}
+            if (_shared) {
+                _buffer->clear();
+                sharedBusy() = false;
+            }
+        }
+
+        /***
+         * @return Layout and number formatting in use
+         */
+        const Format &format() const noexcept {
+            return _format;
+        }
+
+        /***
+         * @brief Write all buffered text to the stream, if any
+         */
+        void flush() {
+            if (_os && !_buffer->empty()) {
+                _os->write(_buffer->data(), static_cast<std::streamsize>(_buffer->size()));
+                _buffer->clear();
+            }
+        }
+
+        /***
+         * @return Text written so far, when not writing to a stream
+         */
+        const std::string &str() const noexcept {
+            return *_buffer;
+        }
+
+        /***
+         * @brief Append text as it is
+         */
+        Formatter &text(std::string_view chars) {
+            const auto from = _buffer->size();
+            _buffer->append(chars);
+            if (_width > 0 && !chars.empty())
+                pad(from);
+            if (_buffer->size() >= flushSize)
+                flush();
+            return *this;
+        }
+
+        /***
+         * @brief Append a single element: arithmetic types are converted with std::to_chars,
+         *        characters are written as they are, and any other type through its operator<<.
+         *        Characters and other types are written as quoted strings instead when the format quotes text.
+         */
+        template<typename T>
+        Formatter &element(const T &value) {
+            constexpr bool character = std::is_same_v<T, char> || std::is_same_v<T, signed char> ||
+                                       std::is_same_v<T, unsigned char>;
+            const auto from = _buffer->size();
+            if constexpr (character) {
+                if (_format.quoteText)
+                    quoted(std::string_view(reinterpret_cast<const char *>(&value), 1));
+                else
+                    _buffer->push_back(static_cast<char>(value));
+            } else if constexpr (std::is_same_v<T, bool>) {
+                if (_streamed)
+                    stream(value);
+                else
+                    _buffer->push_back(value ? '1' : '0');
+            } else if constexpr (std::is_arithmetic_v<T>) {
+                if (_streamed)
+                    stream(value);
+                else
+                    convert(value);
+            } else if (_os && !_format.quoteText) {
+                stream(value);
+            } else {
+                std::ostringstream os;
+                os << value;
+                if (_format.quoteText)
+                    quoted(os.str());
+                else
+                    _buffer->append(os.str());
+            }
+            if (_width > 0 && _buffer->size() > from)
+                pad(from);
+            if (_buffer->size() >= flushSize)
+                flush();
+            return *this;
+        }
+
+        /***
+         * @brief Append a row, i.e. the inner-most dimension of a container
+         * @param size Number of elements
+         * @param at Function returning the i-th element
+         */
+        template<typename Fn>
+        Formatter &row(std::size_t size, Fn &&at) {
+            text(_format.rowOpen);
+            for (std::size_t i = 0; i < size; ++i) {
+                if (i > 0)
+                    text(_format.elementSeparator);
+                element(at(i));
+            }
+            return text(_format.rowClose);
+        }
+
+        /***
+         * @brief Append a matrix, i.e. the two inner-most dimensions of a container
+         * @param size Number of rows
+         * @param rowAt Function appending the i-th row
+         */
+        template<typename Fn>
+        Formatter &matrix(std::size_t size, Fn &&rowAt) {
+            text(_format.matrixOpen);
+            for (std::size_t i = 0; i < size; ++i) {
+                if (i > 0)
+                    text(_format.rowSeparator);
+                rowAt(i);
+            }
+            return text(_format.matrixClose);
+        }
+
+        /***
+         * @brief Append a block, i.e. a dimension above the two inner-most ones
+         * @param type Name of the container, written with its parameters when using type headers
+         * @param parameters Template parameters written after the name, e.g. {2, 3} for "DArray<2,3>"
+         * @param size Number of sub-containers
+         * @param subAt Function appending the i-th sub-container
+         */
+        template<typename Fn>
+        Formatter &block(std::string_view type, std::initializer_list<std::size_t> parameters, std::size_t size,
+                         Fn &&subAt) {
+            if (_format.typeHeaders) {
+                // name and opening bracket form a single text, padded as a whole by the width of the stream
+                std::string name(type);
+                name += '<';
+                text(name);
+                for (auto parameter = parameters.begin(); parameter != parameters.end(); ++parameter) {
+                    if (parameter != parameters.begin())
+                        text(",");
+                    convert(*parameter);
+                }
+                text(">{\n");
+            } else {
+                text(_format.blockOpen);
+            }
+            for (std::size_t i = 0; i < size; ++i) {
+                if (i > 0)
+                    text(_format.blockSeparator);
+                subAt(i);
+            }
+            return text(_format.typeHeaders ? "\n}" : _format.blockClose);
+        }
+    };
+
+    namespace detail {
+
+        template<typename C>
+        std::ostream &print(std::ostream &os, const C &container) {
+            Formatter formatter(os);
+            formatter << container;
+            formatter.flush();
+            return os;
+        }
+
+    }
+
+    /***
+     * @brief Write a container into a string
+     * @param container Container written, through operator<<(Formatter &, const C &)
+     * @param format Layout and number formatting, e.g. Format::csv()
+     * @return Formatted text
+     */
+    template<typename C>
+    std::string format(const C &container, const Format &format = {}) {
+        Formatter formatter(format);
+        formatter << container;
+        return formatter.str();
+    }
+
+}
+
+
+#endif //DCONTAINERS_FORMAT_HPP
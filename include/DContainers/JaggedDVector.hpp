@@ -0,0 +1,693 @@
+/*
+ *   Copyright 2022 Alberto Guarnieri
+ *
+ *   Licensed under the Apache License, Version 2.0 (the "License");
+ *   you may not use this file except in compliance with the License.
+ *   You may obtain a copy of the License at
+ *
+ *       http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *   Unless required by applicable law or agreed to in writing, software
+ *   distributed under the License is distributed on an "AS IS" BASIS,
+ *   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *   See the License for the specific language governing permissions and
+ *   limitations under the License.
+ */
+
+
+#ifndef DCONTAINERS_JAGGEDDVECTOR_HPP
+#define DCONTAINERS_JAGGEDDVECTOR_HPP
+
+
+#include <algorithm>
+#include <array>
+#include <concepts>
+#include <cstddef>
+#include <iostream>
+#include <iterator>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "DContainers/BoundsCheck.hpp"
+#include "DContainers/DTensor.hpp"
+#include "DContainers/DVector.hpp"
+#include "DContainers/DView.hpp"
+#include "DContainers/Format.hpp"
+#include "DContainers/Span/Spanning.hpp"
+
+
+namespace mdc {
+
+    template<std::size_t D, typename T>
+    class JaggedDVector;
+
+/***
+ * @brief Non-owning view over a jagged container stored in compressed sparse row (CSR) format,
+ *        i.e. a single buffer of values plus, for each level but the inner-most one,
+ *        an array of offsets where the i-th sub-vector spans children [offsets[i], offsets[i + 1])
+ * @tparam D View dimension
+ * @tparam T Type of the elements viewed, const-qualified for read-only views
+ * @warning A view does not extend the lifetime of the buffers it refers to
+ * @see JaggedDVector
+ */
+    template<std::size_t D, typename T>
+    class JaggedView {
+        static_assert(D > 0, "JaggedView must have at least one dimension");
+
+    public:
+        using value_type = std::remove_cv_t<T>;
+        using offsets_type = std::array<const std::size_t *, D - 1>;
+        using iterator = detail::ViewIterator<JaggedView>;
+
+    private:
+        T *_values;
+        offsets_type _offsets;
+        std::size_t _first;
+        std::size_t _last;
+
+        decltype(auto) row(std::size_t index) const {
+            if constexpr (D == 1)
+                return (_values[_first + index]);
+            else
+                return JaggedView<D - 1, T>(_values, detail::tail<1>(_offsets),
+                                            _offsets[0][_first + index], _offsets[0][_first + index + 1]);
+        }
+
+        std::pair<std::size_t, std::size_t> leaves() const noexcept {
+            std::size_t first = _first, last = _last;
+            if (first == last)
+                return {0, 0};
+            for (const auto *offsets: _offsets) {
+                first = offsets[first];
+                last = offsets[last];
+            }
+            return {first, last};
+        }
+
+        friend class detail::ViewIterator<JaggedView>;
+
+        template<std::size_t, typename>
+        friend class JaggedView;
+
+    public:
+        /***
+         * @brief Construct an empty view, not referring to any buffer
+         */
+        JaggedView() noexcept : _values(nullptr), _offsets{}, _first(0), _last(0) {}
+
+        /***
+         * @brief Construct a view over the sub-vectors [first, last) of the outer-most level
+         * @param values Buffer holding all elements, in row-major order
+         * @param offsets Pointer to the offsets of each level, starting from the outer-most one
+         * @param first Index of the first sub-vector (or element) viewed
+         * @param last Index past the last sub-vector (or element) viewed
+         */
+        JaggedView(T *values, const offsets_type &offsets, std::size_t first, std::size_t last) noexcept
+                : _values(values), _offsets(offsets), _first(first), _last(last) {}
+
+        /***
+         * @brief Convert a view into a read-only view of the same elements
+         */
+        template<typename U>
+        JaggedView(const JaggedView<D, U> &other) noexcept requires (std::is_same_v<const U, T> &&
+                                                                     !std::is_same_v<U, T>)
+                : _values(other._values), _offsets(other._offsets), _first(other._first), _last(other._last) {}
+
+        /***
+         * @brief Get a reference to a specific element viewed, specifying its position.
+         * @param index Index of the higher (i.e. left-most) dimension
+         * @param indices Parameter pack of the indices for the lower dimensions of the element
+         * @return Reference to the requested element
+         * @throws std::out_of_range If any index is not lower than the size of its sub-vector
+         */
+        template<std::integral Idx, std::integral... Indices>
+        T &at(Idx index, Indices... indices) const requires (sizeof...(Indices) == D - 1) {
+            detail::checkViewIndex(0, static_cast<std::size_t>(index), size());
+            if constexpr (sizeof...(Indices) == 0)
+                return row(static_cast<std::size_t>(index));
+            else
+                return row(static_cast<std::size_t>(index)).at(indices...);
+        }
+
+        /***
+         * @brief Get a reference to a specific element viewed, without throwing on invalid indices.
+         *        Indices are validated according to BoundsCheck::Default, i.e. only in debug builds by default.
+         * @param index Index of the higher (i.e. left-most) dimension
+         * @param indices Parameter pack of the indices for the lower dimensions of the element
+         * @return Reference to the requested element
+         * @see BoundsCheck
+         */
+        template<std::integral Idx, std::integral... Indices>
+        T &operator()(Idx index, Indices... indices) const noexcept requires (sizeof...(Indices) == D - 1) {
+            mdc::BoundsCheck::Default::check(static_cast<std::size_t>(index), size());
+            if constexpr (sizeof...(Indices) == 0)
+                return row(static_cast<std::size_t>(index));
+            else
+                return row(static_cast<std::size_t>(index))(indices...);
+        }
+
+        /***
+         * @brief Get a view of the sub-vector at a given position
+         * @param index Index of the higher (i.e. left-most) dimension
+         * @param indices Parameter pack of the indices for the lower dimensions of the sub-vector
+         * @return View of lower dimension over the requested sub-vector
+         */
+        template<std::integral Idx, std::integral... Indices>
+        JaggedView<D - sizeof...(Indices) - 1, T>
+        at(Idx index, Indices... indices) const requires (sizeof...(Indices) < D - 1) {
+            detail::checkViewIndex(0, static_cast<std::size_t>(index), size());
+            if constexpr (sizeof...(Indices) == 0)
+                return row(static_cast<std::size_t>(index));
+            else
+                return row(static_cast<std::size_t>(index)).at(indices...);
+        }
+
+        /***
+         * @brief Get specific intervals of the view using Span objects for each dimension.
+         *        Intervals exceeding the size of a sub-vector are truncated, as in DVector<D,T>::at(J span, K... spans)
+         * @param span First Span object, corresponding to the higher dimension
+         * @param spans Parameter pack of following Span objects
+         * @return JaggedDVector containing copies of the elements represented by the given Span objects
+         * @see Span
+         */
+        template<typename J, typename... K>
+        JaggedDVector<D, value_type> at(J span, K... spans) const
+        requires (sizeof...(K) == D - 1)
+                 && std::is_convertible_v<J, mdc::Spanning> && (std::is_convertible_v<K, mdc::Spanning> && ...) {
+            JaggedDVector<D, value_type> jagged;
+            jagged.template appendSpanned<D>(JaggedView<D, const value_type>(*this), span, spans...);
+            return jagged;
+        }
+
+        iterator begin() const {
+            return {*this, 0};
+        }
+
+        iterator end() const {
+            return {*this, static_cast<std::ptrdiff_t>(size())};
+        }
+
+        /***
+         * @return Number of sub-vectors (or elements) viewed in the outer-most dimension
+         */
+        std::size_t size() const noexcept {
+            return _last - _first;
+        }
+
+        /***
+         * @return true iff no sub-vector (or element) is viewed in the outer-most dimension
+         */
+        bool empty() const noexcept {
+            return _first == _last;
+        }
+
+        /***
+         * @return Total amount of elements viewed, computed with one lookup for each level
+         */
+        std::size_t total() const noexcept {
+            auto [first, last] = leaves();
+            return last - first;
+        }
+
+        /***
+         * @return Contiguous range over all elements viewed, in row-major order
+         */
+        std::span<T> elements() const noexcept {
+            auto [first, last] = leaves();
+            return {_values + first, last - first};
+        }
+
+        /***
+         * @return Pointer to the first element viewed
+         */
+        T *flat_begin() const noexcept {
+            return _values + leaves().first;
+        }
+
+        /***
+         * @return Pointer past the last element viewed
+         */
+        T *flat_end() const noexcept {
+            return _values + leaves().second;
+        }
+
+        /***
+         * @brief Copy all elements viewed into a new, nested DVector
+         * @return DVector holding copies of the elements viewed, preserving the length of each sub-vector
+         */
+        DVector<D, value_type> materialize() const {
+            DVector<D, value_type> dVector;
+            dVector.reserve(size());
+            for (decltype(auto) element: *this) {
+                if constexpr (D == 1)
+                    dVector.push_back(element);
+                else
+                    dVector.push_back(element.materialize());
+            }
+            return dVector;
+        }
+    };
+
+/***
+ * @brief Represent a (possibly jagged) vector with a fixed dimension, storing all of its elements in a single
+ *        contiguous buffer, plus an array of offsets for each level but the inner-most one,
+ *        in the style of compressed sparse row (CSR) matrices.
+ *        Unlike DVector, sub-vectors carry neither their own header nor any spare capacity,
+ *        hence JaggedDVector is best suited for ragged data built once and then only read or updated in place.
+ * @tparam D Vector dimension
+ * @tparam T Type of the elements stored
+ * @note bool is not supported, as its elements could not be addressed through data() nor view()
+ * @see compact(const DVector<D,T> &)
+ */
+    template<std::size_t D, typename T>
+    class JaggedDVector {
+        static_assert(D > 0, "JaggedDVector must have at least one dimension");
+        static_assert(!std::is_same_v<std::remove_cv_t<T>, bool>,
+                      "JaggedDVector cannot hold bool, since std::vector<bool> is packed: "
+                      "use char or std::uint8_t instead");
+
+    public:
+        using value_type = T;
+        using row_type = std::conditional_t<D == 1, T, DVector<(D > 1 ? D - 1 : 1), T>>;
+        using iterator = typename JaggedView<D, T>::iterator;
+        using const_iterator = typename JaggedView<D, const T>::iterator;
+
+    private:
+        std::vector<T> _values;
+        std::array<std::vector<std::size_t>, D - 1> _offsets;
+
+        static std::array<std::vector<std::size_t>, D - 1> emptyOffsets() {
+            std::array<std::vector<std::size_t>, D - 1> offsets;
+            for (auto &levelOffsets: offsets)
+                levelOffsets.push_back(0);
+            return offsets;
+        }
+
+        template<std::size_t L>
+        void closeRow() {
+            if constexpr (L == 1)
+                _offsets[D - 2].push_back(_values.size());
+            else
+                _offsets[D - 1 - L].push_back(_offsets[D - L].size() - 1);
+        }
+
+        template<std::size_t L, typename Row>
+        static void countRow(const Row &row, std::array<std::size_t, D> &counts) {
+            ++counts[D - 1 - L];
+            if constexpr (L == 1)
+                counts[D - 1] += std::size(row);
+            else
+                for (const auto &subRow: row)
+                    countRow<L - 1>(subRow, counts);
+        }
+
+        template<std::size_t L, typename Row>
+        void appendRow(const Row &row) {
+            if constexpr (L == 1)
+                _values.insert(_values.end(), std::begin(row), std::end(row));
+            else
+                for (const auto &subRow: row)
+                    appendRow<L - 1>(subRow);
+            closeRow<L>();
+        }
+
+        template<typename Source>
+        void assign(const Source &source) {
+            if constexpr (D == 1) {
+                _values.assign(std::begin(source), std::end(source));
+            } else {
+                std::array<std::size_t, D> counts{};
+                for (const auto &row: source)
+                    countRow<D - 1>(row, counts);
+                for (std::size_t l = 0; l < D - 1; ++l)
+                    _offsets[l].reserve(counts[l] + 1);
+                _values.reserve(counts[D - 1]);
+                for (const auto &row: source)
+                    appendRow<D - 1>(row);
+            }
+        }
+
+        template<std::size_t L, typename J, typename... K>
+        void appendSpanned(const JaggedView<L, const T> &row, J span, K... spans) {
+            const mdc::Spanning spanning = span;
+            const std::size_t from = spanning.isAll ? 0 : spanning.from,
+                    end = spanning.isAll || spanning.to >= row.size() ? row.size() : spanning.to + 1;
+            for (std::size_t i = from; i < end; i += spanning.step) {
+                if constexpr (L == 1)
+                    _values.push_back(row(i));
+                else
+                    appendSpanned<L - 1>(row.at(i), spans...);
+            }
+            if constexpr (L < D)
+                closeRow<L>();
+        }
+
+        template<std::size_t, typename>
+        friend class JaggedView;
+
+        template<typename U>
+        typename JaggedView<D, U>::offsets_type offsetPointers() const noexcept {
+            typename JaggedView<D, U>::offsets_type pointers{};
+            for (std::size_t l = 0; l < D - 1; ++l)
+                pointers[l] = _offsets[l].data();
+            return pointers;
+        }
+
+    public:
+        /***
+         * @brief Construct an empty JaggedDVector
+         */
+        JaggedDVector() : _values(), _offsets(emptyOffsets()) {}
+
+        /***
+         * @brief Construct JaggedDVector as a compact copy of a DVector, allocating exactly one buffer of values
+         *        and one buffer of offsets for each level
+         * @param dVector DVector to be copied
+         */
+        template<typename Allocator>
+        explicit JaggedDVector(const DVector<D, T, Allocator> &dVector) : JaggedDVector() {
+            assign(dVector);
+        }
+
+        /***
+         * @brief Construct JaggedDVector adopting buffers already in compressed sparse row format
+         * @param values Buffer holding all elements, in row-major order
+         * @param offsets Offsets of each level, starting from the outer-most one,
+         *                where the i-th sub-vector spans children [offsets[i], offsets[i + 1])
+         * @throws std::invalid_argument If offsets are not non-decreasing, starting from 0 and ending with
+         *                               the number of children of the following level (or of values)
+         */
+        JaggedDVector(std::vector<T> values, std::array<std::vector<std::size_t>, D - 1> offsets)
+                : _values(std::move(values)), _offsets(std::move(offsets)) {
+            for (std::size_t l = D - 1; l-- > 0;) {
+                const auto &levelOffsets = _offsets[l];
+                // levels are checked from the inner-most one, hence the following level is never empty
+                const std::size_t children = l + 2 < D ? _offsets[l + 1].size() - 1 : _values.size();
+                if (levelOffsets.empty() || levelOffsets.front() != 0 || levelOffsets.back() != children ||
+                    !std::is_sorted(levelOffsets.begin(), levelOffsets.end()))
+                    throw std::invalid_argument("JaggedDVector: offsets of level " + std::to_string(l) +
+                                                " are not consistent");
+            }
+        }
+
+        /***
+         * @brief Constructor of JaggedDVector with a nested initializer_list, one level for each dimension
+         * @param values Nested initializer_list of elements, where sub-lists may have different sizes
+         */
+        JaggedDVector(typename detail::NestedInitializerList<D, T>::type values) : JaggedDVector() {
+            assign(values);
+        }
+
+        /***
+         * @brief Convert JaggedDVector into a nested DVector with the same sub-vectors
+         */
+        explicit operator DVector<D, T>() const {
+            return view().materialize();
+        }
+
+        /***
+         * @brief Append a sub-vector (or an element, for a single dimension) at the end of JaggedDVector
+         * @param row Sub-vector to be copied
+         */
+        void push_back(const row_type &row) {
+            if constexpr (D == 1)
+                _values.push_back(row);
+            else
+                appendRow<D - 1>(row);
+        }
+
+        /***
+         * @brief Get a reference to a specific element held by JaggedDVector, specifying its position.
+         * @param index Index of the higher (i.e. left-most) dimension
+         * @param indices Parameter pack of the indices for the lower dimensions of the element
+         * @return Reference to the requested element
+         * @throws std::out_of_range If any index is not lower than the size of its sub-vector
+         */
+        template<std::integral Idx, std::integral... Indices>
+        T &at(Idx index, Indices... indices) requires (sizeof...(Indices) == D - 1) {
+            return view().at(index, indices...);
+        }
+
+        /***
+         * @see JaggedDVector<D,T>::at(Idx index, Indices... indices)
+         * @return Constant reference to the requested element
+         */
+        template<std::integral Idx, std::integral... Indices>
+        const T &at(Idx index, Indices... indices) const requires (sizeof...(Indices) == D - 1) {
+            return view().at(index, indices...);
+        }
+
+        /***
+         * @brief Get a view of the sub-vector at a given position
+         * @param index Index of the higher (i.e. left-most) dimension
+         * @param indices Parameter pack of the indices for the lower dimensions of the sub-vector
+         * @return View of lower dimension over the requested sub-vector
+         * @throws std::out_of_range If any index is not lower than the size of its sub-vector
+         */
+        template<std::integral Idx, std::integral... Indices>
+        JaggedView<D - sizeof...(Indices) - 1, T>
+        at(Idx index, Indices... indices) requires (sizeof...(Indices) < D - 1) {
+            return view().at(index, indices...);
+        }
+
+        /***
+         * @see JaggedDVector<D,T>::at(Idx index, Indices... indices)
+         * @return Read-only view of lower dimension over the requested sub-vector
+         */
+        template<std::integral Idx, std::integral... Indices>
+        JaggedView<D - sizeof...(Indices) - 1, const T>
+        at(Idx index, Indices... indices) const requires (sizeof...(Indices) < D - 1) {
+            return view().at(index, indices...);
+        }
+
+        /***
+         * @brief Get a reference to a specific element held by JaggedDVector, without throwing on invalid indices.
+         *        Indices are validated according to BoundsCheck::Default, i.e. only in debug builds by default.
+         * @param index Index of the higher (i.e. left-most) dimension
+         * @param indices Parameter pack of the indices for the lower dimensions of the element
+         * @return Reference to the requested element
+         * @see BoundsCheck
+         */
+        template<std::integral Idx, std::integral... Indices>
+        T &operator()(Idx index, Indices... indices) noexcept requires (sizeof...(Indices) == D - 1) {
+            return view()(index, indices...);
+        }
+
+        /***
+         * @see JaggedDVector<D,T>::operator()(Idx index, Indices... indices)
+         * @return Constant reference to the requested element
+         */
+        template<std::integral Idx, std::integral... Indices>
+        const T &operator()(Idx index, Indices... indices) const noexcept requires (sizeof...(Indices) == D - 1) {
+            return view()(index, indices...);
+        }
+
+        /***
+         * @brief Get specific intervals of the vector using Span objects for each dimension.
+         *        Intervals exceeding the size of a sub-vector are truncated, as in DVector<D,T>::at(J span, K... spans)
+         * @param span First Span object, corresponding to the higher dimension
+         * @param spans Parameter pack of following Span objects
+         * @return JaggedDVector containing copies of the elements represented by the given Span objects
+         * @see Span
+         */
+        template<typename J, typename... K>
+        JaggedDVector at(J span, K... spans) const
+        requires (sizeof...(K) == D - 1)
+                 && std::is_convertible_v<J, mdc::Spanning> && (std::is_convertible_v<K, mdc::Spanning> && ...) {
+            return view().at(span, spans...);
+        }
+
+        /***
+         * @brief View the whole JaggedDVector without copying its elements
+         * @return View over all elements of JaggedDVector
+         */
+        JaggedView<D, T> view() noexcept {
+            return {_values.data(), offsetPointers<T>(), 0, size()};
+        }
+
+        /***
+         * @see JaggedDVector<D,T>::view()
+         * @return Read-only view over all elements of JaggedDVector
+         */
+        JaggedView<D, const T> view() const noexcept {
+            return {_values.data(), offsetPointers<const T>(), 0, size()};
+        }
+
+        /***
+         * @return Iterator to the view of the first sub-vector (or element) of the outer-most dimension
+         */
+        iterator begin() noexcept {
+            return view().begin();
+        }
+
+        const_iterator begin() const noexcept {
+            return view().begin();
+        }
+
+        /***
+         * @return Iterator past the view of the last sub-vector (or element) of the outer-most dimension
+         */
+        iterator end() noexcept {
+            return view().end();
+        }
+
+        const_iterator end() const noexcept {
+            return view().end();
+        }
+
+        /***
+         * @return Number of sub-vectors (or elements) of the outer-most dimension
+         */
+        std::size_t size() const noexcept {
+            if constexpr (D == 1)
+                return _values.size();
+            else
+                return _offsets[0].size() - 1;
+        }
+
+        /***
+         * @return true iff JaggedDVector holds no sub-vector (or element)
+         */
+        bool empty() const noexcept {
+            return size() == 0;
+        }
+
+        /***
+         * @return Return total amount of elements stored, computed in constant time
+         */
+        std::size_t total() const noexcept {
+            return _values.size();
+        }
+
+        /***
+         * @return Buffer holding all elements, in row-major order
+         */
+        const std::vector<T> &values() const noexcept {
+            return _values;
+        }
+
+        /***
+         * @param level Level queried, where 0 is the outer-most one
+         * @return Offsets of the given level, where the i-th sub-vector spans children [offsets[i], offsets[i + 1])
+         * @throws std::out_of_range If level is not lower than D - 1
+         */
+        const std::vector<std::size_t> &offsets(std::size_t level) const {
+            if (level >= D - 1)
+                throw std::out_of_range("JaggedDVector::offsets: level " + std::to_string(level) +
+                                        " is out of range (levels=" + std::to_string(D - 1) + ")");
+            return _offsets[level];
+        }
+
+        /***
+         * @return Pointer to the contiguous buffer holding all elements, in row-major order
+         */
+        T *data() noexcept {
+            return _values.data();
+        }
+
+        /***
+         * @see JaggedDVector<D,T>::data()
+         */
+        const T *data() const noexcept {
+            return _values.data();
+        }
+
+        /***
+         * @return Contiguous range over all elements stored, in row-major order
+         */
+        std::span<T> elements() noexcept {
+            return _values;
+        }
+
+        /***
+         * @see JaggedDVector<D,T>::elements()
+         */
+        std::span<const T> elements() const noexcept {
+            return _values;
+        }
+
+        /***
+         * @return Pointer to the first element stored
+         */
+        T *flat_begin() noexcept {
+            return _values.data();
+        }
+
+        /***
+         * @see JaggedDVector<D,T>::flat_begin()
+         */
+        const T *flat_begin() const noexcept {
+            return _values.data();
+        }
+
+        /***
+         * @return Pointer past the last element stored
+         */
+        T *flat_end() noexcept {
+            return _values.data() + _values.size();
+        }
+
+        /***
+         * @see JaggedDVector<D,T>::flat_end()
+         */
+        const T *flat_end() const noexcept {
+            return _values.data() + _values.size();
+        }
+
+        /***
+         * @return true iff the two vectors have sub-vectors of the same sizes and equal elements
+         */
+        bool operator==(const JaggedDVector &other) const {
+            return _offsets == other._offsets && _values == other._values;
+        }
+    };
+
+    /***
+     * @brief Copy a DVector into its compact representation
+     * @param dVector DVector to be copied
+     * @return JaggedDVector holding the same sub-vectors of dVector
+     */
+    template<std::size_t D, typename T, typename Allocator>
+    JaggedDVector<D, T> compact(const DVector<D, T, Allocator> &dVector) {
+        return JaggedDVector<D, T>(dVector);
+    }
+
+    /***
+     * @brief Write a jagged view through a Formatter, with the same layout used for DVectors of equal dimension
+     * @see Formatter
+     */
+    template<std::size_t D, typename T>
+    Formatter &operator<<(Formatter &formatter, const mdc::JaggedView<D, T> &view) {
+        if constexpr (D == 1)
+            return formatter.row(view.size(), [&view](std::size_t i) -> decltype(auto) { return view(i); });
+        else if constexpr (D == 2)
+            return formatter.matrix(view.size(), [&](std::size_t i) { formatter << view.at(i); });
+        else
+            return formatter.block("JaggedDVector", {D}, view.size(), [&](std::size_t i) { formatter << view.at(i); });
+    }
+
+    /***
+     * @see operator<<(Formatter &, const JaggedView<D,T> &)
+     */
+    template<std::size_t D, typename T>
+    Formatter &operator<<(Formatter &formatter, const mdc::JaggedDVector<D, T> &jagged) {
+        return formatter << jagged.view();
+    }
+
+    /***
+     * @brief Print function for JaggedDVectors, with the same format used for DVectors of equal dimension
+     * @see operator<<(std::ostream &, const DVector<D,T> &)
+     */
+    template<std::size_t D, typename T>
+    std::ostream &operator<<(std::ostream &os, const mdc::JaggedDVector<D, T> &jagged) {
+        return detail::print(os, jagged);
+    }
+
+}
+
+
+#endif //DCONTAINERS_JAGGEDDVECTOR_HPP
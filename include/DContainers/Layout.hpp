@@ -0,0 +1,505 @@
+/*
+ *   Copyright 2022 Alberto Guarnieri
+ *
+ *   Licensed under the Apache License, Version 2.0 (the "License");
+ *   you may not use this file except in compliance with the License.
+ *   You may obtain a copy of the License at
+ *
+ *       http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *   Unless required by applicable law or agreed to in writing, software
+ *   distributed under the License is distributed on an "AS IS" BASIS,
+ *   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *   See the License for the specific language governing permissions and
+ *   limitations under the License.
+ */
+
+#ifndef DCONTAINERS_LAYOUT_HPP
+#define DCONTAINERS_LAYOUT_HPP
+
+
+#include <array>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <limits>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+#include "DContainers/BoundsCheck.hpp"
+#include "DContainers/DArray.hpp"
+#include "DContainers/DView.hpp"
+#include "DContainers/Format.hpp"
+
+
+namespace mdc {
+
+    /***
+     * @brief Policies mapping the indices of a DGrid to the position of its element in memory.
+     *        Every policy provides a Mapping<E...> for the extents E of each dimension, computed at compile time,
+     *        with the number of elements stored (size, including any padding) and the offset of each element.
+     *        Offsets are always a sum of one term per dimension, hence accessing an element costs D additions.
+     * @code
+     * mdc::DGrid<float, mdc::Layout::Tiled<8, 8>, 2048, 2048> grid;
+     * @endcode
+     */
+    struct Layout {
+        /***
+         * @brief Last dimension stored contiguously, as in DArray
+         */
+        struct RowMajor {
+            template<std::size_t... E>
+            struct Mapping {
+                static constexpr std::size_t size = (E * ...);
+                static constexpr std::array<std::size_t, sizeof...(E)> strides =
+                        detail::rowMajorStrides<sizeof...(E)>({E...});
+
+                static constexpr std::size_t offset(const std::array<std::size_t, sizeof...(E)> &index) noexcept {
+                    std::size_t offset = 0;
+                    for (std::size_t d = 0; d < sizeof...(E); ++d)
+                        offset += index[d] * strides[d];
+                    return offset;
+                }
+            };
+        };
+
+        /***
+         * @brief First dimension stored contiguously, e.g. each column of a matrix
+         */
+        struct ColumnMajor {
+            template<std::size_t... E>
+            struct Mapping {
+                static constexpr std::size_t size = (E * ...);
+
+                static constexpr std::array<std::size_t, sizeof...(E)> strides = [] {
+                    constexpr std::array<std::size_t, sizeof...(E)> extents{E...};
+                    std::array<std::size_t, sizeof...(E)> strides{};
+                    std::size_t stride = 1;
+                    for (std::size_t d = 0; d < sizeof...(E); ++d) {
+                        strides[d] = stride;
+                        stride *= extents[d];
+                    }
+                    return strides;
+                }();
+
+                static constexpr std::size_t offset(const std::array<std::size_t, sizeof...(E)> &index) noexcept {
+                    std::size_t offset = 0;
+                    for (std::size_t d = 0; d < sizeof...(E); ++d)
+                        offset += index[d] * strides[d];
+                    return offset;
+                }
+            };
+        };
+
+        /***
+         * @brief Elements grouped into contiguous tiles, stored in row-major order both inside each tile
+         *        and among tiles. Extents which are not a multiple of their tile size are padded up to the next one.
+         * @tparam Tiles Tile size of each dimension, or a single size used for all of them
+         */
+        template<std::size_t... Tiles>
+        struct Tiled {
+            static_assert(sizeof...(Tiles) > 0 && ((Tiles > 0) && ...), "Tile sizes must be positive");
+
+            template<std::size_t... E>
+            struct Mapping {
+                static_assert(sizeof...(Tiles) == 1 || sizeof...(Tiles) == sizeof...(E),
+                              "Tiled needs either one tile size, or one for each dimension");
+
+                static constexpr std::size_t D = sizeof...(E);
+
+                static constexpr std::array<std::size_t, D> tiles = [] {
+                    constexpr std::array<std::size_t, sizeof...(Tiles)> sizes{Tiles...};
+                    std::array<std::size_t, D> tiles{};
+                    for (std::size_t d = 0; d < D; ++d)
+                        tiles[d] = sizes[sizeof...(Tiles) == 1 ? 0 : d];
+                    return tiles;
+                }();
+
+                // Distance between consecutive tiles, and between consecutive elements inside a tile
+                static constexpr std::array<std::size_t, D> tileStrides = [] {
+                    constexpr std::array<std::size_t, D> extents{E...};
+                    std::array<std::size_t, D> counts{};
+                    std::size_t volume = 1;
+                    for (std::size_t d = 0; d < D; ++d) {
+                        counts[d] = (extents[d] + tiles[d] - 1) / tiles[d];
+                        volume *= tiles[d];
+                    }
+                    auto strides = detail::rowMajorStrides(counts);
+                    for (auto &stride: strides)
+                        stride *= volume;
+                    return strides;
+                }();
+                static constexpr std::array<std::size_t, D> innerStrides = detail::rowMajorStrides(tiles);
+
+                static constexpr std::size_t size = [] {
+                    constexpr std::array<std::size_t, D> extents{E...};
+                    return tileStrides[0] * ((extents[0] + tiles[0] - 1) / tiles[0]);
+                }();
+
+                static constexpr std::size_t offset(const std::array<std::size_t, D> &index) noexcept {
+                    std::size_t offset = 0;
+                    for (std::size_t d = 0; d < D; ++d)
+                        offset += index[d] / tiles[d] * tileStrides[d] + index[d] % tiles[d] * innerStrides[d];
+                    return offset;
+                }
+            };
+        };
+
+        /***
+         * @brief Z-order curve, interleaving the bits of all indices so that elements close along any dimension
+         *        are close in memory at every scale. Each extent is padded up to the next power of two;
+         *        dimensions with fewer bits stop contributing once their bits are exhausted.
+         *        Offsets are read from tables of one entry per index, built at compile time.
+         */
+        struct Morton {
+            template<std::size_t... E>
+            struct Mapping {
+                static constexpr std::size_t D = sizeof...(E);
+
+                static constexpr std::array<std::size_t, D> bits = [] {
+                    constexpr std::array<std::size_t, D> extents{E...};
+                    std::array<std::size_t, D> bits{};
+                    for (std::size_t d = 0; d < D; ++d)
+                        while ((std::size_t{1} << bits[d]) < extents[d])
+                            ++bits[d];
+                    return bits;
+                }();
+
+                static constexpr std::size_t size = std::size_t{1} << [] {
+                    std::size_t total = 0;
+                    for (auto b: bits)
+                        total += b;
+                    return total;
+                }();
+
+                using entry_type = std::conditional_t<(size <= std::numeric_limits<std::uint32_t>::max()),
+                        std::uint32_t, std::size_t>;
+
+                // First entry of each dimension inside table
+                static constexpr std::array<std::size_t, D> bases = [] {
+                    constexpr std::array<std::size_t, D> extents{E...};
+                    std::array<std::size_t, D> bases{};
+                    for (std::size_t d = 1; d < D; ++d)
+                        bases[d] = bases[d - 1] + extents[d - 1];
+                    return bases;
+                }();
+
+                // Index of every dimension, with its bits moved to their position in the offset
+                static constexpr std::array<entry_type, (E + ...)> table = [] {
+                    constexpr std::array<std::size_t, D> extents{E...};
+                    std::array<entry_type, (E + ...)> table{};
+                    std::size_t position = 0;
+                    for (std::size_t bit = 0;; ++bit) {
+                        bool any = false;
+                        // the last dimension takes the lowest bit of each level, as in row-major order
+                        for (std::size_t d = D; d-- > 0;) {
+                            if (bit >= bits[d])
+                                continue;
+                            any = true;
+                            for (std::size_t i = 0; i < extents[d]; ++i)
+                                if ((i >> bit) & 1)
+                                    table[bases[d] + i] |= static_cast<entry_type>(entry_type{1} << position);
+                            ++position;
+                        }
+                        if (!any)
+                            break;
+                    }
+                    return table;
+                }();
+
+                static constexpr std::size_t offset(const std::array<std::size_t, D> &index) noexcept {
+                    std::size_t offset = 0;
+                    for (std::size_t d = 0; d < D; ++d)
+                        offset += table[bases[d] + index[d]];
+                    return offset;
+                }
+            };
+        };
+    };
+
+    namespace detail {
+
+        /***
+         * @brief Call fn with every combination of indices lower than extents, in row-major order
+         */
+        template<std::size_t L, std::size_t D, typename Fn, typename... I>
+        constexpr void forEachIndex(const std::array<std::size_t, D> &extents, Fn &fn, I... indices) {
+            for (std::size_t i = 0; i < extents[D - L]; ++i) {
+                if constexpr (L == 1)
+                    fn(indices..., i);
+                else
+                    forEachIndex<L - 1>(extents, fn, indices..., i);
+            }
+        }
+
+    }
+
+/***
+ * @brief Represent an array with a fixed size for each dimension, like DArray, storing its elements in the order
+ *        chosen by a Layout policy. Index mapping is resolved at compile time, and at() keeps the same
+ *        signature as DArray, hence code indexing a DArray works unchanged on any layout.
+ * @code
+ * mdc::DGrid<double, mdc::Layout::ColumnMajor, 1024, 1024> matrix(0.0);
+ * for (std::size_t j = 0; j < 1024; ++j)
+ *     for (std::size_t i = 0; i < 1024; ++i)
+ *         matrix(i, j) += 1.0;     // contiguous accesses
+ * @endcode
+ * @tparam T Type of the elements stored
+ * @tparam L Layout policy, e.g. Layout::Morton
+ * @tparam N Size of the outer-most dimension
+ * @tparam O Parameter pack of the following sizes
+ * @see Layout
+ */
+    template<typename T, typename L, std::size_t N, std::size_t... O>
+    class DGrid {
+    public:
+        using value_type = T;
+        using layout_type = L;
+        using mapping_type = typename L::template Mapping<N, O...>;
+        using shape_type = std::array<std::size_t, sizeof...(O) + 1>;
+
+    private:
+        // Total number of dimensions of DGrid
+        static constexpr std::size_t D = sizeof...(O) + 1;
+        static constexpr shape_type _shape{N, O...};
+
+        std::array<T, mapping_type::size> _data;
+
+        template<typename... Indices>
+        static constexpr std::size_t offsetOf(Indices... indices) {
+            const shape_type position{static_cast<std::size_t>(indices)...};
+            for (std::size_t d = 0; d < D; ++d)
+                if (position[d] >= _shape[d])
+                    throw std::out_of_range(
+                            "DGrid::at: index " + std::to_string(position[d]) + " of dimension " +
+                            std::to_string(d) + " is out of range (extent=" + std::to_string(_shape[d]) + ")");
+            return mapping_type::offset(position);
+        }
+
+        template<typename... Indices>
+        static constexpr std::size_t uncheckedOffsetOf(Indices... indices) noexcept {
+            const shape_type position{static_cast<std::size_t>(indices)...};
+            for (std::size_t d = 0; d < D; ++d)
+                mdc::BoundsCheck::Default::check(position[d], _shape[d]);
+            return mapping_type::offset(position);
+        }
+
+    public:
+        DGrid() = default;
+
+        /***
+         * @brief Constructor with every element initialized to the same value
+         * @param value Value copied into each element
+         */
+        constexpr explicit DGrid(const T &value) : _data() {
+            _data.fill(value);
+        }
+
+        /***
+         * @brief Constructor of elements computed from their indices
+         * @param generator Function called with the D indices of each element, in row-major order,
+         *                  returning its value
+         */
+        template<typename Fn>
+        constexpr explicit DGrid(Fn generator) requires detail::Generator<Fn, T, D> : _data() {
+            auto assign = [this, &generator](auto... indices) {
+                _data[mapping_type::offset({indices...})] = generator(indices...);
+            };
+            detail::forEachIndex<D>(_shape, assign);
+        }
+
+        /***
+         * @brief Construct DGrid as copy of a DArray with the same shape, rearranging its elements
+         * @param dArray DArray to be copied
+         */
+        constexpr explicit DGrid(const DArray<T, N, O...> &dArray) : _data() {
+            auto assign = [this, &dArray](auto... indices) {
+                _data[mapping_type::offset({indices...})] = dArray(indices...);
+            };
+            detail::forEachIndex<D>(_shape, assign);
+        }
+
+        /***
+         * @brief Convert DGrid into a DArray with the same shape, i.e. in row-major order
+         */
+        constexpr explicit operator DArray<T, N, O...>() const {
+            DArray<T, N, O...> dArray;
+            auto assign = [this, &dArray](auto... indices) {
+                dArray(indices...) = _data[mapping_type::offset({indices...})];
+            };
+            detail::forEachIndex<D>(_shape, assign);
+            return dArray;
+        }
+
+        /***
+         * @brief Get a reference to a specific element held by DGrid, specifying its position.
+         * @param index Index of the higher (i.e. left-most) dimension
+         * @param indices Parameter pack of the indices for the lower dimensions of the element
+         * @return Reference to the requested element
+         * @throws std::out_of_range If any index is not lower than the extent of its dimension
+         */
+        template<std::integral Idx, std::integral... Indices>
+        constexpr T &at(Idx index, Indices... indices) requires (sizeof...(Indices) == D - 1) {
+            return _data[offsetOf(index, indices...)];
+        }
+
+        /***
+         * @see DGrid<T,L,N,O...>::at(Idx index, Indices... indices)
+         * @return Constant reference to the requested element
+         */
+        template<std::integral Idx, std::integral... Indices>
+        constexpr const T &at(Idx index, Indices... indices) const requires (sizeof...(Indices) == D - 1) {
+            return _data[offsetOf(index, indices...)];
+        }
+
+        /***
+         * @brief Get a reference to a specific element held by DGrid, without throwing on invalid indices.
+         *        Indices are validated according to BoundsCheck::Default, i.e. only in debug builds by default.
+         * @param index Index of the higher (i.e. left-most) dimension
+         * @param indices Parameter pack of the indices for the lower dimensions of the element
+         * @return Reference to the requested element
+         * @see BoundsCheck
+         */
+        template<std::integral Idx, std::integral... Indices>
+        constexpr T &operator()(Idx index, Indices... indices) noexcept requires (sizeof...(Indices) == D - 1) {
+            return _data[uncheckedOffsetOf(index, indices...)];
+        }
+
+        /***
+         * @see DGrid<T,L,N,O...>::operator()(Idx index, Indices... indices)
+         * @return Constant reference to the requested element
+         */
+        template<std::integral Idx, std::integral... Indices>
+        constexpr const T &operator()(Idx index, Indices... indices) const noexcept
+        requires (sizeof...(Indices) == D - 1) {
+            return _data[uncheckedOffsetOf(index, indices...)];
+        }
+
+        /***
+         * @brief Assign the same value to every element
+         * @param value Value copied into each element
+         */
+        constexpr void fill(const T &value) {
+            _data.fill(value);
+        }
+
+        /***
+         * @return Number of sub-arrays (or elements) of the outer-most dimension
+         */
+        static constexpr std::size_t size() noexcept {
+            return N;
+        }
+
+        /***
+         * @return Extent of each dimension, starting from the higher (i.e. left-most) one
+         */
+        static constexpr const shape_type &shape() noexcept {
+            return _shape;
+        }
+
+        /***
+         * @param dim Dimension queried, where 0 is the higher (i.e. left-most) one
+         * @return Number of elements along dimension dim
+         */
+        static constexpr std::size_t extent(std::size_t dim) {
+            return _shape.at(dim);
+        }
+
+        /***
+         * @return Number of elements of DGrid, excluding any padding of its layout
+         */
+        static constexpr std::size_t total() noexcept {
+            return (N * ... * O);
+        }
+
+        /***
+         * @return Pointer to the first element stored, in the order of the layout
+         */
+        constexpr T *data() noexcept {
+            return _data.data();
+        }
+
+        /***
+         * @see DGrid<T,L,N,O...>::data()
+         */
+        constexpr const T *data() const noexcept {
+            return _data.data();
+        }
+
+        /***
+         * @return Contiguous range over the whole storage, in the order of the layout.
+         *         Padded layouts (Tiled, Morton) also expose their padding elements, which are not part of DGrid.
+         */
+        constexpr std::span<T, mapping_type::size> storage() noexcept {
+            return _data;
+        }
+
+        /***
+         * @see DGrid<T,L,N,O...>::storage()
+         */
+        constexpr std::span<const T, mapping_type::size> storage() const noexcept {
+            return _data;
+        }
+
+        /***
+         * @return true iff all elements are equal, ignoring padding
+         */
+        constexpr bool operator==(const DGrid &other) const {
+            bool equal = true;
+            auto compare = [&](auto... indices) {
+                const auto offset = mapping_type::offset({indices...});
+                equal = equal && _data[offset] == other._data[offset];
+            };
+            detail::forEachIndex<D>(_shape, compare);
+            return equal;
+        }
+    };
+
+    namespace detail {
+
+        template<typename G, std::size_t... K, typename... I>
+        void formatGrid(Formatter &formatter, const G &grid, std::index_sequence<K...>, I... indices) {
+            constexpr std::size_t level = sizeof...(I);
+            constexpr std::size_t remaining = G::shape().size() - level;
+            const auto extent = G::shape()[level];
+            if constexpr (remaining == 1)
+                formatter.row(extent, [&](std::size_t i) -> decltype(auto) { return grid(indices..., i); });
+            else if constexpr (remaining == 2)
+                formatter.matrix(extent, [&](std::size_t i) {
+                    formatGrid(formatter, grid, std::index_sequence<K...>(), indices..., i);
+                });
+            else
+                formatter.block("DGrid", {G::shape()[level + K]...}, extent, [&](std::size_t i) {
+                    formatGrid(formatter, grid, std::make_index_sequence<remaining - 1>(), indices..., i);
+                });
+        }
+
+    }
+
+    /***
+     * @brief Write a DGrid through a Formatter, with the same layout used for DArrays of equal shape
+     * @see Formatter
+     */
+    template<typename T, typename L, std::size_t N, std::size_t... O>
+    Formatter &operator<<(Formatter &formatter, const DGrid<T, L, N, O...> &grid) {
+        detail::formatGrid(formatter, grid, std::make_index_sequence<sizeof...(O) + 1>());
+        return formatter;
+    }
+
+    /***
+     * @brief Print function for DGrids, with the same format used for DArrays of equal shape
+     * @see operator<<(std::ostream &, const DArray<U,M,P...> &)
+     */
+    template<typename T, typename L, std::size_t N, std::size_t... O>
+    std::ostream &operator<<(std::ostream &os, const DGrid<T, L, N, O...> &grid) {
+        return detail::print(os, grid);
+    }
+
+}
+
+
+#endif //DCONTAINERS_LAYOUT_HPP
@@ -0,0 +1,374 @@
+/*
+ *   Copyright 2022 Alberto Guarnieri
+ *
+ *   Licensed under the Apache License, Version 2.0 (the "License");
+ *   you may not use this file except in compliance with the License.
+ *   You may obtain a copy of the License at
+ *
+ *       http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *   Unless required by applicable law or agreed to in writing, software
+ *   distributed under the License is distributed on an "AS IS" BASIS,
+ *   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *   See the License for the specific language governing permissions and
+ *   limitations under the License.
+ */
+
+#ifndef DCONTAINERS_MAPPED_HPP
+#define DCONTAINERS_MAPPED_HPP
+
+
+#include <algorithm>
+#include <array>
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <new>
+#include <span>
+#include <string>
+#include <system_error>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "DContainers/DArray.hpp"
+#include "DContainers/JaggedDVector.hpp"
+#include "DContainers/Serialization.hpp"
+
+#if defined(DCONTAINERS_POSIX_IO) && __has_include(<sys/mman.h>)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#define DCONTAINERS_MMAP
+
+
+namespace mdc {
+
+    namespace io::detail {
+
+        /***
+         * @brief Shared mapping of a whole file, unmapped on destruction
+         */
+        class Mapping {
+        private:
+            std::byte *_data = nullptr;
+            std::size_t _size = 0;
+
+            [[noreturn]] static void fail(const char *what) {
+                throw std::system_error(errno, std::generic_category(), std::string("mdc::io: ") + what);
+            }
+
+        public:
+            Mapping(const std::filesystem::path &path, bool writable) {
+                const int fd = ::open(path.c_str(), writable ? O_RDWR : O_RDONLY);
+                if (fd < 0)
+                    fail("open failed");
+                struct ::stat status{};
+                if (::fstat(fd, &status) != 0) {
+                    const int error = errno;
+                    ::close(fd);
+                    errno = error;
+                    fail("fstat failed");
+                }
+                _size = static_cast<std::size_t>(status.st_size);
+                if (_size < fixedHeaderSize) {
+                    ::close(fd);
+                    corrupted("not a serialized container");
+                }
+                void *data = ::mmap(nullptr, _size, writable ? PROT_READ | PROT_WRITE : PROT_READ, MAP_SHARED, fd, 0);
+                // the mapping keeps its own reference to the file
+                const int error = errno;
+                ::close(fd);
+                if (data == MAP_FAILED) {
+                    errno = error;
+                    fail("mmap failed");
+                }
+                _data = static_cast<std::byte *>(data);
+            }
+
+            Mapping(Mapping &&other) noexcept
+                    : _data(std::exchange(other._data, nullptr)), _size(std::exchange(other._size, 0)) {}
+
+            Mapping &operator=(Mapping &&other) noexcept {
+                std::swap(_data, other._data);
+                std::swap(_size, other._size);
+                return *this;
+            }
+
+            ~Mapping() {
+                if (_data)
+                    ::munmap(_data, _size);
+            }
+
+            std::byte *data() const noexcept {
+                return _data;
+            }
+
+            std::size_t size() const noexcept {
+                return _size;
+            }
+
+            void sync() const {
+                if (_data && ::msync(_data, _size, MS_SYNC) != 0)
+                    fail("msync failed");
+            }
+        };
+
+        /***
+         * @brief Decode the header of a mapped file, checking that its payload can be accessed in place as T
+         */
+        template<typename T>
+        Header mappedHeader(const Mapping &mapping, std::size_t rank) {
+            MemorySource source(mapping.data(), mapping.size());
+            auto header = decode(source);
+            expect<T>(header, rank);
+            if (header.swapped && sizeof(T) > 1)
+                corrupted("elements written with the opposite byte order cannot be mapped");
+            static_assert(alignof(T) <= payloadAlignment, "Elements are over-aligned for the payload");
+            if (header.count > (mapping.size() - header.payloadOffset) / sizeof(T))
+                corrupted("file is shorter than its payload");
+            return header;
+        }
+
+    }
+
+/***
+ * @brief DArray stored in a file written by mdc::io::write, accessed in place through a shared memory mapping.
+ *        Opening a file only validates its header: elements are loaded lazily by the OS when first accessed,
+ *        hence files larger than the available memory can be used, and their pages are shared by every process
+ *        mapping the same file.
+ * @code
+ * mdc::MappedDArray<const float, 4096, 4096> grid("grid.mdc");  // read-only
+ * float value = grid.at(10, 20);
+ * mdc::DArray<float, 2, 4096> rows = grid.at(mdc::Span::of<0, 1>(), mdc::Span::all());
+ * @endcode
+ * @tparam T Type of the elements stored, const-qualified to map the file read-only
+ * @tparam N Size of the higher dimension
+ * @tparam O Sizes of the lower dimensions
+ * @see MappedDVector
+ */
+    template<typename T, std::size_t N, std::size_t... O>
+    class MappedDArray {
+    public:
+        using value_type = std::remove_const_t<T>;
+        using array_type = std::conditional_t<std::is_const_v<T>, const DArray<value_type, N, O...>,
+                DArray<value_type, N, O...>>;
+
+    private:
+        io::detail::Mapping _mapping;
+        array_type *_array;
+
+    public:
+        /***
+         * @brief Map a file holding a DArray of the same element type and shape
+         * @param path File written by mdc::io::write
+         * @throws std::system_error If the file cannot be opened or mapped, or T is not const and the file is read-only
+         * @throws std::runtime_error If the file does not hold a dense container of the same element type and shape,
+         *                            or it was written with the opposite byte order
+         */
+        explicit MappedDArray(const std::filesystem::path &path) : _mapping(path, !std::is_const_v<T>), _array() {
+            const auto header = io::detail::mappedHeader<value_type>(_mapping, sizeof...(O) + 1);
+            constexpr std::array<std::uint64_t, sizeof...(O) + 1> shape{N, O...};
+            if (header.layout != io::Layout::Dense || !std::equal(shape.begin(), shape.end(), header.shape.begin()))
+                io::detail::corrupted("shape does not match");
+            _array = std::launder(reinterpret_cast<array_type *>(_mapping.data() + header.payloadOffset));
+        }
+
+        /***
+         * @return Reference to the mapped DArray, const-qualified if T is const
+         */
+        array_type &get() const noexcept {
+            return *_array;
+        }
+
+        array_type &operator*() const noexcept {
+            return *_array;
+        }
+
+        array_type *operator->() const noexcept {
+            return _array;
+        }
+
+        /***
+         * @brief Same as DArray<T,N,O...>::at(), reading directly from the mapping
+         * @see DArray<T,N,O...>::at(Idx index, Indices... indices)
+         */
+        template<typename... Args>
+        decltype(auto) at(Args... args) const {
+            return get().at(args...);
+        }
+
+        /***
+         * @see DArray<T,N,O...>::operator()(Idx index, Indices... indices)
+         */
+        template<typename... Args>
+        decltype(auto) operator()(Args... args) const noexcept {
+            return get()(args...);
+        }
+
+        /***
+         * @see DArray<T,N,O...>::view()
+         */
+        template<typename... Args>
+        auto view(Args... args) const {
+            return get().view(args...);
+        }
+
+        /***
+         * @return Number of elements mapped
+         */
+        static constexpr std::size_t total() noexcept {
+            return (N * ... * O);
+        }
+
+        T *flat_begin() const noexcept {
+            return get().flat_begin();
+        }
+
+        T *flat_end() const noexcept {
+            return get().flat_end();
+        }
+
+        /***
+         * @brief Flush modified elements to the file, blocking until they are written
+         * @throws std::system_error If flushing fails
+         */
+        void sync() const requires (!std::is_const_v<T>) {
+            _mapping.sync();
+        }
+    };
+
+/***
+ * @brief Jagged vector stored in a file written by mdc::io::write, accessed in place through a shared memory mapping.
+ *        Elements are never copied nor loaded up front; only the offsets of the outer levels are validated and kept
+ *        in memory, taking space proportional to the number of sub-vectors, not of elements.
+ *        Files of any layout can be mapped, hence DVector, JaggedDVector, DTensor and DArray snapshots alike.
+ * @code
+ * mdc::MappedDVector<3, const double> lookup("lookup.mdc");      // read-only
+ * double value = lookup.at(1, 2, 3);
+ * mdc::JaggedView<2, const double> plane = lookup.at(1);
+ * @endcode
+ * @tparam D Vector dimension
+ * @tparam T Type of the elements stored, const-qualified to map the file read-only
+ * @see MappedDArray
+ * @see JaggedView
+ */
+    template<std::size_t D, typename T>
+    class MappedDVector {
+    public:
+        using value_type = std::remove_const_t<T>;
+        using iterator = typename JaggedView<D, T>::iterator;
+
+    private:
+        io::detail::Mapping _mapping;
+        T *_values;
+        std::size_t _size;
+        std::array<std::vector<std::size_t>, D - 1> _offsets;
+
+    public:
+        /***
+         * @brief Map a file holding a container of the same element type and dimension
+         * @param path File written by mdc::io::write
+         * @throws std::system_error If the file cannot be opened or mapped, or T is not const and the file is read-only
+         * @throws std::runtime_error If the file does not hold a container of the same element type and dimension,
+         *                            or it was written with the opposite byte order
+         */
+        explicit MappedDVector(const std::filesystem::path &path)
+                : _mapping(path, !std::is_const_v<T>), _values(), _size(), _offsets() {
+            const auto header = io::detail::mappedHeader<value_type>(_mapping, D);
+            const auto levels = io::detail::jaggedOffsets(header);
+            for (std::size_t l = 0; l < D - 1; ++l)
+                _offsets[l].assign(levels[l].begin(), levels[l].end());
+            _size = D == 1 ? header.count : _offsets.front().size() - 1;
+            _values = std::launder(reinterpret_cast<value_type *>(_mapping.data() + header.payloadOffset));
+        }
+
+        /***
+         * @brief View the whole mapped vector
+         * @return View over all elements, read-only if T is const
+         */
+        JaggedView<D, T> view() const noexcept {
+            typename JaggedView<D, T>::offsets_type pointers{};
+            for (std::size_t l = 0; l < D - 1; ++l)
+                pointers[l] = _offsets[l].data();
+            return {_values, pointers, 0, _size};
+        }
+
+        /***
+         * @brief Same as JaggedDVector<D,T>::at(), reading directly from the mapping
+         * @see JaggedView<D,T>::at(Idx index, Indices... indices)
+         * @see JaggedView<D,T>::at(J span, K... spans)
+         */
+        template<typename... Args>
+        decltype(auto) at(Args... args) const {
+            return view().at(args...);
+        }
+
+        /***
+         * @see JaggedView<D,T>::operator()(Idx index, Indices... indices)
+         */
+        template<typename... Args>
+        decltype(auto) operator()(Args... args) const noexcept {
+            return view()(args...);
+        }
+
+        iterator begin() const noexcept {
+            return view().begin();
+        }
+
+        iterator end() const noexcept {
+            return view().end();
+        }
+
+        /***
+         * @return Number of sub-vectors (or elements) of the outer-most dimension
+         */
+        std::size_t size() const noexcept {
+            return _size;
+        }
+
+        bool empty() const noexcept {
+            return _size == 0;
+        }
+
+        /***
+         * @return Number of elements mapped
+         */
+        std::size_t total() const noexcept {
+            if constexpr (D == 1)
+                return _size;
+            else
+                return _offsets.back().back();
+        }
+
+        /***
+         * @return Contiguous range over all elements mapped, in row-major order
+         */
+        std::span<T> elements() const noexcept {
+            return {_values, total()};
+        }
+
+        T *flat_begin() const noexcept {
+            return _values;
+        }
+
+        T *flat_end() const noexcept {
+            return _values + total();
+        }
+
+        /***
+         * @brief Flush modified elements to the file, blocking until they are written
+         * @throws std::system_error If flushing fails
+         */
+        void sync() const requires (!std::is_const_v<T>) {
+            _mapping.sync();
+        }
+    };
+
+}
+
+#endif
+
+
+#endif //DCONTAINERS_MAPPED_HPP
@@ -0,0 +1,182 @@
+/*
+ *   Copyright 2022 Alberto Guarnieri
+ *
+ *   Licensed under the Apache License, Version 2.0 (the "License");
+ *   you may not use this file except in compliance with the License.
+ *   You may obtain a copy of the License at
+ *
+ *       http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *   Unless required by applicable law or agreed to in writing, software
+ *   distributed under the License is distributed on an "AS IS" BASIS,
+ *   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *   See the License for the specific language governing permissions and
+ *   limitations under the License.
+ */
+
+#ifndef DCONTAINERS_MDSPAN_HPP
+#define DCONTAINERS_MDSPAN_HPP
+
+
+#include <array>
+#include <cstddef>
+#include <new>
+#include <type_traits>
+
+#include "DContainers/DArray.hpp"
+#include "DContainers/DTensor.hpp"
+#include "DContainers/DView.hpp"
+#include "DContainers/Layout.hpp"
+
+#if __has_include(<mdspan>)
+#include <mdspan>
+#endif
+#if !defined(__cpp_lib_mdspan) && __has_include(<experimental/mdspan>)
+#include <experimental/mdspan>
+#endif
+
+// std::mdspan of C++23, or else the reference implementation (https://github.com/kokkos/mdspan)
+#if defined(__cpp_lib_mdspan) || __has_include(<experimental/mdspan>)
+#define DCONTAINERS_MDSPAN
+
+
+namespace mdc {
+
+    namespace detail::md {
+#if defined(__cpp_lib_mdspan)
+        using std::mdspan, std::extents, std::dextents, std::dynamic_extent,
+                std::layout_right, std::layout_left, std::layout_stride, std::default_accessor;
+#else
+        using std::experimental::mdspan, std::experimental::extents, std::experimental::dextents,
+                std::experimental::dynamic_extent, std::experimental::layout_right, std::experimental::layout_left,
+                std::experimental::layout_stride, std::experimental::default_accessor;
+#endif
+    }
+
+    /***
+     * @brief View a DArray as an mdspan with static extents, without copying any element
+     * @code
+     * mdc::DArray<float, 64, 64> grid;
+     * std::mdspan<float, std::extents<std::size_t, 64, 64>> span = mdc::to_mdspan(grid);
+     * @endcode
+     * @param dArray DArray viewed
+     * @return mdspan over the elements of dArray, in row-major order (layout_right)
+     */
+    template<typename T, std::size_t N, std::size_t... O>
+    auto to_mdspan(DArray<T, N, O...> &dArray) noexcept {
+        return detail::md::mdspan<T, detail::md::extents<std::size_t, N, O...>>(dArray.flat_begin());
+    }
+
+    /***
+     * @see to_mdspan(DArray<T,N,O...> &)
+     * @return Read-only mdspan over the elements of dArray
+     */
+    template<typename T, std::size_t N, std::size_t... O>
+    auto to_mdspan(const DArray<T, N, O...> &dArray) noexcept {
+        return detail::md::mdspan<const T, detail::md::extents<std::size_t, N, O...>>(dArray.flat_begin());
+    }
+
+    /***
+     * @brief View a DTensor as an mdspan with dynamic extents, without copying any element
+     * @param dTensor DTensor viewed
+     * @return mdspan over the elements of dTensor, in row-major order (layout_right)
+     */
+    template<std::size_t D, typename T>
+    auto to_mdspan(DTensor<D, T> &dTensor) noexcept {
+        return detail::md::mdspan<T, detail::md::dextents<std::size_t, D>>(dTensor.data(), dTensor.shape());
+    }
+
+    /***
+     * @see to_mdspan(DTensor<D,T> &)
+     * @return Read-only mdspan over the elements of dTensor
+     */
+    template<std::size_t D, typename T>
+    auto to_mdspan(const DTensor<D, T> &dTensor) noexcept {
+        return detail::md::mdspan<const T, detail::md::dextents<std::size_t, D>>(dTensor.data(), dTensor.shape());
+    }
+
+    /***
+     * @brief Express a DView as an mdspan with dynamic extents, keeping the same strides
+     * @param view View converted, e.g. a sliced or transposed one
+     * @return mdspan over the same elements of view (layout_stride)
+     */
+    template<std::size_t D, typename T>
+    auto to_mdspan(const DView<D, T> &view) {
+        using Extents = detail::md::dextents<std::size_t, D>;
+        using Mapping = typename detail::md::layout_stride::template mapping<Extents>;
+        return detail::md::mdspan<T, Extents, detail::md::layout_stride>(
+                view.data(), Mapping(Extents(view.shape()), view.strides()));
+    }
+
+    /***
+     * @brief View a row-major DGrid as an mdspan with static extents (layout_right)
+     */
+    template<typename T, std::size_t N, std::size_t... O>
+    auto to_mdspan(DGrid<T, Layout::RowMajor, N, O...> &grid) noexcept {
+        return detail::md::mdspan<T, detail::md::extents<std::size_t, N, O...>, detail::md::layout_right>(
+                grid.data());
+    }
+
+    /***
+     * @brief View a column-major DGrid as an mdspan with static extents (layout_left)
+     */
+    template<typename T, std::size_t N, std::size_t... O>
+    auto to_mdspan(DGrid<T, Layout::ColumnMajor, N, O...> &grid) noexcept {
+        return detail::md::mdspan<T, detail::md::extents<std::size_t, N, O...>, detail::md::layout_left>(
+                grid.data());
+    }
+
+    /***
+     * @brief Wrap an mdspan in a DView, to access its elements through at() and Span objects without copying them.
+     *        Any layout with a constant stride for each dimension is supported, i.e. layout_right, layout_left
+     *        and layout_stride.
+     * @code
+     * void kernel(std::mdspan<double, std::dextents<std::size_t, 2>> input) {
+     *     mdc::DView<2, double> view = mdc::from_mdspan(input);
+     *     auto border = view.at(mdc::Span::all(), mdc::Span::of(0));
+     * }
+     * @endcode
+     * @param span mdspan wrapped, using the default accessor
+     * @return View over the elements of span, with the same extents and strides
+     */
+    template<typename T, typename Extents, typename LayoutPolicy>
+    DView<Extents::rank(), T> from_mdspan(
+            const detail::md::mdspan<T, Extents, LayoutPolicy, detail::md::default_accessor<T>> &span) {
+        static_assert(Extents::rank() > 0, "DView must have at least one dimension");
+        static_assert(LayoutPolicy::template mapping<Extents>::is_always_strided(),
+                      "Only layouts with a constant stride for each dimension can be viewed");
+        std::array<std::size_t, Extents::rank()> shape{}, strides{};
+        for (std::size_t r = 0; r < Extents::rank(); ++r) {
+            shape[r] = static_cast<std::size_t>(span.extent(r));
+            strides[r] = static_cast<std::size_t>(span.stride(r));
+        }
+        return {span.data_handle(), shape, strides};
+    }
+
+    /***
+     * @brief Access the elements of an mdspan with static extents and row-major layout as a DArray,
+     *        without copying them, hence with the whole interface of DArray
+     * @code
+     * std::mdspan<float, std::extents<std::size_t, 4, 4>> matrix(buffer);
+     * mdc::DArray<float, 4, 4> &dArray = mdc::as_darray(matrix);
+     * @endcode
+     * @param span mdspan over contiguous elements in row-major order (layout_right), using the default accessor
+     * @return Reference to a DArray placed over the elements of span, const if T is const
+     * @warning The reference does not extend the lifetime of the elements referred by span
+     */
+    template<typename T, typename I, std::size_t N, std::size_t... O>
+    auto &as_darray(const detail::md::mdspan<T, detail::md::extents<I, N, O...>, detail::md::layout_right,
+            detail::md::default_accessor<T>> &span) noexcept
+    requires (N != detail::md::dynamic_extent) && ((O != detail::md::dynamic_extent) && ...) {
+        using Array = std::conditional_t<std::is_const_v<T>, const DArray<std::remove_const_t<T>, N, O...>,
+                DArray<std::remove_const_t<T>, N, O...>>;
+        static_assert(sizeof(Array) == sizeof(T) * (N * ... * O), "DArray elements must be contiguous");
+        return *std::launder(reinterpret_cast<Array *>(span.data_handle()));
+    }
+
+}
+
+#endif
+
+
+#endif //DCONTAINERS_MDSPAN_HPP
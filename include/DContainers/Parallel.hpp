@@ -0,0 +1,330 @@
+/*
+ *   Copyright 2022 Alberto Guarnieri
+ *
+ *   Licensed under the Apache License, Version 2.0 (the "License");
+ *   you may not use this file except in compliance with the License.
+ *   You may obtain a copy of the License at
+ *
+ *       http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *   Unless required by applicable law or agreed to in writing, software
+ *   distributed under the License is distributed on an "AS IS" BASIS,
+ *   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *   See the License for the specific language governing permissions and
+ *   limitations under the License.
+ */
+
+
+#ifndef DCONTAINERS_PARALLEL_HPP
+#define DCONTAINERS_PARALLEL_HPP
+
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <optional>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#ifdef DCONTAINERS_STD_EXECUTION
+#include <execution>
+#include <numeric>
+#endif
+
+#include "DContainers/DArray.hpp"
+#include "DContainers/DVector.hpp"
+#include "DContainers/ThreadPool.hpp"
+
+
+namespace mdc::parallel {
+
+    namespace detail {
+
+        template<typename C>
+        struct Traits;
+
+        template<typename T, std::size_t N, std::size_t... O>
+        struct Traits<DArray<T, N, O...>> {
+            using element_type = T;
+            static constexpr std::size_t rank = sizeof...(O) + 1;
+            static constexpr bool jagged = false;
+
+            template<typename U>
+            using rebind = DArray<U, N, O...>;
+        };
+
+        template<std::size_t D, typename T, typename Allocator>
+        struct Traits<DVector<D, T, Allocator>> {
+            using element_type = T;
+            static constexpr std::size_t rank = D;
+            static constexpr bool jagged = true;
+
+            template<typename U>
+            using rebind = DVector<D, U, typename std::allocator_traits<Allocator>::template rebind_alloc<U>>;
+        };
+
+        /***
+         * @brief DArray or DVector, split across threads by the parallel algorithms
+         */
+        template<typename C>
+        concept Partitionable = requires { typename Traits<std::remove_cvref_t<C>>::element_type; };
+
+        template<std::size_t D>
+        using Cursor = std::array<std::size_t, D>;
+
+        // Minimum number of elements processed by a single task
+        inline constexpr std::size_t minimumGrain = 4096;
+
+        // Number of tasks created for each thread, so that faster threads can steal the remaining ones
+        inline constexpr std::size_t tasksPerThread = 8;
+
+        /***
+         * @brief Collect the positions where a container is cut, so that each task holds grain elements.
+         *        Sub-containers that end before the next cut are skipped as a whole, using their total(),
+         *        so that only the sub-containers holding a cut are descended into.
+         */
+        template<std::size_t D, std::size_t L, typename Node>
+        void cut(const Node &node, Cursor<D> &cursor, std::size_t &count, std::size_t grain,
+                 std::vector<Cursor<D>> &cuts) {
+            constexpr std::size_t level = D - L;
+            const std::size_t size = node.size();
+            if constexpr (L == 1) {
+                std::size_t position = 0;
+                while (count + (size - position) >= grain) {
+                    position += grain - count;
+                    cursor[level] = position;
+                    cuts.push_back(cursor);
+                    count = 0;
+                }
+                count += size - position;
+            } else {
+                for (std::size_t i = 0; i < size; ++i) {
+                    cursor[level] = i;
+                    const std::size_t total = node[i].total();
+                    if (count + total < grain)
+                        count += total;
+                    else
+                        cut<D, L - 1>(node[i], cursor, count, grain, cuts);
+                }
+            }
+        }
+
+        /***
+         * @brief Visit, in row-major order, all elements between two positions of containers with the same shape
+         * @param lo First position visited, nullptr to start from the first element
+         * @param hi Position past the last one visited, nullptr to continue up to the last element
+         * @param index Position of the element visited
+         * @param fn Function called with the position and the elements of each node at that position
+         */
+        template<std::size_t D, std::size_t L, typename Fn, typename Node, typename... Nodes>
+        void walk(const std::size_t *lo, const std::size_t *hi, Cursor<D> &index, Fn &fn,
+                  Node &node, Nodes &... nodes) {
+            constexpr std::size_t level = D - L;
+            const std::size_t size = node.size();
+            const std::size_t from = lo ? lo[0] : 0, to = hi ? std::min(hi[0], size) : size;
+            if constexpr (L == 1) {
+                for (std::size_t i = from; i < to; ++i) {
+                    index[level] = i;
+                    fn(index, node[i], nodes[i]...);
+                }
+            } else {
+                for (std::size_t i = from; i < to; ++i) {
+                    index[level] = i;
+                    walk<D, L - 1>(lo && i == from ? lo + 1 : nullptr, nullptr, index, fn, node[i], nodes[i]...);
+                }
+                if (hi && hi[0] < size) {
+                    index[level] = hi[0];
+                    walk<D, L - 1>(lo && hi[0] == from ? lo + 1 : nullptr, hi + 1, index, fn,
+                                   node[hi[0]], nodes[hi[0]]...);
+                }
+            }
+        }
+
+        template<typename Fn>
+        void runTasks(ThreadPool &pool, std::size_t count, Fn &&fn) {
+#ifdef DCONTAINERS_STD_EXECUTION
+            (void) pool;
+            std::vector<std::size_t> tasks(count);
+            std::iota(tasks.begin(), tasks.end(), std::size_t{0});
+            std::for_each(std::execution::par, tasks.begin(), tasks.end(), fn);
+#else
+            pool.run(count, std::forward<Fn>(fn));
+#endif
+        }
+
+        /***
+         * @brief Positions where a container is cut into tasks holding the same number of elements
+         */
+        template<std::size_t D>
+        struct Partition {
+            std::vector<Cursor<D>> cuts;
+
+            std::size_t tasks() const noexcept {
+                return cuts.size() + 1;
+            }
+        };
+
+        template<typename Node>
+        auto partitionOf(const Node &node, std::size_t tasks) {
+            constexpr std::size_t D = Traits<std::remove_cv_t<Node>>::rank;
+            const std::size_t total = node.total();
+            const std::size_t grain = std::max(total / std::max(tasks, std::size_t{1}), minimumGrain);
+
+            Partition<D> partition;
+            Cursor<D> cursor{};
+            std::size_t count = 0;
+            if (total > grain)
+                cut<D, D>(node, cursor, count, grain, partition.cuts);
+            return partition;
+        }
+
+        /***
+         * @brief Visit in parallel containers with the same shape, one task for each part of a partition
+         * @param fn Function called with the index of the task, the position and the elements at that position
+         */
+        template<std::size_t D, typename Fn, typename... Nodes>
+        void visit(ThreadPool &pool, const Partition<D> &partition, Fn &&fn, Nodes &... nodes) {
+            const auto &cuts = partition.cuts;
+            runTasks(pool, partition.tasks(), [&](std::size_t task) {
+                Cursor<D> index{};
+                auto visitor = [&fn, task](const Cursor<D> &position, auto &... elements) {
+                    fn(task, position, elements...);
+                };
+                walk<D, D>(task > 0 ? cuts[task - 1].data() : nullptr,
+                           task < cuts.size() ? cuts[task].data() : nullptr, index, visitor, nodes...);
+            });
+        }
+
+        /***
+         * @brief Empty container of type Output, using the allocator of a DVector (rebound) or nothing for a DArray
+         */
+        template<typename Output, typename C>
+        Output emptyLike(const C &container) {
+            if constexpr (Traits<C>::jagged)
+                return Output(typename Output::allocator_type(container.get_allocator()));
+            else
+                return Output{};
+        }
+
+        template<typename Output, typename Input>
+        void reshape(Output &output, const Input &input) {
+            output.resize(input.size());
+            if constexpr (Traits<Input>::rank > 1)
+                for (std::size_t i = 0; i < input.size(); ++i)
+                    reshape(output[i], input[i]);
+        }
+
+        inline std::size_t defaultTasks(const ThreadPool &pool) {
+            return (pool.size() + 1) * tasksPerThread;
+        }
+
+    }
+
+    /***
+     * @brief Apply a function to every element of a DArray or DVector, in parallel.
+     *        Elements are split into tasks holding the same number of elements, following the outer-most dimension
+     *        and descending into the sub-vectors too large for a single task, so that jagged DVectors stay balanced.
+     * @param container DArray or DVector whose elements are visited
+     * @param fn Function called with a reference to each element
+     * @param pool Pool executing the tasks
+     */
+    template<detail::Partitionable C, typename Fn>
+    void for_each(C &container, Fn fn, ThreadPool &pool = ThreadPool::instance()) {
+        detail::visit(pool, detail::partitionOf(container, detail::defaultTasks(pool)),
+                      [&fn](std::size_t, const auto &, auto &element) { fn(element); }, container);
+    }
+
+    /***
+     * @brief Apply a function to every element of a DArray or DVector, along with its position, in parallel
+     * @param container DArray or DVector whose elements are visited
+     * @param fn Function called with the indices of each element, as a std::array, and a reference to the element
+     * @param pool Pool executing the tasks
+     * @see for_each(C &container, Fn fn, ThreadPool &pool)
+     */
+    template<detail::Partitionable C, typename Fn>
+    void for_each_indexed(C &container, Fn fn, ThreadPool &pool = ThreadPool::instance()) {
+        detail::visit(pool, detail::partitionOf(container, detail::defaultTasks(pool)),
+                      [&fn](std::size_t, const auto &index, auto &element) { fn(index, element); }, container);
+    }
+
+    /***
+     * @brief Create a container with the same shape, holding the result of a function applied to each element
+     * @param container DArray or DVector transformed
+     * @param fn Function called with a constant reference to each element
+     * @param pool Pool executing the tasks
+     * @return DArray or DVector with the same shape of container
+     * @note Sub-vectors of the resulting DVector are allocated before splitting the work across threads
+     */
+    template<detail::Partitionable C, typename Fn>
+    auto transform(const C &container, Fn fn, ThreadPool &pool = ThreadPool::instance()) {
+        using U = std::remove_cvref_t<std::invoke_result_t<Fn &, const typename detail::Traits<C>::element_type &>>;
+        using Output = typename detail::Traits<C>::template rebind<U>;
+        auto output = detail::emptyLike<Output>(container);
+        if constexpr (detail::Traits<C>::jagged)
+            detail::reshape(output, container);
+        detail::visit(pool, detail::partitionOf(container, detail::defaultTasks(pool)),
+                      [&fn](std::size_t, const auto &, const auto &element, U &result) { result = fn(element); },
+                      container, output);
+        return output;
+    }
+
+    /***
+     * @brief Reduce all elements of a DArray or DVector, in parallel
+     * @param container DArray or DVector reduced
+     * @param init Initial value of the reduction
+     * @param op Associative and commutative binary operation, as required by std::reduce
+     * @param pool Pool executing the tasks
+     * @return Result of op applied to init and all elements, in an unspecified order
+     */
+    template<detail::Partitionable C, typename T, typename BinaryOp = std::plus<>>
+    T reduce(const C &container, T init, BinaryOp op = {}, ThreadPool &pool = ThreadPool::instance()) {
+        const auto partition = detail::partitionOf(container, detail::defaultTasks(pool));
+        std::vector<std::optional<T>> partials(partition.tasks());
+        detail::visit(pool, partition, [&](std::size_t task, const auto &, const auto &element) {
+            auto &partial = partials[task];
+            if (partial)
+                *partial = op(std::move(*partial), element);
+            else
+                partial.emplace(element);
+        }, container);
+        for (auto &partial: partials)
+            if (partial)
+                init = op(std::move(init), std::move(*partial));
+        return init;
+    }
+
+    /***
+     * @brief Create a rectangular DVector whose elements are computed from their indices,
+     *        building the sub-vectors of the outer-most dimension in parallel
+     * @tparam T Type of the elements stored
+     * @tparam D Dimension of the DVector created, greater than 1
+     * @param shape Number of elements of each dimension
+     * @param generator Function called with the D indices of each element, returning its value,
+     *                  invoked concurrently by several threads
+     * @param pool Pool executing the tasks, one for each sub-vector of the outer-most dimension
+     * @return DVector holding the values returned by generator
+     * @see DVector<D,T,Allocator>::DVector(const shape_type &, Fn, const Allocator &)
+     */
+    template<typename T, std::size_t D, typename Fn>
+    DVector<D, T> generate(const std::array<std::size_t, D> &shape, Fn generator,
+                           ThreadPool &pool = ThreadPool::instance())
+    requires (D > 1) && mdc::detail::Generator<Fn, T, D> {
+        DVector<D, T> dVector;
+        dVector.resize(shape[0]);
+        const auto rowShape = mdc::detail::tail<1>(shape);
+        detail::runTasks(pool, shape[0], [&](std::size_t i) {
+            dVector[i] = DVector<D - 1, T>(rowShape, [&generator, i](auto... indices) {
+                return generator(i, indices...);
+            });
+        });
+        return dVector;
+    }
+
+}
+
+
+#endif //DCONTAINERS_PARALLEL_HPP
@@ -0,0 +1,452 @@
+/*
+ *   Copyright 2022 Alberto Guarnieri
+ *
+ *   Licensed under the Apache License, Version 2.0 (the "License");
+ *   you may not use this file except in compliance with the License.
+ *   You may obtain a copy of the License at
+ *
+ *       http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *   Unless required by applicable law or agreed to in writing, software
+ *   distributed under the License is distributed on an "AS IS" BASIS,
+ *   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *   See the License for the specific language governing permissions and
+ *   limitations under the License.
+ */
+
+#ifndef DCONTAINERS_PARSE_HPP
+#define DCONTAINERS_PARSE_HPP
+
+
+#include <algorithm>
+#include <charconv>
+#include <cstddef>
+#include <cstring>
+#include <istream>
+#include <iterator>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <type_traits>
+#include <vector>
+
+#include "DContainers/DArray.hpp"
+#include "DContainers/DVector.hpp"
+#include "DContainers/Parallel.hpp"
+#include "DContainers/ThreadPool.hpp"
+
+
+namespace mdc::io {
+
+    /***
+     * @brief Options of the delimited text parser
+     * @see parse(std::istream &, DVector<2,T,Allocator> &, const ParseOptions &)
+     */
+    struct ParseOptions {
+        // Character between two fields of the same line
+        char delimiter = ',';
+        // Lines starting with this character are skipped, none if '\0'
+        char comment = '\0';
+        // Number of lines skipped at the beginning, e.g. 1 for a header
+        std::size_t skipRows = 0;
+        // Skip empty lines, instead of reading them as empty rows
+        bool skipEmptyLines = true;
+        // Bytes read from a stream at once, grown when a single line is longer
+        std::size_t chunkSize = 1 << 20;
+
+        /***
+         * @return Comma-separated values
+         */
+        static constexpr ParseOptions csv() noexcept {
+            return {};
+        }
+
+        /***
+         * @return Tab-separated values
+         */
+        static constexpr ParseOptions tsv() noexcept {
+            return {'\t'};
+        }
+    };
+
+    /***
+     * @brief Error raised on malformed delimited text, reporting where it was found
+     */
+    class ParseError : public std::runtime_error {
+    private:
+        std::string _reason;
+        std::size_t _line;
+        std::size_t _field;
+
+    public:
+        /***
+         * @param reason Description of the error
+         * @param line Line of the error, starting from 1
+         * @param field Field of the error inside its line starting from 1, or 0 if not related to a single field
+         */
+        ParseError(const std::string &reason, std::size_t line, std::size_t field)
+                : std::runtime_error("mdc::io: " + reason + " at line " + std::to_string(line) +
+                                     (field ? ", field " + std::to_string(field) : std::string())),
+                  _reason(reason), _line(line), _field(field) {}
+
+        const std::string &reason() const noexcept {
+            return _reason;
+        }
+
+        std::size_t line() const noexcept {
+            return _line;
+        }
+
+        std::size_t field() const noexcept {
+            return _field;
+        }
+    };
+
+    /***
+     * @brief Element type which can be parsed with std::from_chars
+     */
+    template<typename T>
+    concept Parsable = std::is_arithmetic_v<T> && !std::is_same_v<T, bool>;
+
+    namespace detail {
+
+        /***
+         * @brief Parse a whole field, ignoring surrounding blanks and a leading '+'
+         * @return Description of the error, or nullptr on success
+         */
+        template<Parsable T>
+        const char *parseField(const char *first, const char *last, char delimiter, T &value) noexcept {
+            auto blank = [delimiter](char c) { return c == ' ' || (c == '\t' && delimiter != '\t'); };
+            while (first != last && blank(*first))
+                ++first;
+            while (first != last && blank(last[-1]))
+                --last;
+            if (first == last)
+                return "empty field";
+            if (*first == '+' && last - first > 1 && first[1] != '-')
+                ++first;
+            const auto [end, ec] = std::from_chars(first, last, value);
+            if (ec == std::errc::result_out_of_range)
+                return "value out of range";
+            if (ec != std::errc() || end != last)
+                return "invalid value";
+            return nullptr;
+        }
+
+        /***
+         * @brief Append each line as a new row of a DVector<2>
+         */
+        template<typename V>
+        class VectorSink {
+        private:
+            V &_rows;
+            std::size_t _hint = 0;
+
+        public:
+            explicit VectorSink(V &rows) noexcept : _rows(rows) {}
+
+            void beginRow(std::size_t) {
+                _rows.emplace_back();
+                _rows.back().reserve(_hint);
+            }
+
+            template<typename T>
+            void push(T value, std::size_t, std::size_t) {
+                _rows.back().push_back(value);
+            }
+
+            void endRow(std::size_t) noexcept {
+                // rows of delimited files tend to have the same length
+                _hint = _rows.back().size();
+            }
+
+            void finish(std::size_t) const noexcept {}
+        };
+
+        /***
+         * @brief Fill a DArray<T,R,C> in place, checking that there are exactly R lines of C fields
+         */
+        template<typename T, std::size_t R, std::size_t C>
+        class ArraySink {
+        private:
+            DArray<T, R, C> &_array;
+            std::size_t _row = 0;
+            std::size_t _column = 0;
+
+        public:
+            explicit ArraySink(DArray<T, R, C> &array) noexcept : _array(array) {}
+
+            void beginRow(std::size_t line) {
+                if (_row == R)
+                    throw ParseError("more than " + std::to_string(R) + " rows", line, 0);
+                _column = 0;
+            }
+
+            void push(T value, std::size_t line, std::size_t field) {
+                if (_column == C)
+                    throw ParseError("more than " + std::to_string(C) + " fields", line, field);
+                _array[_row][_column++] = value;
+            }
+
+            void endRow(std::size_t line) {
+                if (_column != C)
+                    throw ParseError("expected " + std::to_string(C) + " fields, found " + std::to_string(_column),
+                                     line, 0);
+                ++_row;
+            }
+
+            void finish(std::size_t line) const {
+                if (_row != R)
+                    throw ParseError("expected " + std::to_string(R) + " rows, found " + std::to_string(_row),
+                                     line, 0);
+            }
+        };
+
+        /***
+         * @brief Split text into lines and fields, forwarding each parsed value to a sink
+         */
+        template<typename T, typename Sink>
+        class LineParser {
+        private:
+            const ParseOptions &_options;
+            Sink &_sink;
+            std::size_t _line = 0;
+            std::size_t _skip;
+
+            void parseLine(const char *first, const char *last) {
+                ++_line;
+                if (first != last && last[-1] == '\r')
+                    --last;
+                if (_skip > 0) {
+                    --_skip;
+                    return;
+                }
+                if ((first == last && _options.skipEmptyLines) ||
+                    (_options.comment != '\0' && first != last && *first == _options.comment))
+                    return;
+                _sink.beginRow(_line);
+                for (std::size_t field = 1; first != last; ++field) {
+                    const auto *end = static_cast<const char *>(std::memchr(first, _options.delimiter,
+                                                                            last - first));
+                    T value;
+                    if (const char *error = parseField(first, end ? end : last, _options.delimiter, value))
+                        throw ParseError(error, _line, field);
+                    _sink.push(value, _line, field);
+                    if (!end)
+                        break;
+                    first = end + 1;
+                    if (first == last)
+                        throw ParseError("empty field", _line, field + 1);
+                }
+                _sink.endRow(_line);
+            }
+
+        public:
+            LineParser(const ParseOptions &options, Sink &sink, std::size_t skip) noexcept
+                    : _options(options), _sink(sink), _skip(skip) {}
+
+            /***
+             * @brief Parse each complete line of [first, last), or all of them if no more text follows
+             * @return Beginning of the first line not parsed
+             */
+            const char *consume(const char *first, const char *last, bool final) {
+                while (first != last) {
+                    const auto *end = static_cast<const char *>(std::memchr(first, '\n', last - first));
+                    if (!end && !final)
+                        break;
+                    parseLine(first, end ? end : last);
+                    first = end ? end + 1 : last;
+                }
+                return first;
+            }
+
+            void finish() const {
+                _sink.finish(_line);
+            }
+        };
+
+        template<typename T, typename Sink>
+        void parseText(std::string_view text, const ParseOptions &options, Sink &sink) {
+            LineParser<T, Sink> parser(options, sink, options.skipRows);
+            parser.consume(text.data(), text.data() + text.size(), true);
+            parser.finish();
+        }
+
+        /***
+         * @brief Parse a stream in chunks of options.chunkSize bytes, moving the last incomplete line of each chunk
+         *        in front of the following one
+         */
+        template<typename T, typename Sink>
+        void parseStream(std::istream &is, const ParseOptions &options, Sink &sink) {
+            LineParser<T, Sink> parser(options, sink, options.skipRows);
+            std::vector<char> buffer(std::max<std::size_t>(options.chunkSize, 1));
+            std::size_t kept = 0;
+            while (true) {
+                is.read(buffer.data() + kept, static_cast<std::streamsize>(buffer.size() - kept));
+                if (is.bad())
+                    throw std::runtime_error("mdc::io: failed reading from stream");
+                const std::size_t size = kept + static_cast<std::size_t>(is.gcount());
+                const bool final = !is;
+                const char *rest = parser.consume(buffer.data(), buffer.data() + size, final);
+                if (final)
+                    break;
+                kept = static_cast<std::size_t>(buffer.data() + size - rest);
+                if (kept == buffer.size())
+                    buffer.resize(2 * buffer.size());
+                else
+                    std::memmove(buffer.data(), rest, kept);
+            }
+            parser.finish();
+        }
+
+    }
+
+    /***
+     * @brief Read delimited text (e.g. CSV or TSV) from a stream, one row for each line.
+     *        Values are converted with std::from_chars straight from a buffer of options.chunkSize bytes,
+     *        hence lines are never copied into strings. Blanks around values, a trailing carriage return and
+     *        a leading '+' are ignored; quoted fields are not supported.
+     * @param is Input stream
+     * @param rows DVector replaced with the rows read, which may have different lengths
+     * @param options Delimiter, rows skipped and size of the chunks read
+     * @throws ParseError If a field is empty or does not hold a valid value of type T
+     * @throws std::runtime_error If reading the stream fails
+     */
+    template<Parsable T, typename Allocator>
+    void parse(std::istream &is, DVector<2, T, Allocator> &rows, const ParseOptions &options = {}) {
+        rows.clear();
+        detail::VectorSink sink(rows);
+        detail::parseStream<T>(is, options, sink);
+    }
+
+    /***
+     * @brief Read delimited text from a stream into a DArray, which must hold exactly R lines of C values
+     * @param is Input stream
+     * @param array DArray overwritten
+     * @param options Delimiter, rows skipped and size of the chunks read
+     * @throws ParseError If a field is not valid, or the text has a different shape
+     * @throws std::runtime_error If reading the stream fails
+     * @see parse(std::istream &, DVector<2,T,Allocator> &, const ParseOptions &)
+     */
+    template<Parsable T, std::size_t R, std::size_t C>
+    void parse(std::istream &is, DArray<T, R, C> &array, const ParseOptions &options = {}) {
+        detail::ArraySink sink(array);
+        detail::parseStream<T>(is, options, sink);
+    }
+
+    /***
+     * @see parse(std::istream &, DVector<2,T,Allocator> &, const ParseOptions &)
+     * @return Rows read
+     */
+    template<Parsable T>
+    DVector<2, T> parse(std::istream &is, const ParseOptions &options = {}) {
+        DVector<2, T> rows;
+        parse(is, rows, options);
+        return rows;
+    }
+
+    /***
+     * @brief Read delimited text already in memory, e.g. a memory mapped file, without copying it
+     * @see parse(std::istream &, DVector<2,T,Allocator> &, const ParseOptions &)
+     */
+    template<Parsable T, typename Allocator>
+    void parse(std::string_view text, DVector<2, T, Allocator> &rows, const ParseOptions &options = {}) {
+        rows.clear();
+        detail::VectorSink sink(rows);
+        detail::parseText<T>(text, options, sink);
+    }
+
+    /***
+     * @see parse(std::istream &, DArray<T,R,C> &, const ParseOptions &)
+     */
+    template<Parsable T, std::size_t R, std::size_t C>
+    void parse(std::string_view text, DArray<T, R, C> &array, const ParseOptions &options = {}) {
+        detail::ArraySink sink(array);
+        detail::parseText<T>(text, options, sink);
+    }
+
+    /***
+     * @see parse(std::string_view, DVector<2,T,Allocator> &, const ParseOptions &)
+     * @return Rows read
+     */
+    template<Parsable T>
+    DVector<2, T> parse(std::string_view text, const ParseOptions &options = {}) {
+        DVector<2, T> rows;
+        parse(text, rows, options);
+        return rows;
+    }
+
+}
+
+namespace mdc::parallel {
+
+    namespace detail {
+
+        // Smallest amount of text parsed by a single task
+        inline constexpr std::size_t minParseChunk = 64 * 1024;
+
+        inline std::size_t nextLine(std::string_view text, std::size_t position) noexcept {
+            const auto end = text.find('\n', position);
+            return end == std::string_view::npos ? text.size() : end + 1;
+        }
+
+    }
+
+    /***
+     * @brief Read delimited text already in memory, splitting it into chunks of whole lines parsed concurrently,
+     *        and then moving the rows of each chunk into the result
+     * @tparam T Type of the values read
+     * @param text Delimited text, e.g. the content of a memory mapped file
+     * @param options Delimiter and rows skipped (chunkSize is ignored)
+     * @param pool Pool executing the tasks
+     * @return Rows read, in the same order of the lines
+     * @throws io::ParseError For the first invalid line, as reported by io::parse()
+     * @see io::parse(std::string_view, DVector<2,T,Allocator> &, const io::ParseOptions &)
+     */
+    template<io::Parsable T>
+    DVector<2, T> parse(std::string_view text, const io::ParseOptions &options = {},
+                        ThreadPool &pool = ThreadPool::instance()) {
+        std::size_t begin = 0;
+        for (std::size_t skipped = 0; skipped < options.skipRows && begin < text.size(); ++skipped)
+            begin = detail::nextLine(text, begin);
+        const std::size_t tasks = std::clamp<std::size_t>((text.size() - begin) / detail::minParseChunk, 1,
+                                                          detail::defaultTasks(pool));
+        std::vector<std::size_t> bounds(tasks + 1, text.size());
+        bounds[0] = begin;
+        for (std::size_t task = 1; task < tasks; ++task)
+            bounds[task] = std::max(bounds[task - 1],
+                                    detail::nextLine(text, begin + task * (text.size() - begin) / tasks - 1));
+
+        std::vector<DVector<2, T>> parts(tasks);
+        std::vector<std::optional<io::ParseError>> errors(tasks);
+        io::ParseOptions chunkOptions = options;
+        chunkOptions.skipRows = 0;
+        detail::runTasks(pool, tasks, [&](std::size_t task) {
+            try {
+                io::parse(text.substr(bounds[task], bounds[task + 1] - bounds[task]), parts[task], chunkOptions);
+            } catch (const io::ParseError &error) {
+                errors[task] = error;
+            }
+        });
+
+        for (std::size_t task = 0; task < tasks; ++task)
+            if (const auto &error = errors[task]) {
+                const auto line = error->line() + std::count(text.begin(), text.begin() + bounds[task], '\n');
+                throw io::ParseError(error->reason(), static_cast<std::size_t>(line), error->field());
+            }
+        DVector<2, T> rows;
+        std::size_t size = 0;
+        for (const auto &part: parts)
+            size += part.size();
+        rows.reserve(size);
+        for (auto &part: parts)
+            std::move(part.begin(), part.end(), std::back_inserter(rows));
+        return rows;
+    }
+
+}
+
+
+#endif //DCONTAINERS_PARSE_HPP
@@ -0,0 +1,383 @@
+/*
+ *   Copyright 2022 Alberto Guarnieri
+ *
+ *   Licensed under the Apache License, Version 2.0 (the "License");
+ *   you may not use this file except in compliance with the License.
+ *   You may obtain a copy of the License at
+ *
+ *       http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *   Unless required by applicable law or agreed to in writing, software
+ *   distributed under the License is distributed on an "AS IS" BASIS,
+ *   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *   See the License for the specific language governing permissions and
+ *   limitations under the License.
+ */
+
+
+#ifndef DCONTAINERS_REDUCTION_HPP
+#define DCONTAINERS_REDUCTION_HPP
+
+
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <iterator>
+#include <optional>
+#include <stdexcept>
+#include <type_traits>
+
+#include "DContainers/DArray.hpp"
+#include "DContainers/DTensor.hpp"
+#include "DContainers/DVector.hpp"
+#include "DContainers/DView.hpp"
+#include "DContainers/JaggedDVector.hpp"
+#include "DContainers/Simd.hpp"
+
+
+namespace mdc {
+
+    namespace detail {
+
+        /***
+         * @brief Element type and dimension of the containers accepted by reductions
+         */
+        template<typename C>
+        struct ReductionTraits;
+
+        template<typename T, std::size_t N, std::size_t... O>
+        struct ReductionTraits<DArray<T, N, O...>> {
+            using element_type = T;
+            static constexpr std::size_t rank = sizeof...(O) + 1;
+        };
+
+        template<std::size_t D, typename T, typename Allocator>
+        struct ReductionTraits<DVector<D, T, Allocator>> {
+            using element_type = T;
+            static constexpr std::size_t rank = D;
+        };
+
+        template<std::size_t D, typename T>
+        struct ReductionTraits<DTensor<D, T>> {
+            using element_type = T;
+            static constexpr std::size_t rank = D;
+        };
+
+        template<std::size_t D, typename T>
+        struct ReductionTraits<JaggedDVector<D, T>> {
+            using element_type = T;
+            static constexpr std::size_t rank = D;
+        };
+
+        template<std::size_t D, typename T>
+        struct ReductionTraits<DView<D, T>> {
+            using element_type = std::remove_cv_t<T>;
+            static constexpr std::size_t rank = D;
+        };
+
+        template<std::size_t D, typename T, typename Allocator>
+        struct ReductionTraits<DVectorView<D, T, Allocator>> {
+            using element_type = std::remove_cv_t<T>;
+            static constexpr std::size_t rank = D;
+        };
+
+        template<std::size_t D, typename T>
+        struct ReductionTraits<JaggedView<D, T>> {
+            using element_type = std::remove_cv_t<T>;
+            static constexpr std::size_t rank = D;
+        };
+
+        template<typename C>
+        concept Reducible = requires { typename ReductionTraits<std::remove_cvref_t<C>>::element_type; };
+
+        template<typename C>
+        using ElementOf = typename ReductionTraits<std::remove_cvref_t<C>>::element_type;
+
+        /***
+         * @brief Elements laid out with a constant stride, reduced with a single kernel call
+         */
+        template<typename T>
+        struct Segment {
+            const T *first;
+            std::size_t count;
+            std::size_t stride;
+        };
+
+        template<typename T, std::size_t N, std::size_t... O>
+        std::optional<Segment<T>> flatSegment(const DArray<T, N, O...> &array) noexcept {
+            return Segment<T>{array.flat_begin(), array.total(), 1};
+        }
+
+        template<std::size_t D, typename T, typename Allocator>
+        std::optional<Segment<T>> flatSegment(const DVector<D, T, Allocator> &dVector) noexcept {
+            if constexpr (D == 1)
+                return Segment<T>{dVector.data(), dVector.size(), 1};
+            else
+                return std::nullopt;
+        }
+
+        template<std::size_t D, typename T>
+        std::optional<Segment<T>> flatSegment(const DTensor<D, T> &dTensor) noexcept {
+            return Segment<T>{dTensor.data(), dTensor.total(), 1};
+        }
+
+        template<std::size_t D, typename T>
+        std::optional<Segment<T>> flatSegment(const JaggedDVector<D, T> &jagged) noexcept {
+            return Segment<T>{jagged.data(), jagged.total(), 1};
+        }
+
+        template<std::size_t D, typename T>
+        std::optional<Segment<std::remove_cv_t<T>>> flatSegment(const JaggedView<D, T> &view) noexcept {
+            auto elements = view.elements();
+            return Segment<std::remove_cv_t<T>>{elements.data(), elements.size(), 1};
+        }
+
+        template<std::size_t D, typename T>
+        std::optional<Segment<std::remove_cv_t<T>>> flatSegment(const DView<D, T> &view) noexcept {
+            if (view.contiguous())
+                return Segment<std::remove_cv_t<T>>{view.data(), view.total(), 1};
+            if constexpr (D == 1)
+                return Segment<std::remove_cv_t<T>>{view.data(), view.size(), view.strides()[0]};
+            else
+                return std::nullopt;
+        }
+
+        template<std::size_t D, typename T, typename Allocator>
+        std::optional<Segment<std::remove_cv_t<T>>> flatSegment(const DVectorView<D, T, Allocator> &view) noexcept {
+            if constexpr (D == 1) {
+                if (view.empty())
+                    return Segment<std::remove_cv_t<T>>{nullptr, 0, 1};
+                return Segment<std::remove_cv_t<T>>{view.vector()->data() + view.offsets()[0], view.size(),
+                                                    view.steps()[0]};
+            } else {
+                return std::nullopt;
+            }
+        }
+
+        /***
+         * @brief Shape of a rectangular container, nullopt when its sub-containers may hold a different number of
+         *        elements and must be compared one by one
+         */
+        template<typename C>
+        std::optional<std::array<std::size_t, ReductionTraits<C>::rank>> boxShape(const C &) noexcept {
+            return std::nullopt;
+        }
+
+        template<typename T, std::size_t N, std::size_t... O>
+        std::optional<std::array<std::size_t, sizeof...(O) + 1>> boxShape(const DArray<T, N, O...> &) noexcept {
+            return std::array<std::size_t, sizeof...(O) + 1>{N, O...};
+        }
+
+        template<std::size_t D, typename T>
+        std::optional<std::array<std::size_t, D>> boxShape(const DTensor<D, T> &dTensor) noexcept {
+            return dTensor.shape();
+        }
+
+        template<std::size_t D, typename T>
+        std::optional<std::array<std::size_t, D>> boxShape(const DView<D, T> &view) noexcept {
+            return view.shape();
+        }
+
+        /***
+         * @brief Call fn on each non-empty segment of a container, in row-major order
+         */
+        template<typename C, typename Fn>
+        void visitSegments(const C &container, Fn &fn) {
+            if (auto segment = flatSegment(container)) {
+                if (segment->count > 0)
+                    fn(*segment);
+            } else if constexpr (ReductionTraits<C>::rank > 1) {
+                for (const auto &row: container)
+                    visitSegments(row, fn);
+            }
+        }
+
+        template<typename T>
+        T segmentSum(const Segment<T> &segment) {
+            if (segment.stride == 1)
+                return simd::sum(segment.first, segment.count);
+            T result{};
+            for (std::size_t i = 0; i < segment.count; ++i)
+                result += segment.first[i * segment.stride];
+            return result;
+        }
+
+        template<bool Greatest, typename T>
+        T segmentExtreme(const Segment<T> &segment) {
+            if (segment.stride == 1)
+                return Greatest ? simd::max(segment.first, segment.count) : simd::min(segment.first, segment.count);
+            T result = segment.first[0];
+            for (std::size_t i = 1; i < segment.count; ++i) {
+                const T &element = segment.first[i * segment.stride];
+                if ((Greatest ? result < element : element < result) || simd::detail::isNaN(element))
+                    result = element;
+            }
+            return result;
+        }
+
+        template<typename R, typename T, typename U>
+        R segmentDot(const Segment<T> &lhs, const Segment<U> &rhs) {
+            if (lhs.count != rhs.count)
+                throw std::invalid_argument("dot: operands have a different number of elements");
+            if constexpr (std::is_same_v<T, U>)
+                if (lhs.stride == 1 && rhs.stride == 1)
+                    return simd::dot(lhs.first, rhs.first, lhs.count);
+            R result{};
+            for (std::size_t i = 0; i < lhs.count; ++i)
+                result += static_cast<R>(lhs.first[i * lhs.stride]) * static_cast<R>(rhs.first[i * rhs.stride]);
+            return result;
+        }
+
+        template<typename R, typename A, typename B>
+        R dotOf(const A &lhs, const B &rhs) {
+            static_assert(ReductionTraits<A>::rank == ReductionTraits<B>::rank,
+                          "dot: operands must have the same dimension");
+            auto lhsSegment = flatSegment(lhs);
+            auto rhsSegment = flatSegment(rhs);
+            if (lhsSegment && rhsSegment) {
+                // equal counts are not enough when each operand holds several sub-containers
+                if constexpr (ReductionTraits<A>::rank == 1) {
+                    return segmentDot<R>(*lhsSegment, *rhsSegment);
+                } else {
+                    auto lhsShape = boxShape(lhs), rhsShape = boxShape(rhs);
+                    if (lhsShape && rhsShape) {
+                        if (*lhsShape != *rhsShape)
+                            throw std::invalid_argument("dot: operands have a different shape");
+                        return segmentDot<R>(*lhsSegment, *rhsSegment);
+                    }
+                }
+            }
+            R result{};
+            if constexpr (ReductionTraits<A>::rank > 1) {
+                if (std::size(lhs) != std::size(rhs))
+                    throw std::invalid_argument("dot: operands have a different number of sub-containers");
+                auto rhsRow = std::begin(rhs);
+                for (const auto &lhsRow: lhs)
+                    result += dotOf<R>(lhsRow, *rhsRow++);
+            }
+            return result;
+        }
+
+    }
+
+    /***
+     * @brief Sum all elements of a container or view, using vectorized kernels over each contiguous segment
+     * @param container DArray, DVector, DTensor, JaggedDVector or a view over one of them
+     * @return Sum of the elements, accumulated with their own type
+     * @see simd::sum
+     */
+    template<detail::Reducible C>
+    detail::ElementOf<C> sum(const C &container) {
+        detail::ElementOf<C> result{};
+        auto fn = [&result](const auto &segment) { result += detail::segmentSum(segment); };
+        detail::visitSegments(container, fn);
+        return result;
+    }
+
+    /***
+     * @brief Smallest element of a container or view
+     * @param container DArray, DVector, DTensor, JaggedDVector or a view over one of them
+     * @return Copy of the smallest element, NaN if any element is NaN
+     * @throws std::invalid_argument If the container holds no element
+     */
+    template<detail::Reducible C>
+    detail::ElementOf<C> min(const C &container) {
+        std::optional<detail::ElementOf<C>> result;
+        auto fn = [&result](const auto &segment) {
+            auto candidate = detail::segmentExtreme<false>(segment);
+            if (!result || candidate < *result || simd::detail::isNaN(candidate))
+                result = candidate;
+        };
+        detail::visitSegments(container, fn);
+        if (!result)
+            throw std::invalid_argument("min: container holds no element");
+        return *result;
+    }
+
+    /***
+     * @brief Greatest element of a container or view
+     * @param container DArray, DVector, DTensor, JaggedDVector or a view over one of them
+     * @return Copy of the greatest element, NaN if any element is NaN
+     * @throws std::invalid_argument If the container holds no element
+     */
+    template<detail::Reducible C>
+    detail::ElementOf<C> max(const C &container) {
+        std::optional<detail::ElementOf<C>> result;
+        auto fn = [&result](const auto &segment) {
+            auto candidate = detail::segmentExtreme<true>(segment);
+            if (!result || *result < candidate || simd::detail::isNaN(candidate))
+                result = candidate;
+        };
+        detail::visitSegments(container, fn);
+        if (!result)
+            throw std::invalid_argument("max: container holds no element");
+        return *result;
+    }
+
+    /***
+     * @brief Position of the first greatest element of a container or view
+     * @param container DArray, DVector, DTensor, JaggedDVector or a view over one of them
+     * @return Index of the element in row-major order, i.e. its position among all elements visited by elements().
+     *         If any element is NaN, index of the first NaN instead.
+     * @throws std::invalid_argument If the container holds no element
+     */
+    template<detail::Reducible C>
+    std::size_t argmax(const C &container) {
+        std::optional<detail::ElementOf<C>> best;
+        std::size_t position = 0, visited = 0;
+        auto better = [&best](const auto &value) {
+            return !best || (!simd::detail::isNaN(*best) && (*best < value || simd::detail::isNaN(value)));
+        };
+        auto fn = [&](const auto &segment) {
+            if (segment.stride == 1) {
+                auto [index, value] = simd::argmax(segment.first, segment.count);
+                if (better(value)) {
+                    best = value;
+                    position = visited + index;
+                }
+            } else {
+                for (std::size_t i = 0; i < segment.count; ++i)
+                    if (better(segment.first[i * segment.stride])) {
+                        best = segment.first[i * segment.stride];
+                        position = visited + i;
+                    }
+            }
+            visited += segment.count;
+        };
+        detail::visitSegments(container, fn);
+        if (!best)
+            throw std::invalid_argument("argmax: container holds no element");
+        return position;
+    }
+
+    /***
+     * @brief Dot product of two containers (or views) with the same dimension, where sub-containers at the same
+     *        position hold the same number of elements
+     * @param lhs First operand
+     * @param rhs Second operand
+     * @return Sum of the products of the elements at the same position
+     * @throws std::invalid_argument If the two operands have a different shape
+     */
+    template<detail::Reducible A, detail::Reducible B>
+    std::common_type_t<detail::ElementOf<A>, detail::ElementOf<B>> dot(const A &lhs, const B &rhs) {
+        return detail::dotOf<std::common_type_t<detail::ElementOf<A>, detail::ElementOf<B>>>(lhs, rhs);
+    }
+
+    /***
+     * @brief Euclidean norm of all elements of a container or view
+     * @param container DArray, DVector, DTensor, JaggedDVector or a view over one of them
+     * @return Square root of the sum of the squares of the elements
+     */
+    template<detail::Reducible C>
+    auto norm2(const C &container) {
+        using T = detail::ElementOf<C>;
+        T squares{};
+        auto fn = [&squares](const auto &segment) { squares += detail::segmentDot<T>(segment, segment); };
+        detail::visitSegments(container, fn);
+        return std::sqrt(squares);
+    }
+
+}
+
+
+#endif //DCONTAINERS_REDUCTION_HPP
@@ -0,0 +1,811 @@
+/*
+ *   Copyright 2022 Alberto Guarnieri
+ *
+ *   Licensed under the Apache License, Version 2.0 (the "License");
+ *   you may not use this file except in compliance with the License.
+ *   You may obtain a copy of the License at
+ *
+ *       http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *   Unless required by applicable law or agreed to in writing, software
+ *   distributed under the License is distributed on an "AS IS" BASIS,
+ *   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *   See the License for the specific language governing permissions and
+ *   limitations under the License.
+ */
+
+#ifndef DCONTAINERS_SERIALIZATION_HPP
+#define DCONTAINERS_SERIALIZATION_HPP
+
+
+#include <algorithm>
+#include <array>
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <istream>
+#include <limits>
+#include <optional>
+#include <ostream>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#if __has_include(<unistd.h>)
+#include <unistd.h>
+#define DCONTAINERS_POSIX_IO
+#endif
+
+#include "DContainers/DArray.hpp"
+#include "DContainers/DTensor.hpp"
+#include "DContainers/DVector.hpp"
+#include "DContainers/JaggedDVector.hpp"
+
+
+/***
+ * @brief Binary serialization of DArray, DTensor, DVector and JaggedDVector.
+ *        A serialized container is made of a header followed by the elements, in row-major order:
+ * @code
+ * offset  size  field
+ *      0     4  magic "MDCB"
+ *      4     2  byte order mark 0x0102, written in the byte order of the writer
+ *      6     1  format version
+ *      7     1  layout: 0 dense, 1 jagged
+ *      8     8  element kind: 0 other, 1 signed integer, 2 unsigned integer, 3 floating point
+ *     16     8  element size, in bytes
+ *     24     8  rank R
+ *     32     8  number of elements
+ *     40     8  payload offset, i.e. position of the first element
+ *     48        dense:  R extents
+ *               jagged: for each of the R - 1 outer levels, the number of offsets followed by the offsets,
+ *                       where the i-th sub-vector spans children [offsets[i], offsets[i + 1]) (as in JaggedDVector)
+ *      ...      zero padding up to the payload offset, a multiple of payloadAlignment
+ * @endcode
+ *        All header fields after the first 8 bytes are unsigned 64-bit integers, and elements are stored with their
+ *        object representation, hence in the byte order of the writer.
+ *        Only trivially copyable element types can be serialized, bool excluded since std::vector<bool> is packed.
+ */
+namespace mdc::io {
+
+    /***
+     * @brief Arrangement of the serialized elements
+     */
+    enum class Layout : std::uint8_t {
+        Dense = 0,
+        Jagged = 1
+    };
+
+    /***
+     * @brief Category of the serialized elements, checked along with their size when reading
+     */
+    enum class ElementKind : std::uint64_t {
+        Other = 0,
+        Signed = 1,
+        Unsigned = 2,
+        Floating = 3
+    };
+
+    // Alignment of the first element, allowing serialized containers to be memory mapped
+    inline constexpr std::size_t payloadAlignment = 64;
+
+    // Sub-containers accepted at each level of a dense container without elements, whose extents no payload backs
+    inline constexpr std::uint64_t emptyRowsLimit = 4096;
+
+    /***
+     * @brief Decoded header of a serialized container
+     */
+    struct Header {
+        Layout layout = Layout::Dense;
+        ElementKind kind = ElementKind::Other;
+        std::uint64_t elementSize = 0;
+        std::uint64_t rank = 0;
+        std::uint64_t count = 0;
+        std::uint64_t payloadOffset = 0;
+        // Extents of each dimension, for dense layouts
+        std::vector<std::uint64_t> shape;
+        // Offsets of each outer level, for jagged layouts
+        std::vector<std::vector<std::uint64_t>> offsets;
+        // true iff the container was written with the opposite byte order
+        bool swapped = false;
+    };
+
+    /***
+     * @brief Element type which can be serialized
+     */
+    template<typename T>
+    concept Serializable = std::is_trivially_copyable_v<T> && !std::is_same_v<std::remove_cv_t<T>, bool>;
+
+    namespace detail {
+
+        inline constexpr std::array<char, 4> magic{'M', 'D', 'C', 'B'};
+        inline constexpr std::uint16_t byteOrderMark = 0x0102;
+        inline constexpr std::uint8_t version = 1;
+        inline constexpr std::size_t fixedHeaderSize = 48;
+        // Bytes allocated at once while reading from a source of unknown size, so that a corrupt header fails on a
+        // short read instead of allocating everything it claims up front
+        inline constexpr std::size_t readChunk = 1 << 20;
+
+        template<typename T>
+        constexpr ElementKind kindOf() noexcept {
+            if constexpr (std::is_floating_point_v<T>)
+                return ElementKind::Floating;
+            else if constexpr (std::is_integral_v<T> && std::is_signed_v<T>)
+                return ElementKind::Signed;
+            else if constexpr (std::is_integral_v<T>)
+                return ElementKind::Unsigned;
+            else
+                return ElementKind::Other;
+        }
+
+        inline void byteSwap(void *value, std::size_t size) noexcept {
+            auto *bytes = static_cast<unsigned char *>(value);
+            std::reverse(bytes, bytes + size);
+        }
+
+        inline std::uint64_t byteSwapped(std::uint64_t value) noexcept {
+            byteSwap(&value, sizeof(value));
+            return value;
+        }
+
+        constexpr std::uint64_t roundUp(std::uint64_t value, std::uint64_t alignment) noexcept {
+            return (value + alignment - 1) / alignment * alignment;
+        }
+
+        [[noreturn]] inline void corrupted(const std::string &reason) {
+            throw std::runtime_error("mdc::io: " + reason);
+        }
+
+        /***
+         * @return Product of two extents read from a header
+         * @throws std::runtime_error If the product does not fit in 64 bits
+         */
+        inline std::uint64_t checkedProduct(std::uint64_t lhs, std::uint64_t rhs) {
+            if (rhs != 0 && lhs > std::numeric_limits<std::uint64_t>::max() / rhs)
+                corrupted("shape overflows");
+            return lhs * rhs;
+        }
+
+        class StreamSink {
+        private:
+            std::ostream &_os;
+
+        public:
+            explicit StreamSink(std::ostream &os) noexcept : _os(os) {}
+
+            void put(const void *bytes, std::size_t size) {
+                if (!_os.write(static_cast<const char *>(bytes), static_cast<std::streamsize>(size)))
+                    corrupted("failed writing to stream");
+            }
+
+            void flush() {}
+        };
+
+        class StreamSource {
+        private:
+            std::istream &_is;
+            // Bytes left in the stream, measured once if it can seek
+            std::optional<std::uint64_t> _available;
+
+        public:
+            explicit StreamSource(std::istream &is) : _is(is) {
+                const std::streamoff position = _is.tellg();
+                if (position < 0)
+                    return;
+                const std::streamoff end = _is.seekg(0, std::ios::end).tellg();
+                _is.clear();
+                _is.seekg(position);
+                if (end >= position)
+                    _available = static_cast<std::uint64_t>(end - position);
+            }
+
+            void get(void *bytes, std::size_t size) {
+                if (!_is.read(static_cast<char *>(bytes), static_cast<std::streamsize>(size)))
+                    corrupted("unexpected end of stream");
+                if (_available)
+                    *_available -= std::min<std::uint64_t>(*_available, size);
+            }
+
+            /***
+             * @return Bytes left in the stream, nullopt if it cannot seek
+             */
+            std::optional<std::uint64_t> available() const noexcept {
+                return _available;
+            }
+        };
+
+#ifdef DCONTAINERS_POSIX_IO
+        /***
+         * @brief Buffered writes to a file descriptor, large blocks of elements are written directly
+         */
+        class FdSink {
+        private:
+            static constexpr std::size_t bufferSize = 64 * 1024;
+
+            int _fd;
+            std::vector<std::byte> _buffer;
+
+            void writeAll(const std::byte *bytes, std::size_t size) {
+                while (size > 0) {
+                    auto written = ::write(_fd, bytes, size);
+                    if (written < 0) {
+                        if (errno == EINTR)
+                            continue;
+                        throw std::system_error(errno, std::generic_category(), "mdc::io: write failed");
+                    }
+                    bytes += written;
+                    size -= static_cast<std::size_t>(written);
+                }
+            }
+
+        public:
+            explicit FdSink(int fd) : _fd(fd) {
+                _buffer.reserve(bufferSize);
+            }
+
+            void put(const void *bytes, std::size_t size) {
+                const auto *first = static_cast<const std::byte *>(bytes);
+                if (_buffer.size() + size > bufferSize)
+                    flush();
+                if (size >= bufferSize)
+                    writeAll(first, size);
+                else
+                    _buffer.insert(_buffer.end(), first, first + size);
+            }
+
+            void flush() {
+                writeAll(_buffer.data(), _buffer.size());
+                _buffer.clear();
+            }
+        };
+
+        class FdSource {
+        private:
+            int _fd;
+            // Bytes left in the file, measured once if it can seek
+            std::optional<std::uint64_t> _available;
+
+        public:
+            explicit FdSource(int fd) noexcept : _fd(fd) {
+                const auto position = ::lseek(_fd, 0, SEEK_CUR);
+                const auto end = position < 0 ? position : ::lseek(_fd, 0, SEEK_END);
+                if (end < 0)
+                    return;
+                ::lseek(_fd, position, SEEK_SET);
+                if (end >= position)
+                    _available = static_cast<std::uint64_t>(end - position);
+            }
+
+            void get(void *bytes, std::size_t size) {
+                auto *first = static_cast<std::byte *>(bytes);
+                while (size > 0) {
+                    auto got = ::read(_fd, first, size);
+                    if (got < 0) {
+                        if (errno == EINTR)
+                            continue;
+                        throw std::system_error(errno, std::generic_category(), "mdc::io: read failed");
+                    }
+                    if (got == 0)
+                        corrupted("unexpected end of file");
+                    first += got;
+                    size -= static_cast<std::size_t>(got);
+                    if (_available)
+                        *_available -= std::min<std::uint64_t>(*_available, static_cast<std::uint64_t>(got));
+                }
+            }
+
+            /***
+             * @return Bytes left in the file, nullopt if it cannot seek
+             */
+            std::optional<std::uint64_t> available() const noexcept {
+                return _available;
+            }
+        };
+#endif
+
+        /***
+         * @brief Reads from a buffer already in memory, such as a memory mapped file
+         */
+        class MemorySource {
+        private:
+            const std::byte *_first;
+            const std::byte *_last;
+
+        public:
+            MemorySource(const void *bytes, std::size_t size) noexcept
+                    : _first(static_cast<const std::byte *>(bytes)), _last(_first + size) {}
+
+            void get(void *bytes, std::size_t size) {
+                if (static_cast<std::size_t>(_last - _first) < size)
+                    corrupted("unexpected end of buffer");
+                std::memcpy(bytes, _first, size);
+                _first += size;
+            }
+
+            /***
+             * @return Bytes left in the buffer
+             */
+            std::optional<std::uint64_t> available() const noexcept {
+                return static_cast<std::uint64_t>(_last - _first);
+            }
+        };
+
+        /***
+         * @brief Check that the source still holds count items of the given size, when it knows its size
+         */
+        template<typename Source>
+        void expectAvailable(Source &source, std::uint64_t count, std::size_t size) {
+            if (const auto bytes = source.available(); bytes && count > *bytes / size)
+                corrupted("source is shorter than its header claims");
+        }
+
+        /***
+         * @brief Resize values to count elements read from the source, growing them in bounded chunks
+         *        when the source does not know its size
+         */
+        template<typename Source, typename V>
+        void readElements(Source &source, V &values, std::uint64_t count) {
+            using T = typename V::value_type;
+            expectAvailable(source, count, sizeof(T));
+            const std::uint64_t chunk = std::max<std::size_t>(readChunk / sizeof(T), 1);
+            values.clear();
+            for (std::uint64_t done = 0; done < count;) {
+                const auto size = std::min(count - done, chunk);
+                values.resize(done + size);
+                source.get(values.data() + done, sizeof(T) * size);
+                done += size;
+            }
+        }
+
+        /***
+         * @brief Encode header, padded up to its payload offset
+         */
+        inline std::vector<std::byte> encode(const Header &header) {
+            std::vector<std::byte> bytes(fixedHeaderSize);
+            std::memcpy(bytes.data(), magic.data(), magic.size());
+            std::memcpy(bytes.data() + 4, &byteOrderMark, sizeof(byteOrderMark));
+            bytes[6] = std::byte{version};
+            bytes[7] = std::byte{static_cast<std::uint8_t>(header.layout)};
+            auto append = [&bytes](std::uint64_t value) {
+                const auto size = bytes.size();
+                bytes.resize(size + sizeof(value));
+                std::memcpy(bytes.data() + size, &value, sizeof(value));
+            };
+            const std::array<std::uint64_t, 5> fields{static_cast<std::uint64_t>(header.kind), header.elementSize,
+                                                      header.rank, header.count, 0};
+            std::memcpy(bytes.data() + 8, fields.data(), sizeof(fields));
+            if (header.layout == Layout::Dense) {
+                for (auto extent: header.shape)
+                    append(extent);
+            } else {
+                for (const auto &levelOffsets: header.offsets) {
+                    append(levelOffsets.size());
+                    for (auto offset: levelOffsets)
+                        append(offset);
+                }
+            }
+            const std::uint64_t payloadOffset = roundUp(bytes.size(), payloadAlignment);
+            std::memcpy(bytes.data() + 40, &payloadOffset, sizeof(payloadOffset));
+            bytes.resize(payloadOffset);
+            return bytes;
+        }
+
+        /***
+         * @brief Decode and validate a header, consuming the source up to the payload offset
+         * @throws std::runtime_error If the source does not hold a consistent header
+         */
+        template<typename Source>
+        Header decode(Source &source) {
+            std::array<std::byte, fixedHeaderSize> fixed{};
+            source.get(fixed.data(), fixed.size());
+            if (std::memcmp(fixed.data(), magic.data(), magic.size()) != 0)
+                corrupted("not a serialized container");
+            std::uint16_t mark;
+            std::memcpy(&mark, fixed.data() + 4, sizeof(mark));
+            Header header;
+            header.swapped = mark != byteOrderMark;
+            if (header.swapped && mark != 0x0201)
+                corrupted("invalid byte order mark");
+            if (std::to_integer<std::uint8_t>(fixed[6]) != version)
+                corrupted("unsupported format version");
+            const auto layout = std::to_integer<std::uint8_t>(fixed[7]);
+            if (layout > 1)
+                corrupted("unknown layout");
+            header.layout = static_cast<Layout>(layout);
+
+            std::uint64_t consumed = fixedHeaderSize;
+            auto field = [&header](const std::byte *bytes) {
+                std::uint64_t value;
+                std::memcpy(&value, bytes, sizeof(value));
+                return header.swapped ? byteSwapped(value) : value;
+            };
+            auto next = [&]() {
+                std::array<std::byte, sizeof(std::uint64_t)> bytes{};
+                source.get(bytes.data(), bytes.size());
+                consumed += bytes.size();
+                return field(bytes.data());
+            };
+            const auto kind = field(fixed.data() + 8);
+            if (kind > static_cast<std::uint64_t>(ElementKind::Floating))
+                corrupted("unknown element kind");
+            header.kind = static_cast<ElementKind>(kind);
+            header.elementSize = field(fixed.data() + 16);
+            header.rank = field(fixed.data() + 24);
+            header.count = field(fixed.data() + 32);
+            header.payloadOffset = field(fixed.data() + 40);
+            if (header.rank == 0 || header.elementSize == 0)
+                corrupted("invalid rank or element size");
+
+            if (header.layout == Layout::Dense) {
+                std::uint64_t count = 1;
+                for (std::uint64_t d = 0; d < header.rank; ++d) {
+                    header.shape.push_back(next());
+                    count = checkedProduct(count, header.shape.back());
+                }
+                if (count != header.count)
+                    corrupted("shape does not match the number of elements");
+            } else {
+                header.offsets.resize(header.rank - 1);
+                std::uint64_t children = header.count;
+                for (std::size_t l = 0; l < header.offsets.size(); ++l) {
+                    auto &levelOffsets = header.offsets[l];
+                    const auto size = next();
+                    // each level holds one more offset than the sub-vectors of the previous one
+                    if (size == 0 || (l > 0 && size != children + 1))
+                        corrupted("offsets do not match the previous level");
+                    expectAvailable(source, size, sizeof(std::uint64_t));
+                    levelOffsets.reserve(std::min<std::uint64_t>(size, readChunk / sizeof(std::uint64_t)));
+                    for (std::uint64_t i = 0; i < size; ++i)
+                        levelOffsets.push_back(next());
+                    if (levelOffsets.front() != 0 || !std::is_sorted(levelOffsets.begin(), levelOffsets.end()))
+                        corrupted("offsets are not non-decreasing from 0");
+                    children = levelOffsets.back();
+                }
+                if (children != header.count)
+                    corrupted("offsets do not match the number of elements");
+            }
+            if (header.payloadOffset < consumed || header.payloadOffset % payloadAlignment != 0)
+                corrupted("invalid payload offset");
+            std::array<std::byte, payloadAlignment> padding{};
+            for (auto left = header.payloadOffset - consumed; left > 0;) {
+                const auto size = std::min<std::uint64_t>(left, padding.size());
+                source.get(padding.data(), size);
+                left -= size;
+            }
+            return header;
+        }
+
+        template<typename T>
+        Header headerOf(Layout layout, std::uint64_t rank, std::uint64_t count) {
+            Header header;
+            header.layout = layout;
+            header.kind = kindOf<T>();
+            header.elementSize = sizeof(T);
+            header.rank = rank;
+            header.count = count;
+            return header;
+        }
+
+        template<typename T, std::size_t N, std::size_t... O>
+        Header describe(const DArray<T, N, O...> &array) {
+            auto header = headerOf<T>(Layout::Dense, sizeof...(O) + 1, array.total());
+            header.shape = {N, O...};
+            return header;
+        }
+
+        template<std::size_t D, typename T>
+        Header describe(const DTensor<D, T> &dTensor) {
+            auto header = headerOf<T>(Layout::Dense, D, dTensor.total());
+            header.shape.assign(dTensor.shape().begin(), dTensor.shape().end());
+            return header;
+        }
+
+        template<std::size_t L, typename V>
+        void appendOffsets(const V &dVector, std::vector<std::vector<std::uint64_t>> &offsets,
+                           std::uint64_t &count) {
+            if constexpr (L == 1) {
+                count += dVector.size();
+            } else {
+                auto &levelOffsets = offsets[offsets.size() - L + 1];
+                for (const auto &subVector: dVector) {
+                    appendOffsets<L - 1>(subVector, offsets, count);
+                    levelOffsets.push_back(L == 2 ? count : offsets[offsets.size() - L + 2].size() - 1);
+                }
+            }
+        }
+
+        template<std::size_t D, typename T, typename Allocator>
+        Header describe(const DVector<D, T, Allocator> &dVector) {
+            auto header = headerOf<T>(Layout::Jagged, D, 0);
+            header.offsets.assign(D - 1, std::vector<std::uint64_t>{0});
+            if constexpr (D > 1)
+                header.offsets.front().reserve(dVector.size() + 1);
+            if constexpr (D == 1) {
+                header.count = dVector.size();
+            } else {
+                for (const auto &subVector: dVector) {
+                    appendOffsets<D - 1>(subVector, header.offsets, header.count);
+                    header.offsets.front().push_back(D == 2 ? header.count : header.offsets[1].size() - 1);
+                }
+            }
+            return header;
+        }
+
+        template<std::size_t D, typename T>
+        Header describe(const JaggedDVector<D, T> &jagged) {
+            auto header = headerOf<T>(Layout::Jagged, D, jagged.total());
+            for (std::size_t l = 0; l < D - 1; ++l)
+                header.offsets.emplace_back(jagged.offsets(l).begin(), jagged.offsets(l).end());
+            return header;
+        }
+
+        template<typename Sink, typename T, std::size_t N, std::size_t... O>
+        void writePayload(Sink &sink, const DArray<T, N, O...> &array) {
+            sink.put(array.flat_begin(), sizeof(T) * array.total());
+        }
+
+        template<typename Sink, std::size_t D, typename T>
+        void writePayload(Sink &sink, const DTensor<D, T> &dTensor) {
+            sink.put(dTensor.data(), sizeof(T) * dTensor.total());
+        }
+
+        template<typename Sink, std::size_t D, typename T, typename Allocator>
+        void writePayload(Sink &sink, const DVector<D, T, Allocator> &dVector) {
+            if constexpr (D == 1)
+                sink.put(dVector.data(), sizeof(T) * dVector.size());
+            else
+                for (const auto &subVector: dVector)
+                    writePayload(sink, subVector);
+        }
+
+        template<typename Sink, std::size_t D, typename T>
+        void writePayload(Sink &sink, const JaggedDVector<D, T> &jagged) {
+            sink.put(jagged.data(), sizeof(T) * jagged.total());
+        }
+
+        template<typename Sink, typename C>
+        void write(Sink &sink, const C &container) {
+            const auto header = encode(describe(container));
+            sink.put(header.data(), header.size());
+            writePayload(sink, container);
+            sink.flush();
+        }
+
+        /***
+         * @brief Check that a header describes elements of type T with dimension D
+         */
+        template<typename T>
+        void expect(const Header &header, std::size_t rank) {
+            if (header.rank != rank)
+                corrupted("expected rank " + std::to_string(rank) + ", found " + std::to_string(header.rank));
+            if (header.elementSize != sizeof(T) || header.kind != kindOf<T>())
+                corrupted("element type does not match");
+            if (header.swapped && header.kind == ElementKind::Other && sizeof(T) > 1)
+                corrupted("elements of unknown kind written with the opposite byte order");
+        }
+
+        template<typename T>
+        void fixByteOrder(const Header &header, T *first, std::size_t count) noexcept {
+            if (header.swapped && sizeof(T) > 1)
+                for (std::size_t i = 0; i < count; ++i)
+                    byteSwap(first + i, sizeof(T));
+        }
+
+        /***
+         * @return Offsets of each outer level, computed from the shape for dense layouts
+         */
+        inline std::vector<std::vector<std::uint64_t>> jaggedOffsets(const Header &header) {
+            if (header.layout == Layout::Jagged)
+                return header.offsets;
+            std::vector<std::vector<std::uint64_t>> offsets(header.rank - 1);
+            std::uint64_t rows = 1;
+            for (std::size_t l = 0; l + 1 < header.rank; ++l) {
+                rows = checkedProduct(rows, header.shape[l]);
+                // a sub-container holds at least one element, unless the container is empty
+                if (rows > std::max(header.count, emptyRowsLimit))
+                    corrupted("more sub-containers than elements");
+                checkedProduct(rows, header.shape[l + 1]);
+                offsets[l].resize(rows + 1);
+                for (std::uint64_t i = 0; i <= rows; ++i)
+                    offsets[l][i] = i * header.shape[l + 1];
+            }
+            return offsets;
+        }
+
+        template<typename Source, typename T, std::size_t N, std::size_t... O>
+        void readPayload(Source &source, const Header &header, DArray<T, N, O...> &array) {
+            expect<T>(header, sizeof...(O) + 1);
+            constexpr std::array<std::uint64_t, sizeof...(O) + 1> shape{N, O...};
+            if (header.layout != Layout::Dense || !std::equal(shape.begin(), shape.end(), header.shape.begin()))
+                corrupted("shape does not match");
+            source.get(array.flat_begin(), sizeof(T) * array.total());
+            fixByteOrder(header, array.flat_begin(), array.total());
+        }
+
+        template<typename Source, std::size_t D, typename T>
+        void readPayload(Source &source, const Header &header, DTensor<D, T> &dTensor) {
+            expect<T>(header, D);
+            if (header.layout != Layout::Dense)
+                corrupted("a jagged container cannot be read as DTensor");
+            typename DTensor<D, T>::shape_type shape{};
+            std::copy(header.shape.begin(), header.shape.end(), shape.begin());
+            if (source.available()) {
+                expectAvailable(source, header.count, sizeof(T));
+                dTensor = DTensor<D, T>(shape);
+                source.get(dTensor.data(), sizeof(T) * dTensor.total());
+            } else {
+                std::vector<T> values;
+                readElements(source, values, header.count);
+                dTensor = DTensor<D, T>(shape);
+                std::copy(values.begin(), values.end(), dTensor.data());
+            }
+            fixByteOrder(header, dTensor.data(), dTensor.total());
+        }
+
+        template<std::size_t L, typename Source, typename V>
+        void readRows(Source &source, const Header &header, const std::vector<std::vector<std::uint64_t>> &offsets,
+                      V &dVector, std::uint64_t first, std::uint64_t last) {
+            if constexpr (L == 1) {
+                readElements(source, dVector, last - first);
+                fixByteOrder(header, dVector.data(), dVector.size());
+            } else {
+                const auto &levelOffsets = offsets[offsets.size() - L + 1];
+                dVector.resize(last - first);
+                for (std::uint64_t i = first; i < last; ++i)
+                    readRows<L - 1>(source, header, offsets, dVector[i - first], levelOffsets[i],
+                                    levelOffsets[i + 1]);
+            }
+        }
+
+        template<typename Source, std::size_t D, typename T, typename Allocator>
+        void readPayload(Source &source, const Header &header, DVector<D, T, Allocator> &dVector) {
+            expect<T>(header, D);
+            expectAvailable(source, header.count, sizeof(T));
+            const auto offsets = jaggedOffsets(header);
+            dVector.clear();
+            readRows<D>(source, header, offsets, dVector, 0, D == 1 ? header.count : offsets.front().size() - 1);
+        }
+
+        template<typename Source, std::size_t D, typename T>
+        void readPayload(Source &source, const Header &header, JaggedDVector<D, T> &jagged) {
+            expect<T>(header, D);
+            std::array<std::vector<std::size_t>, D - 1> offsets;
+            const auto levels = jaggedOffsets(header);
+            for (std::size_t l = 0; l < D - 1; ++l)
+                offsets[l].assign(levels[l].begin(), levels[l].end());
+            std::vector<T> values;
+            readElements(source, values, header.count);
+            fixByteOrder(header, values.data(), values.size());
+            jagged = JaggedDVector<D, T>(std::move(values), std::move(offsets));
+        }
+
+        template<typename C>
+        struct SerializationTraits {
+            static constexpr bool supported = false;
+        };
+
+        template<typename T, std::size_t N, std::size_t... O>
+        struct SerializationTraits<DArray<T, N, O...>> {
+            static constexpr bool supported = Serializable<T>;
+        };
+
+        template<std::size_t D, typename T>
+        struct SerializationTraits<DTensor<D, T>> {
+            static constexpr bool supported = Serializable<T>;
+        };
+
+        template<std::size_t D, typename T, typename Allocator>
+        struct SerializationTraits<DVector<D, T, Allocator>> {
+            static constexpr bool supported = Serializable<T>;
+        };
+
+        template<std::size_t D, typename T>
+        struct SerializationTraits<JaggedDVector<D, T>> {
+            static constexpr bool supported = Serializable<T>;
+        };
+
+    }
+
+    /***
+     * @brief DArray, DTensor, DVector or JaggedDVector of serializable elements
+     */
+    template<typename C>
+    concept SerializableContainer = detail::SerializationTraits<std::remove_cvref_t<C>>::supported;
+
+    /***
+     * @brief Write a container in binary format.
+     *        Elements of DArray, DTensor and JaggedDVector are written with a single bulk copy,
+     *        while DVector is written as offsets followed by the elements of each inner-most sub-vector.
+     * @param os Binary output stream
+     * @param container DArray, DTensor, DVector or JaggedDVector written
+     * @throws std::runtime_error If the stream fails
+     * @see mdc::io
+     */
+    template<SerializableContainer C>
+    void write(std::ostream &os, const C &container) {
+        detail::StreamSink sink(os);
+        detail::write(sink, container);
+    }
+
+    /***
+     * @brief Read a container written by write(std::ostream &, const C &), replacing its content
+     * @param is Binary input stream
+     * @param container Container overwritten. A DArray must have the same shape of the one written,
+     *                  a DTensor can only be read from dense containers,
+     *                  while DVector and JaggedDVector can be read from any layout
+     * @throws std::runtime_error If the stream does not hold a container of the same element type and rank
+     */
+    template<SerializableContainer C>
+    void read(std::istream &is, C &container) {
+        detail::StreamSource source(is);
+        detail::readPayload(source, detail::decode(source), container);
+    }
+
+    /***
+     * @see read(std::istream &is, C &container)
+     * @return Container read
+     */
+    template<SerializableContainer C>
+    C read(std::istream &is) {
+        C container{};
+        read(is, container);
+        return container;
+    }
+
+    /***
+     * @brief Read only the header of a serialized container
+     * @param is Binary input stream, positioned at the first element once returned
+     * @return Decoded header
+     */
+    inline Header read_header(std::istream &is) {
+        detail::StreamSource source(is);
+        return detail::decode(source);
+    }
+
+#ifdef DCONTAINERS_POSIX_IO
+    /***
+     * @brief Write a container in binary format to a file descriptor, through a single buffer
+     * @param fd File descriptor open for writing
+     * @param container DArray, DTensor, DVector or JaggedDVector written
+     * @throws std::system_error If writing fails
+     * @see write(std::ostream &os, const C &container)
+     */
+    template<SerializableContainer C>
+    void write(int fd, const C &container) {
+        detail::FdSink sink(fd);
+        detail::write(sink, container);
+    }
+
+    /***
+     * @brief Read a container from a file descriptor, replacing its content
+     * @param fd File descriptor open for reading
+     * @param container Container overwritten
+     * @throws std::system_error If reading fails
+     * @throws std::runtime_error If the file does not hold a container of the same element type and rank
+     * @see read(std::istream &is, C &container)
+     */
+    template<SerializableContainer C>
+    void read(int fd, C &container) {
+        detail::FdSource source(fd);
+        detail::readPayload(source, detail::decode(source), container);
+    }
+
+    /***
+     * @see read(int fd, C &container)
+     * @return Container read
+     */
+    template<SerializableContainer C>
+    C read(int fd) {
+        C container{};
+        read(fd, container);
+        return container;
+    }
+#endif
+
+}
+
+
+#endif //DCONTAINERS_SERIALIZATION_HPP
@@ -0,0 +1,322 @@
+/*
+ *   Copyright 2022 Alberto Guarnieri
+ *
+ *   Licensed under the Apache License, Version 2.0 (the "License");
+ *   you may not use this file except in compliance with the License.
+ *   You may obtain a copy of the License at
+ *
+ *       http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *   Unless required by applicable law or agreed to in writing, software
+ *   distributed under the License is distributed on an "AS IS" BASIS,
+ *   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *   See the License for the specific language governing permissions and
+ *   limitations under the License.
+ */
+
+
+#ifndef DCONTAINERS_SIMD_HPP
+#define DCONTAINERS_SIMD_HPP
+
+
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <limits>
+#include <type_traits>
+#include <utility>
+
+#if !defined(DCONTAINERS_NO_SIMD) && (defined(__GNUC__) || defined(__clang__)) && \
+    (defined(__x86_64__) || defined(__i386__))
+#define DCONTAINERS_SIMD_X86 1
+#else
+#define DCONTAINERS_SIMD_X86 0
+#endif
+
+
+namespace mdc::simd {
+
+    /***
+     * @brief Instruction sets targeted by the reduction kernels, ordered by vector width.
+     *        Kernels are compiled for every instruction set, and the widest one supported by the CPU is selected
+     *        at runtime. Defining DCONTAINERS_NO_SIMD restricts every kernel to its Scalar version.
+     */
+    enum class Isa {
+        Scalar = 0,
+        SSE2 = 1,
+        AVX2 = 2,
+        AVX512 = 3
+    };
+
+    /***
+     * @return Widest instruction set supported by the running CPU, detected once
+     */
+    inline Isa detected() noexcept {
+#if DCONTAINERS_SIMD_X86
+        static const Isa isa = [] {
+            __builtin_cpu_init();
+            if (__builtin_cpu_supports("avx512f"))
+                return Isa::AVX512;
+            if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma"))
+                return Isa::AVX2;
+            if (__builtin_cpu_supports("sse2"))
+                return Isa::SSE2;
+            return Isa::Scalar;
+        }();
+        return isa;
+#else
+        return Isa::Scalar;
+#endif
+    }
+
+    namespace detail {
+
+        enum class Kernel {
+            Sum,
+            Min,
+            Max,
+            Dot
+        };
+
+        /***
+         * @brief Element types handled by vector kernels, other types always use the Scalar ones
+         */
+        template<typename T>
+        concept Vectorizable = std::is_arithmetic_v<T> && !std::is_same_v<T, bool>
+                               && (sizeof(T) == 4 || sizeof(T) == 8);
+
+        /***
+         * @return Whether value is a floating point NaN, which compares unordered with every value
+         */
+        template<typename T>
+        constexpr bool isNaN(const T &value) {
+            if constexpr (std::is_floating_point_v<T>)
+                return value != value;
+            else
+                return false;
+        }
+
+        // Min and Max propagate NaNs, which would otherwise be kept or dropped depending on their position
+        template<Kernel K, typename T>
+        constexpr T combine(const T &lhs, const T &rhs) {
+            if constexpr (K == Kernel::Min)
+                return rhs < lhs || isNaN(rhs) ? rhs : lhs;
+            else if constexpr (K == Kernel::Max)
+                return lhs < rhs || isNaN(rhs) ? rhs : lhs;
+            else
+                return lhs + rhs;
+        }
+
+        template<Kernel K, typename T>
+        constexpr T scalarKernel(const T *first, const T *second, std::size_t count) {
+            T result = K == Kernel::Min || K == Kernel::Max ? first[0] : T();
+            for (std::size_t i = 0; i < count; ++i) {
+                if constexpr (K == Kernel::Dot)
+                    result += first[i] * second[i];
+                else
+                    result = combine<K>(result, first[i]);
+            }
+            return result;
+        }
+
+#if DCONTAINERS_SIMD_X86
+
+        template<std::size_t Bytes, typename T>
+        struct VectorOf {
+            typedef T type __attribute__((vector_size(Bytes)));
+        };
+
+        /***
+         * @brief Generic vector kernel, with four independent accumulators of Bytes / sizeof(T) lanes each.
+         *        It is always inlined into the wrappers below, which compile it for a specific instruction set.
+         * @note Min and Max require count > 0
+         */
+        template<Kernel K, std::size_t Bytes, typename T>
+        [[gnu::always_inline]] inline T vectorKernel(const T *first, const T *second, std::size_t count) {
+            using V = typename VectorOf<Bytes, T>::type;
+            constexpr std::size_t W = Bytes / sizeof(T);
+            if (count < 4 * W)
+                return scalarKernel<K>(first, second, count);
+
+            V acc[4];
+            // lanes which met a NaN, tracked apart so that Min and Max keep compiling to a single instruction
+            decltype(acc[0] != acc[0]) unordered[4]{};
+            std::size_t i = 0;
+            if constexpr (K == Kernel::Min || K == Kernel::Max) {
+                for (std::size_t j = 0; j < 4; ++j) {
+                    std::memcpy(&acc[j], first + j * W, sizeof(V));
+                    unordered[j] = acc[j] != acc[j];
+                }
+                i = 4 * W;
+            } else {
+                for (auto &a: acc)
+                    a = V{};
+            }
+            for (; i + 4 * W <= count; i += 4 * W) {
+                for (std::size_t j = 0; j < 4; ++j) {
+                    V x;
+                    std::memcpy(&x, first + i + j * W, sizeof(V));
+                    if constexpr (K == Kernel::Sum) {
+                        acc[j] += x;
+                    } else if constexpr (K == Kernel::Min) {
+                        acc[j] = x < acc[j] ? x : acc[j];
+                        if constexpr (std::is_floating_point_v<T>)
+                            unordered[j] |= x != x;
+                    } else if constexpr (K == Kernel::Max) {
+                        acc[j] = x > acc[j] ? x : acc[j];
+                        if constexpr (std::is_floating_point_v<T>)
+                            unordered[j] |= x != x;
+                    } else {
+                        V y;
+                        std::memcpy(&y, second + i + j * W, sizeof(V));
+                        acc[j] += x * y;
+                    }
+                }
+            }
+            for (std::size_t j = 1; j < 4; ++j) {
+                if constexpr (K == Kernel::Min)
+                    acc[0] = acc[j] < acc[0] ? acc[j] : acc[0];
+                else if constexpr (K == Kernel::Max)
+                    acc[0] = acc[j] > acc[0] ? acc[j] : acc[0];
+                else
+                    acc[0] += acc[j];
+                unordered[0] |= unordered[j];
+            }
+            if constexpr (K == Kernel::Min || K == Kernel::Max)
+                for (std::size_t k = 0; k < W; ++k)
+                    if (unordered[0][k])
+                        return std::numeric_limits<T>::quiet_NaN();
+            T result = acc[0][0];
+            for (std::size_t k = 1; k < W; ++k)
+                result = combine<K>(result, static_cast<T>(acc[0][k]));
+            for (; i < count; ++i) {
+                if constexpr (K == Kernel::Dot)
+                    result += first[i] * second[i];
+                else
+                    result = combine<K>(result, first[i]);
+            }
+            return result;
+        }
+
+        template<Kernel K, typename T>
+        T kernelSSE2(const T *first, const T *second, std::size_t count) {
+            return vectorKernel<K, 16>(first, second, count);
+        }
+
+        template<Kernel K, typename T>
+        [[gnu::target("avx2,fma")]] T kernelAVX2(const T *first, const T *second, std::size_t count) {
+            return vectorKernel<K, 32>(first, second, count);
+        }
+
+        template<Kernel K, typename T>
+        [[gnu::target("avx512f")]] T kernelAVX512(const T *first, const T *second, std::size_t count) {
+            return vectorKernel<K, 64>(first, second, count);
+        }
+
+#endif
+
+        template<Kernel K, typename T>
+        T dispatch(const T *first, const T *second, std::size_t count, [[maybe_unused]] Isa isa) {
+#if DCONTAINERS_SIMD_X86
+            if constexpr (Vectorizable<T>) {
+                switch (std::min(isa, detected())) {
+                    case Isa::AVX512:
+                        return kernelAVX512<K>(first, second, count);
+                    case Isa::AVX2:
+                        return kernelAVX2<K>(first, second, count);
+                    case Isa::SSE2:
+                        return kernelSSE2<K>(first, second, count);
+                    case Isa::Scalar:
+                        break;
+                }
+            }
+#endif
+            return scalarKernel<K>(first, second, count);
+        }
+
+    }
+
+    /***
+     * @brief Sum of contiguous elements, accumulated with type T
+     * @param first Pointer to the first element
+     * @param count Number of elements
+     * @param isa Widest instruction set used, lowered to the one detected if not supported by the CPU
+     * @return Sum of the elements, T() if count is zero
+     * @note Partial sums are accumulated in a different order than a sequential loop,
+     *       hence results with floating point types may differ by rounding
+     */
+    template<typename T>
+    T sum(const T *first, std::size_t count, Isa isa = detected()) {
+        return detail::dispatch<detail::Kernel::Sum>(first, first, count, isa);
+    }
+
+    /***
+     * @brief Minimum of contiguous elements
+     * @param first Pointer to the first element
+     * @param count Number of elements, must be greater than zero
+     * @param isa Widest instruction set used, lowered to the one detected if not supported by the CPU
+     * @return Smallest element, NaN if any element is NaN
+     */
+    template<typename T>
+    T min(const T *first, std::size_t count, Isa isa = detected()) {
+        return detail::dispatch<detail::Kernel::Min>(first, first, count, isa);
+    }
+
+    /***
+     * @brief Maximum of contiguous elements
+     * @param first Pointer to the first element
+     * @param count Number of elements, must be greater than zero
+     * @param isa Widest instruction set used, lowered to the one detected if not supported by the CPU
+     * @return Greatest element, NaN if any element is NaN
+     */
+    template<typename T>
+    T max(const T *first, std::size_t count, Isa isa = detected()) {
+        return detail::dispatch<detail::Kernel::Max>(first, first, count, isa);
+    }
+
+    /***
+     * @brief Position of the first greatest element among contiguous elements.
+     *        Elements are scanned in blocks small enough to stay in cache: only the block holding
+     *        the greatest element is scanned a second time to find its position.
+     * @param first Pointer to the first element
+     * @param count Number of elements, must be greater than zero
+     * @param isa Widest instruction set used, lowered to the one detected if not supported by the CPU
+     * @return Index of the first greatest element, along with its value.
+     *         If any element is NaN, index of the first NaN instead.
+     */
+    template<typename T>
+    std::pair<std::size_t, T> argmax(const T *first, std::size_t count, Isa isa = detected()) {
+        constexpr std::size_t block = 1024;
+        std::size_t bestBlock = 0;
+        T best = max(first, std::min(block, count), isa);
+        for (std::size_t b = block; b < count && !detail::isNaN(best); b += block) {
+            const T blockMax = max(first + b, std::min(block, count - b), isa);
+            if (best < blockMax || detail::isNaN(blockMax)) {
+                best = blockMax;
+                bestBlock = b;
+            }
+        }
+        const T *last = first + std::min(bestBlock + block, count);
+        const T *position = detail::isNaN(best)
+                            ? std::find_if(first + bestBlock, last, [](const T &value) { return detail::isNaN(value); })
+                            : std::find(first + bestBlock, last, best);
+        return {static_cast<std::size_t>(position - first), *position};
+    }
+
+    /***
+     * @brief Dot product of two contiguous ranges of the same length, accumulated with type T
+     * @param first Pointer to the first element of the first range
+     * @param second Pointer to the first element of the second range
+     * @param count Number of elements of each range
+     * @param isa Widest instruction set used, lowered to the one detected if not supported by the CPU
+     * @return Sum of the products of the elements at the same position
+     */
+    template<typename T>
+    T dot(const T *first, const T *second, std::size_t count, Isa isa = detected()) {
+        return detail::dispatch<detail::Kernel::Dot>(first, second, count, isa);
+    }
+
+}
+
+
+#endif //DCONTAINERS_SIMD_HPP
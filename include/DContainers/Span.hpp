@@ -49,6 +49,18 @@ namespace mdc {
             return mdc::Spanning{from, to};
         }
 
+        /***
+         * @brief Runtime span across an interval of two indices, taking one index every step
+         * @param from First index spanned (included)
+         * @param to Last index spanned (included only if reached by a multiple of step from from)
+         * @param step Distance between two consecutive indices spanned
+         * @return Span of a strided interval between two indices
+         * @throws std::invalid_argument If step is zero
+         */
+        static constexpr auto of(std::size_t from, std::size_t to, std::size_t step) {
+            return mdc::Spanning{from, to, step};
+        }
+
         /***
          * @brief Compile-time span across a single index, equals to interval<Value,Value>()
          * @tparam Value Index of the element spanned
@@ -70,6 +82,19 @@ namespace mdc {
             return mdc::DSpanning<mdc::SpanSize::Interval<From, To>>{};
         }
 
+        /***
+         * @brief Compile-time span across an interval taking one index every Step,
+         *        where first and last indices are expressed at compile-time
+         * @tparam From First index spanned (included)
+         * @tparam To Last index spanned (included only if reached by a multiple of Step from From)
+         * @tparam Step Distance between two consecutive indices spanned
+         * @return DSpan of a strided interval across two given indices
+         */
+        template<std::size_t From, std::size_t To, std::size_t Step>
+        static constexpr auto of() {
+            return mdc::DSpanning<mdc::SpanSize::Interval<From, To, Step>>{};
+        }
+
         /***
          * @brief Compile-time span across an interval,
          *        where only the size (i.e. length) of the span is expressed at compile-time,
@@ -85,6 +110,22 @@ namespace mdc {
             return mdc::DSpanning<mdc::SpanSize::Interval<Size>>{from, to};
         }
 
+        /***
+         * @brief Compile-time span across a strided interval,
+         *        where only the number of indices spanned is expressed at compile-time,
+         *        first and last positions and step are given at runtime
+         * @tparam Size Number of indices spanned
+         * @param from First index spanned (included)
+         * @param to Last index spanned (included only if reached by a multiple of step from from)
+         * @param step Distance between two consecutive indices spanned
+         * @return DSpan of a strided interval of a given size across two indices
+         * @throws std::length_error If the number of indices spanned is different than Size
+         */
+        template<std::size_t Size>
+        static constexpr auto of(std::size_t from, std::size_t to, std::size_t step) {
+            return mdc::DSpanning<mdc::SpanSize::Interval<Size>>{from, to, step};
+        }
+
         /***
          * @brief Compile-time description of a span across the entire domain
          * @return DSpan of a full span
@@ -17,6 +17,11 @@
 #ifndef DCONTAINERS_DSPANNING_HPP
 #define DCONTAINERS_DSPANNING_HPP
 
+#include <concepts>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+
 #include "Spanning.hpp"
 
 namespace mdc {
@@ -45,7 +50,7 @@ namespace mdc {
         class Index : public Size {
         };
 
-        template<std::size_t ...S> requires (sizeof...(S) == 1 || sizeof...(S) == 2)
+        template<std::size_t ...S> requires (sizeof...(S) >= 1 && sizeof...(S) <= 3)
         class Interval : public Size {
         };
 
@@ -66,6 +71,16 @@ namespace mdc {
         class Interval<From, To> : public Size {
         };
 
+        /***
+         * @brief Interval described by its first and last indices, taking one index every Step
+         * @tparam From First index spanned (included)
+         * @tparam To Last index spanned (included only if reached by a multiple of Step from From)
+         * @tparam Step Distance between two consecutive indices spanned
+         */
+        template<std::size_t From, std::size_t To, std::size_t Step> requires (Step > 0)
+        class Interval<From, To, Step> : public Size {
+        };
+
     };
 
 
@@ -108,6 +123,21 @@ namespace mdc {
         constexpr DSpanning() : mdc::Spanning(From, To) {}
     };
 
+    /***
+     * @brief Compile-time description of a span going from one index to another, taking one index every Step
+     * @see SpanSize::Interval<From, To, Step>
+     */
+    template<std::size_t From, std::size_t To, std::size_t Step>
+    class DSpanning<SpanSize::Interval<From, To, Step>> : public mdc::Spanning {
+    public:
+        /***
+         * @brief Number of indices spanned
+         */
+        static constexpr std::size_t Size = To < From ? 0 : (To - From) / Step + 1;
+
+        constexpr DSpanning() : mdc::Spanning(From, To, Step) {}
+    };
+
     /***
      * @brief Compile-time description of a span of a given size (i.e. length)
      * @see SpanSize::Interval<Size>
@@ -126,8 +156,46 @@ namespace mdc {
                         "Span passed as parameter (from=" + std::to_string(from) + ", to=" + std::to_string(to) + ")" +
                         " has a different size than template (Size=" + std::to_string(Size) + ")");
         }
+
+        /***
+         * @param from First index spanned
+         * @param to Last index spanned (included only if reached by a multiple of step from from)
+         * @param step Distance between two consecutive indices spanned
+         * @throws std::length_error When template Size and the number of indices spanned are not equal
+         */
+        constexpr DSpanning(std::size_t from, std::size_t to, std::size_t step) : mdc::Spanning(from, to, step) {
+            if (size() != Size)
+                throw std::length_error(
+                        "Span passed as parameter (from=" + std::to_string(from) + ", to=" + std::to_string(to) +
+                        ", step=" + std::to_string(step) + ")" +
+                        " has a different size than template (Size=" + std::to_string(Size) + ")");
+        }
     };
 
+    namespace detail {
+
+        template<typename S>
+        struct IsDSpanning : std::false_type {
+        };
+
+        template<typename S> requires (std::derived_from<S, SpanSize::Size> && !std::same_as<S, SpanSize::Size>)
+        struct IsDSpanning<DSpanning<S>> : std::true_type {
+        };
+
+        /***
+         * @brief Span whose position and length are part of its type, i.e. a DSpanning
+         */
+        template<typename S>
+        concept StaticSpanning = IsDSpanning<std::remove_cvref_t<S>>::value;
+
+        /***
+         * @brief Spans where at least one is only known at runtime, i.e. is a plain Spanning
+         */
+        template<typename... S>
+        concept RuntimeSpannings = (std::is_convertible_v<S, mdc::Spanning> && ...) && !(StaticSpanning<S> && ...);
+
+    }
+
 }
 
 #endif //DCONTAINERS_DSPANNING_HPP
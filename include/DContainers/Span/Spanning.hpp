@@ -18,18 +18,19 @@
 #define DCONTAINERS_SPANNING_HPP
 
 #include <cstddef>
+#include <stdexcept>
 
 
 namespace mdc {
 
     /***
-     * @brief Represent a span of indices from one index to another
+     * @brief Represent a span of indices from one index to another, optionally taking one index every step
      * @note Span is a structural type
      * @warning Span is not default constructible
      */
     struct Spanning {
     private:
-        constexpr Spanning() : from(0), to(0), isAll(true) {}
+        constexpr Spanning() : from(0), to(0), isAll(true), step(1) {}
 
     public:
         /***
@@ -48,28 +49,60 @@ namespace mdc {
          */
         const bool isAll;
 
+        /***
+         * @brief Distance between two consecutive indices spanned, 1 for contiguous intervals
+         */
+        const std::size_t step;
+
         /***
          * @brief Construct a Span object representing an interval between two indices
          * @param _from starting index (included)
          * @param _to final index (included, not past-the-end)
          */
-        constexpr Spanning(std::size_t _from, std::size_t _to) : from(_from), to(_to), isAll(false) {}
+        constexpr Spanning(std::size_t _from, std::size_t _to) : from(_from), to(_to), isAll(false), step(1) {}
+
+        /***
+         * @brief Construct a Span object representing one index every _step, starting from _from up to _to
+         * @param _from starting index (included)
+         * @param _to final index (included only if reached by a multiple of _step from _from)
+         * @param _step distance between two consecutive indices spanned
+         * @throws std::invalid_argument If _step is zero
+         */
+        constexpr Spanning(std::size_t _from, std::size_t _to, std::size_t _step)
+                : from(_from), to(_to), isAll(false), step(_step) {
+            if (_step == 0)
+                throw std::invalid_argument("Span step must be greater than zero");
+        }
 
         /***
          * @brief Construct a Span object representing a single index, equals to Span(value, value)
          * @param value index
          */
-        explicit constexpr Spanning(std::size_t value) : from(value), to(value), isAll(false) {}
+        explicit constexpr Spanning(std::size_t value) : from(value), to(value), isAll(false), step(1) {}
+
+        /***
+         * @return Number of indices spanned, not defined for a span constructed using all()
+         */
+        constexpr std::size_t size() const noexcept {
+            return to < from ? 0 : (to - from) / step + 1;
+        }
+
+        /***
+         * @return Last index actually spanned, i.e. the greatest from + k * step not past to
+         */
+        constexpr std::size_t last() const noexcept {
+            return to < from ? from : from + (to - from) / step * step;
+        }
 
         /***
-         * @return true iff the two spans are both all or from and to values are respectively equal
+         * @return true iff the two spans are both all or they span the same indices
          */
         constexpr bool operator==(const Spanning &other) const {
-            if (isAll && other.isAll)
-                return true;
-            if (from == other.from && to == other.to)
-                return true;
-            return false;
+            if (isAll || other.isAll)
+                return isAll && other.isAll;
+            if (from != other.from || size() != other.size())
+                return false;
+            return size() <= 1 || step == other.step;
         }
 
         /***
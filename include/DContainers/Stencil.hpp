@@ -0,0 +1,534 @@
+/*
+ *   Copyright 2022 Alberto Guarnieri
+ *
+ *   Licensed under the Apache License, Version 2.0 (the "License");
+ *   you may not use this file except in compliance with the License.
+ *   You may obtain a copy of the License at
+ *
+ *       http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *   Unless required by applicable law or agreed to in writing, software
+ *   distributed under the License is distributed on an "AS IS" BASIS,
+ *   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *   See the License for the specific language governing permissions and
+ *   limitations under the License.
+ */
+
+#ifndef DCONTAINERS_STENCIL_HPP
+#define DCONTAINERS_STENCIL_HPP
+
+
+#include <algorithm>
+#include <array>
+#include <concepts>
+#include <cstddef>
+#include <stdexcept>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "DContainers/DArray.hpp"
+#include "DContainers/DTensor.hpp"
+#include "DContainers/DVector.hpp"
+
+
+namespace mdc {
+
+    namespace detail {
+
+        template<std::size_t D>
+        using Offset = std::array<std::ptrdiff_t, D>;
+
+        /***
+         * @brief Offsets of the centre, followed by its two nearest neighbours along each dimension
+         */
+        template<std::size_t D>
+        constexpr std::array<Offset<D>, 2 * D + 1> crossOffsets() noexcept {
+            std::array<Offset<D>, 2 * D + 1> offsets{};
+            for (std::size_t d = 0; d < D; ++d) {
+                offsets[2 * d + 1][d] = -1;
+                offsets[2 * d + 2][d] = 1;
+            }
+            return offsets;
+        }
+
+        template<std::size_t D>
+        inline constexpr std::size_t boxSize = 3 * boxSize<D - 1>;
+
+        template<>
+        inline constexpr std::size_t boxSize<0> = 1;
+
+        /***
+         * @brief Every offset between -1 and 1 along each dimension, in row-major order
+         */
+        template<std::size_t D>
+        constexpr std::array<Offset<D>, boxSize<D>> boxOffsets() noexcept {
+            std::array<Offset<D>, boxSize<D>> offsets{};
+            for (std::size_t k = 0; k < boxSize<D>; ++k) {
+                std::size_t rest = k;
+                for (std::size_t d = D; d-- > 0;) {
+                    offsets[k][d] = static_cast<std::ptrdiff_t>(rest % 3) - 1;
+                    rest /= 3;
+                }
+            }
+            return offsets;
+        }
+
+        /***
+         * @brief Distance of the farthest offset along each dimension, towards lower (-1) or higher (1) indices
+         */
+        template<std::size_t D, std::size_t K>
+        constexpr std::array<std::size_t, D> reach(const std::array<Offset<D>, K> &offsets,
+                                                   std::ptrdiff_t direction) noexcept {
+            std::array<std::size_t, D> distance{};
+            for (const auto &offset: offsets)
+                for (std::size_t d = 0; d < D; ++d)
+                    if (offset[d] * direction > 0)
+                        distance[d] = std::max(distance[d], static_cast<std::size_t>(offset[d] * direction));
+            return distance;
+        }
+
+    }
+
+    /***
+     * @brief Shapes of the neighbourhood read by a stencil around each element, fixed at compile time
+     */
+    struct Neighbourhood {
+        /***
+         * @brief Neighbourhood made of any list of offsets, e.g. for an upwind scheme
+         * @code
+         * constexpr std::array<std::array<std::ptrdiff_t, 2>, 3> upwind{{{0, 0}, {-1, 0}, {0, -1}}};
+         * using Upwind = mdc::Neighbourhood::Custom<upwind>;
+         * @endcode
+         * @tparam Offsets Array of offsets, each one holding a signed distance for each dimension
+         */
+        template<auto Offsets>
+        struct Custom {
+            using offset_type = typename std::remove_cvref_t<decltype(Offsets)>::value_type;
+
+            static constexpr std::size_t rank = std::tuple_size_v<offset_type>;
+            static constexpr std::size_t size = std::tuple_size_v<std::remove_cvref_t<decltype(Offsets)>>;
+            static_assert(rank > 0 && size > 0, "Neighbourhood must have at least one offset and one dimension");
+
+            static constexpr std::array<offset_type, size> offsets = Offsets;
+
+            // Halo around the grid, i.e. how far neighbours reach below and above each element
+            static constexpr std::array<std::size_t, rank> low = detail::reach<rank>(offsets, -1);
+            static constexpr std::array<std::size_t, rank> high = detail::reach<rank>(offsets, 1);
+
+            /***
+             * @return Position of offset inside the neighbourhood, or size if missing
+             */
+            static constexpr std::size_t indexOf(const offset_type &offset) noexcept {
+                for (std::size_t k = 0; k < size; ++k)
+                    if (offsets[k] == offset)
+                        return k;
+                return size;
+            }
+        };
+
+        // Centre followed by its neighbours along rows and columns: {0,0}, {-1,0}, {1,0}, {0,-1}, {0,1}
+        using FivePoint = Custom<detail::crossOffsets<2>()>;
+
+        // Centre followed by its neighbours along each of the three axes
+        using SevenPoint = Custom<detail::crossOffsets<3>()>;
+
+        // Whole 3x3 square in row-major order, having the centre at index 4
+        using NinePoint = Custom<detail::boxOffsets<2>()>;
+
+        // Whole 3x3x3 cube in row-major order, having the centre at index 13
+        using TwentySevenPoint = Custom<detail::boxOffsets<3>()>;
+    };
+
+    /***
+     * @brief Policies for neighbours falling outside of the grid
+     */
+    struct Boundary {
+        /***
+         * @brief Neighbours outside of the grid repeat the nearest element on the border
+         */
+        struct Clamp {
+            constexpr bool resolve(std::ptrdiff_t &index, std::size_t extent) const noexcept {
+                index = std::clamp<std::ptrdiff_t>(index, 0, static_cast<std::ptrdiff_t>(extent) - 1);
+                return true;
+            }
+        };
+
+        /***
+         * @brief Grid is periodic, hence neighbours outside of it are taken from the opposite border
+         */
+        struct Wrap {
+            constexpr bool resolve(std::ptrdiff_t &index, std::size_t extent) const noexcept {
+                // neighbours are usually closer than a whole extent, hence cheaper than a division
+                const auto size = static_cast<std::ptrdiff_t>(extent);
+                while (index < 0)
+                    index += size;
+                while (index >= size)
+                    index -= size;
+                return true;
+            }
+        };
+
+        /***
+         * @brief Neighbours outside of the grid hold the same value, e.g. a Dirichlet boundary condition
+         * @code
+         * mdc::stencil<mdc::Neighbourhood::FivePoint>(input, output, kernel, mdc::Boundary::Constant{0.0f});
+         * @endcode
+         */
+        template<typename T>
+        struct Constant {
+            T value;
+
+            constexpr bool resolve(std::ptrdiff_t &index, std::size_t extent) const noexcept {
+                return index >= 0 && static_cast<std::size_t>(index) < extent;
+            }
+        };
+
+        /***
+         * @brief Outer layers of the grid, as thick as the neighbourhood reaches, are ghost cells filled by the
+         *        caller (e.g. exchanged with adjacent grids), hence the kernel is applied only inside of them.
+         *        Ghost cells of the output are left untouched.
+         */
+        struct Ghost {};
+    };
+
+    namespace detail {
+
+        /***
+         * @brief Pointers to each inner-most line of a dense grid, i.e. a row of a matrix, in row-major order
+         */
+        template<std::size_t D, typename T>
+        struct Lines {
+            std::array<std::size_t, D> shape{};
+            std::array<std::size_t, D> strides{};
+            std::vector<T *> first;
+
+            /***
+             * @return Number of lines of a grid with the given shape
+             */
+            std::size_t setShape(const std::array<std::size_t, D> &extents) {
+                shape = extents;
+                std::size_t stride = 1;
+                for (std::size_t d = D - 1; d-- > 0;) {
+                    strides[d] = stride;
+                    stride *= shape[d];
+                }
+                first.reserve(stride);
+                return stride;
+            }
+
+            T *line(const std::array<std::size_t, D> &position) const noexcept {
+                std::size_t index = 0;
+                for (std::size_t d = 0; d + 1 < D; ++d)
+                    index += position[d] * strides[d];
+                return first[index];
+            }
+        };
+
+        template<std::size_t D, typename T>
+        Lines<D, T> denseLines(T *data, const std::array<std::size_t, D> &shape) {
+            Lines<D, T> lines;
+            const std::size_t count = lines.setShape(shape);
+            for (std::size_t l = 0; l < count; ++l)
+                lines.first.push_back(data + l * shape[D - 1]);
+            return lines;
+        }
+
+        template<typename T, std::size_t N, std::size_t... O>
+        Lines<sizeof...(O) + 1, T> linesOf(DArray<T, N, O...> &dArray) {
+            return denseLines<sizeof...(O) + 1>(dArray.flat_begin(), {N, O...});
+        }
+
+        template<typename T, std::size_t N, std::size_t... O>
+        Lines<sizeof...(O) + 1, const T> linesOf(const DArray<T, N, O...> &dArray) {
+            return denseLines<sizeof...(O) + 1>(dArray.flat_begin(), {N, O...});
+        }
+
+        template<std::size_t D, typename T>
+        Lines<D, T> linesOf(DTensor<D, T> &dTensor) {
+            return denseLines<D>(dTensor.flat_begin(), dTensor.shape());
+        }
+
+        template<std::size_t D, typename T>
+        Lines<D, const T> linesOf(const DTensor<D, T> &dTensor) {
+            return denseLines<D>(dTensor.flat_begin(), dTensor.shape());
+        }
+
+        template<std::size_t L, std::size_t D, typename T, typename Vector>
+        void collectLines(Vector &vector, Lines<D, T> &lines) {
+            if (vector.size() != lines.shape[D - L])
+                throw std::invalid_argument("stencil: DVector is not rectangular");
+            if constexpr (L == 1)
+                lines.first.push_back(vector.data());
+            else
+                for (auto &subVector: vector)
+                    collectLines<L - 1>(subVector, lines);
+        }
+
+        template<std::size_t L, std::size_t D, typename Vector>
+        void shapeOfVector(Vector &vector, std::array<std::size_t, D> &shape) {
+            shape[D - L] = vector.size();
+            if constexpr (L > 1)
+                if (!vector.empty())
+                    shapeOfVector<L - 1>(vector[0], shape);
+        }
+
+        template<std::size_t D, typename T, typename Vector>
+        Lines<D, T> vectorLines(Vector &vector) {
+            std::array<std::size_t, D> shape{};
+            shapeOfVector<D>(vector, shape);
+            Lines<D, T> lines;
+            lines.setShape(shape);
+            collectLines<D>(vector, lines);
+            return lines;
+        }
+
+        template<std::size_t D, typename T, typename Allocator>
+        Lines<D, T> linesOf(DVector<D, T, Allocator> &dVector) {
+            return vectorLines<D, T>(dVector);
+        }
+
+        template<std::size_t D, typename T, typename Allocator>
+        Lines<D, const T> linesOf(const DVector<D, T, Allocator> &dVector) {
+            return vectorLines<D, const T>(dVector);
+        }
+
+        /***
+         * @brief Neighbours of an element whose neighbourhood lies inside the grid, read without any check.
+         *        Lines are those crossed by the box enclosing the neighbourhood, in row-major order, so that any
+         *        offset is resolved by arithmetic alone, and neighbours on the same line share its pointer.
+         */
+        template<typename N, typename T>
+        class InnerNeighbours {
+            static constexpr std::size_t D = N::rank;
+
+            const T *const *_lines;
+            std::ptrdiff_t _index;
+
+        public:
+            // Lines crossed by the box enclosing the neighbourhood
+            static constexpr std::size_t lineCount = [] {
+                std::size_t count = 1;
+                for (std::size_t d = 0; d + 1 < D; ++d)
+                    count *= N::low[d] + N::high[d] + 1;
+                return count;
+            }();
+
+            /***
+             * @return Position of the line holding the neighbour at offset
+             */
+            static constexpr std::size_t lineOf(const Offset<D> &offset) noexcept {
+                std::size_t line = 0;
+                for (std::size_t d = 0; d + 1 < D; ++d)
+                    line = line * (N::low[d] + N::high[d] + 1) +
+                           static_cast<std::size_t>(offset[d] + static_cast<std::ptrdiff_t>(N::low[d]));
+                return line;
+            }
+
+            InnerNeighbours(const T *const *lines, std::size_t index) noexcept
+                    : _lines(lines), _index(static_cast<std::ptrdiff_t>(index)) {}
+
+            /***
+             * @return Neighbour at the given offset from the element
+             */
+            const T &at(const Offset<D> &offset) const noexcept {
+                return _lines[lineOf(offset)][_index + offset[D - 1]];
+            }
+
+            /***
+             * @return k-th neighbour, in the order of the offsets of the neighbourhood
+             */
+            const T &operator[](std::size_t k) const noexcept {
+                return at(N::offsets[k]);
+            }
+
+            /***
+             * @return Neighbour at the given offset, within the reach of the neighbourhood
+             */
+            template<std::integral... I>
+            const T &operator()(I... offset) const noexcept requires (sizeof...(I) == D) {
+                return at({static_cast<std::ptrdiff_t>(offset)...});
+            }
+
+            /***
+             * @brief Call fn with all neighbours at once, in the order of the offsets of the neighbourhood.
+             *        Unlike a loop over operator[], neighbours are expanded at compile time, hence even large
+             *        neighbourhoods are read without any loop.
+             * @code
+             * auto mean = [](const auto &n) { return n.apply([](auto... values) { return (values + ...) / 27.0f; }); };
+             * @endcode
+             */
+            template<typename Fn>
+            decltype(auto) apply(Fn &&fn) const {
+                return [&]<std::size_t... K>(std::index_sequence<K...>) -> decltype(auto) {
+                    return std::forward<Fn>(fn)((*this)[K]...);
+                }(std::make_index_sequence<N::size>());
+            }
+        };
+
+        /***
+         * @brief Neighbours of an element near the border of the grid, resolved through a Boundary policy.
+         *        Each index reached along each dimension is resolved once, when the element is visited.
+         */
+        template<typename N, typename T, typename Policy>
+        class EdgeNeighbours {
+            static constexpr std::size_t D = N::rank;
+
+            static constexpr std::size_t side = [] {
+                std::size_t longest = 0;
+                for (std::size_t d = 0; d < D; ++d)
+                    longest = std::max(longest, N::low[d] + N::high[d] + 1);
+                return longest;
+            }();
+
+            const Lines<D, const T> &_grid;
+            const Policy &_policy;
+            // Index of each neighbour along each dimension, or -1 if outside of the grid
+            std::array<std::array<std::ptrdiff_t, side>, D> _indices;
+
+        public:
+            EdgeNeighbours(const Lines<D, const T> &grid, const Policy &policy,
+                           const std::array<std::size_t, D> &position) noexcept
+                    : _grid(grid), _policy(policy), _indices{} {
+                for (std::size_t d = 0; d < D; ++d)
+                    for (std::size_t o = 0; o <= N::low[d] + N::high[d]; ++o) {
+                        auto index = static_cast<std::ptrdiff_t>(position[d] + o - N::low[d]);
+                        _indices[d][o] = _policy.resolve(index, _grid.shape[d]) ? index : -1;
+                    }
+            }
+
+            T at(const Offset<D> &offset) const {
+                std::array<std::size_t, D> neighbour{};
+                for (std::size_t d = 0; d < D; ++d) {
+                    const auto index = _indices[d][static_cast<std::size_t>(
+                            offset[d] + static_cast<std::ptrdiff_t>(N::low[d]))];
+                    if constexpr (requires { _policy.value; })
+                        if (index < 0)
+                            return static_cast<T>(_policy.value);
+                    neighbour[d] = static_cast<std::size_t>(index);
+                }
+                return _grid.line(neighbour)[neighbour[D - 1]];
+            }
+
+            T operator[](std::size_t k) const {
+                return at(N::offsets[k]);
+            }
+
+            template<std::integral... I>
+            T operator()(I... offset) const requires (sizeof...(I) == D) {
+                return at({static_cast<std::ptrdiff_t>(offset)...});
+            }
+
+            template<typename Fn>
+            decltype(auto) apply(Fn &&fn) const {
+                return [&]<std::size_t... K>(std::index_sequence<K...>) -> decltype(auto) {
+                    return std::forward<Fn>(fn)((*this)[K]...);
+                }(std::make_index_sequence<N::size>());
+            }
+        };
+
+        template<typename N, typename T, typename U, typename Kernel, typename Policy>
+        void applyStencil(const Lines<N::rank, const T> &input, const Lines<N::rank, U> &output, Kernel &kernel,
+                          const Policy &policy) {
+            constexpr std::size_t D = N::rank;
+            constexpr bool ghost = std::is_same_v<Policy, Boundary::Ghost>;
+            if (input.shape != output.shape)
+                throw std::invalid_argument("stencil: input and output must have the same shape");
+            if (input.first.empty() || input.shape[D - 1] == 0)
+                return;
+
+            // interior of the inner-most dimension, where every neighbour lies on lines of the grid
+            const std::size_t extent = input.shape[D - 1];
+            const std::size_t from = std::min(N::low[D - 1], extent),
+                    to = std::max(from, extent > N::high[D - 1] ? extent - N::high[D - 1] : 0);
+
+            std::array<std::size_t, D> position{};
+            std::array<const T *, InnerNeighbours<N, T>::lineCount> lines{};
+            auto visit = [&](const auto &around, U *target) {
+                if constexpr (std::is_invocable_v<Kernel &, decltype(around), const std::array<std::size_t, D> &>)
+                    target[position[D - 1]] = kernel(around, std::as_const(position));
+                else
+                    target[position[D - 1]] = kernel(around);
+            };
+            auto edges = [&](U *target, std::size_t first, std::size_t last) {
+                if constexpr (!ghost)
+                    for (position[D - 1] = first; position[D - 1] < last; ++position[D - 1])
+                        visit(EdgeNeighbours<N, T, Policy>(input, policy, position), target);
+            };
+
+            for (std::size_t l = 0; l < input.first.size(); ++l) {
+                bool inside = true;
+                std::size_t rest = l;
+                for (std::size_t d = D - 1; d-- > 0;) {
+                    position[d] = rest % input.shape[d];
+                    rest /= input.shape[d];
+                    inside = inside && position[d] >= N::low[d] && position[d] + N::high[d] < input.shape[d];
+                }
+                U *target = output.first[l];
+                if (!inside) {
+                    edges(target, 0, extent);
+                    continue;
+                }
+                for (std::size_t b = 0; b < lines.size(); ++b) {
+                    std::array<std::size_t, D> neighbour = position;
+                    std::size_t box = b;
+                    for (std::size_t d = D - 1; d-- > 0;) {
+                        const std::size_t side = N::low[d] + N::high[d] + 1;
+                        neighbour[d] = position[d] + box % side - N::low[d];
+                        box /= side;
+                    }
+                    lines[b] = input.line(neighbour);
+                }
+                edges(target, 0, from);
+                // branch-free loop, as every neighbour is read at a fixed distance from the element
+                if constexpr (std::is_invocable_v<Kernel &, const InnerNeighbours<N, T> &,
+                        const std::array<std::size_t, D> &>) {
+                    for (position[D - 1] = from; position[D - 1] < to; ++position[D - 1])
+                        visit(InnerNeighbours<N, T>(lines.data(), position[D - 1]), target);
+                } else {
+                    for (std::size_t j = from; j < to; ++j)
+                        target[j] = kernel(InnerNeighbours<N, T>(lines.data(), j));
+                }
+                edges(target, to, extent);
+            }
+        }
+
+    }
+
+    /***
+     * @brief Compute each element of a grid from a neighbourhood of the same element in another grid.
+     *        Elements whose neighbourhood lies inside the grid are computed by a loop without any branch nor bound
+     *        check, while those near the border are computed separately, resolving neighbours outside of the
+     *        grid through the Boundary policy.
+     * @code
+     * // Jacobi iteration of the Laplace equation
+     * mdc::stencil<mdc::Neighbourhood::FivePoint>(current, next, [](const auto &n) {
+     *     return 0.25f * (n(-1, 0) + n(1, 0) + n(0, -1) + n(0, 1));
+     * }, mdc::Boundary::Constant{0.0f});
+     * @endcode
+     * @tparam N Neighbourhood read around each element, e.g. Neighbourhood::FivePoint
+     * @param input Grid read, i.e. DArray, DTensor, or rectangular DVector
+     * @param output Grid written, of the same shape of input, and not overlapping with it
+     * @param kernel Function called with the neighbours of each element, and optionally its position, returning
+     *               the new value of the element. Neighbours are accessed either by their order in N,
+     *               e.g. n[0], or by their offset within the reach of N, e.g. n(-1, 0), or all at once
+     *               through n.apply(fn).
+     * @param policy Boundary policy, i.e. Boundary::Clamp (by default), Wrap, Constant or Ghost
+     * @throws std::invalid_argument If input and output have different shapes, or any DVector is not rectangular
+     */
+    template<typename N, typename Input, typename Output, typename Kernel, typename Policy = Boundary::Clamp>
+    void stencil(const Input &input, Output &output, Kernel kernel, const Policy &policy = {}) {
+        const auto inputLines = detail::linesOf(input);
+        const auto outputLines = detail::linesOf(output);
+        static_assert(N::rank == std::tuple_size_v<decltype(inputLines.shape)>,
+                      "Neighbourhood must have the same number of dimensions of the grid");
+        using T = std::remove_const_t<std::remove_pointer_t<typename decltype(inputLines.first)::value_type>>;
+        using U = std::remove_pointer_t<typename decltype(outputLines.first)::value_type>;
+        detail::applyStencil<N, T, U>(inputLines, outputLines, kernel, policy);
+    }
+
+}
+
+
+#endif //DCONTAINERS_STENCIL_HPP
@@ -0,0 +1,209 @@
+/*
+ *   Copyright 2022 Alberto Guarnieri
+ *
+ *   Licensed under the Apache License, Version 2.0 (the "License");
+ *   you may not use this file except in compliance with the License.
+ *   You may obtain a copy of the License at
+ *
+ *       http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *   Unless required by applicable law or agreed to in writing, software
+ *   distributed under the License is distributed on an "AS IS" BASIS,
+ *   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *   See the License for the specific language governing permissions and
+ *   limitations under the License.
+ */
+
+
+#ifndef DCONTAINERS_THREADPOOL_HPP
+#define DCONTAINERS_THREADPOOL_HPP
+
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+
+namespace mdc::parallel {
+
+/***
+ * @brief Pool of worker threads, each with its own queue of tasks.
+ *        Idle workers steal tasks from the queues of the other workers, and a thread waiting for its tasks
+ *        to complete executes queued tasks as well, hence tasks may safely submit and wait for other tasks.
+ */
+    class ThreadPool {
+    private:
+        struct Queue {
+            std::mutex mutex;
+            std::deque<std::function<void()>> tasks;
+        };
+
+        std::vector<std::unique_ptr<Queue>> _queues;
+        std::vector<std::thread> _workers;
+        std::atomic<std::size_t> _queued{0};
+        std::atomic<std::size_t> _next{0};
+        std::mutex _sleepMutex;
+        std::condition_variable _wake;
+        bool _stop = false;
+
+        // Upper bound on the time an idle worker sleeps before looking for tasks again
+        static constexpr std::chrono::milliseconds idleTimeout{100};
+
+        // Pool and queue of the worker running on the current thread, if any
+        inline static thread_local ThreadPool *currentPool = nullptr;
+        inline static thread_local std::size_t currentQueue = 0;
+
+        void push(std::function<void()> task) {
+            const std::size_t index = currentPool == this ? currentQueue : _next++ % _queues.size();
+            {
+                std::lock_guard lock(_queues[index]->mutex);
+                _queues[index]->tasks.push_back(std::move(task));
+            }
+            ++_queued;
+        }
+
+        void notify() {
+            { std::lock_guard lock(_sleepMutex); }
+            _wake.notify_all();
+        }
+
+        /***
+         * @brief Take the most recent task of the own queue, or else steal the oldest task of another queue
+         */
+        std::function<void()> take() {
+            const std::size_t own = currentPool == this ? currentQueue : 0;
+            for (std::size_t k = 0; k < _queues.size(); ++k) {
+                auto &queue = *_queues[(own + k) % _queues.size()];
+                std::lock_guard lock(queue.mutex);
+                if (!queue.tasks.empty()) {
+                    std::function<void()> task;
+                    if (k == 0 && currentPool == this) {
+                        task = std::move(queue.tasks.back());
+                        queue.tasks.pop_back();
+                    } else {
+                        task = std::move(queue.tasks.front());
+                        queue.tasks.pop_front();
+                    }
+                    --_queued;
+                    return task;
+                }
+            }
+            return {};
+        }
+
+        void work(std::size_t index) {
+            currentPool = this;
+            currentQueue = index;
+            while (true) {
+                if (auto task = take()) {
+                    task();
+                    continue;
+                }
+                std::unique_lock lock(_sleepMutex);
+                _wake.wait_for(lock, idleTimeout, [this] { return _stop || _queued > 0; });
+                if (_stop && _queued == 0)
+                    return;
+            }
+        }
+
+    public:
+        /***
+         * @brief Construct a pool and start its workers
+         * @param workers Number of worker threads, in addition to the threads submitting tasks
+         */
+        explicit ThreadPool(std::size_t workers) {
+            _queues.reserve(workers);
+            for (std::size_t i = 0; i < workers; ++i)
+                _queues.push_back(std::make_unique<Queue>());
+            _workers.reserve(workers);
+            for (std::size_t i = 0; i < workers; ++i)
+                _workers.emplace_back([this, i] { work(i); });
+        }
+
+        ThreadPool(const ThreadPool &) = delete;
+
+        ThreadPool &operator=(const ThreadPool &) = delete;
+
+        /***
+         * @brief Complete all queued tasks, then stop and join every worker
+         */
+        ~ThreadPool() {
+            {
+                std::lock_guard lock(_sleepMutex);
+                _stop = true;
+            }
+            _wake.notify_all();
+            for (auto &worker: _workers)
+                worker.join();
+        }
+
+        /***
+         * @return Pool shared by all parallel algorithms, with one worker for each hardware thread but the caller
+         */
+        static ThreadPool &instance() {
+            static ThreadPool pool(std::max(std::thread::hardware_concurrency(), 1u) - 1);
+            return pool;
+        }
+
+        /***
+         * @return Number of worker threads
+         */
+        std::size_t size() const noexcept {
+            return _workers.size();
+        }
+
+        /***
+         * @brief Execute fn(i) for each i in [0, count), returning once all of them completed.
+         *        The calling thread executes queued tasks while waiting.
+         * @param count Number of tasks
+         * @param fn Function called with the index of each task
+         * @throws Rethrows the first exception thrown by a task, after all tasks completed
+         */
+        template<typename Fn>
+        void run(std::size_t count, Fn &&fn) {
+            if (_workers.empty() || count == 1) {
+                for (std::size_t i = 0; i < count; ++i)
+                    fn(i);
+                return;
+            }
+
+            std::atomic<std::size_t> remaining{count};
+            std::exception_ptr error;
+            std::mutex errorMutex;
+            for (std::size_t i = 0; i < count; ++i)
+                push([&, i] {
+                    try {
+                        fn(i);
+                    } catch (...) {
+                        std::lock_guard lock(errorMutex);
+                        if (!error)
+                            error = std::current_exception();
+                    }
+                    remaining.fetch_sub(1, std::memory_order_release);
+                });
+            notify();
+
+            while (remaining.load(std::memory_order_acquire) > 0) {
+                if (auto task = take())
+                    task();
+                else
+                    std::this_thread::yield();
+            }
+            if (error)
+                std::rethrow_exception(error);
+        }
+    };
+
+}
+
+
+#endif //DCONTAINERS_THREADPOOL_HPP
@@ -0,0 +1,287 @@
+/*
+ *   Copyright 2022 Alberto Guarnieri
+ *
+ *   Licensed under the Apache License, Version 2.0 (the "License");
+ *   you may not use this file except in compliance with the License.
+ *   You may obtain a copy of the License at
+ *
+ *       http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *   Unless required by applicable law or agreed to in writing, software
+ *   distributed under the License is distributed on an "AS IS" BASIS,
+ *   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *   See the License for the specific language governing permissions and
+ *   limitations under the License.
+ */
+
+#ifndef DCONTAINERS_TILE_HPP
+#define DCONTAINERS_TILE_HPP
+
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#if __has_include(<unistd.h>)
+#include <unistd.h>
+#endif
+
+#include "DContainers/DArray.hpp"
+#include "DContainers/DTensor.hpp"
+#include "DContainers/DVector.hpp"
+#include "DContainers/DView.hpp"
+
+
+namespace mdc {
+
+    namespace detail {
+
+        /***
+         * @brief Size in bytes of the data caches that tiles are fitted into
+         */
+        struct CacheSizes {
+            std::size_t l1;
+            std::size_t l2;
+        };
+
+        // Size of a cache line, i.e. the minimum amount of contiguous bytes worth loading
+        inline constexpr std::size_t cacheLine = 64;
+
+        /***
+         * @brief Query the size of L1 and L2 data caches from the system, if available.
+         *        Either size can be fixed at compile time defining DCONTAINERS_L1_CACHE_SIZE or
+         *        DCONTAINERS_L2_CACHE_SIZE, otherwise 32 KiB and 256 KiB are assumed when the query fails.
+         */
+        inline CacheSizes queryCacheSizes() noexcept {
+            CacheSizes sizes{32 * 1024, 256 * 1024};
+#if defined(_SC_LEVEL1_DCACHE_SIZE) && defined(_SC_LEVEL2_CACHE_SIZE)
+            if (const long l1 = ::sysconf(_SC_LEVEL1_DCACHE_SIZE); l1 > 0)
+                sizes.l1 = static_cast<std::size_t>(l1);
+            if (const long l2 = ::sysconf(_SC_LEVEL2_CACHE_SIZE); l2 > 0)
+                sizes.l2 = static_cast<std::size_t>(l2);
+#endif
+#ifdef DCONTAINERS_L1_CACHE_SIZE
+            sizes.l1 = DCONTAINERS_L1_CACHE_SIZE;
+#endif
+#ifdef DCONTAINERS_L2_CACHE_SIZE
+            sizes.l2 = DCONTAINERS_L2_CACHE_SIZE;
+#endif
+            return sizes;
+        }
+
+        inline const CacheSizes &cacheSizes() noexcept {
+            static const CacheSizes sizes = queryCacheSizes();
+            return sizes;
+        }
+
+        template<typename V>
+        struct TiledView;
+
+        template<std::size_t D, typename T>
+        struct TiledView<DView<D, T>> {
+            static constexpr std::size_t rank = D;
+        };
+
+        template<std::size_t D, typename T, typename Allocator>
+        struct TiledView<DVectorView<D, T, Allocator>> {
+            static constexpr std::size_t rank = D;
+        };
+
+        /***
+         * @brief View over all elements of a container, or the view itself
+         */
+        template<typename C>
+        auto wholeView(C &container) noexcept {
+            if constexpr (requires { container.view(); })
+                return container.view();
+            else
+                return container;
+        }
+
+        template<typename C>
+        using WholeView = decltype(wholeView(std::declval<C &>()));
+
+        /***
+         * @brief DArray, DTensor, DVector, or a view over any of them, visited by for_each_tile
+         */
+        template<typename C>
+        concept Tileable = requires { TiledView<WholeView<C>>::rank; };
+
+        template<typename C>
+        inline constexpr std::size_t tiledRank = TiledView<WholeView<C>>::rank;
+
+        // Longest sub-vector at each depth, so that tiles cover every element of a jagged DVector
+        template<std::size_t L, std::size_t D, typename V>
+        void boundsOf(const V &view, std::array<std::size_t, D> &bounds) {
+            bounds[D - L] = std::max(bounds[D - L], view.size());
+            if constexpr (L > 1)
+                for (auto subView: view)
+                    boundsOf<L - 1>(subView, bounds);
+        }
+
+        template<std::size_t D, typename T>
+        std::array<std::size_t, D> tileBounds(const DView<D, T> &view) noexcept {
+            return view.shape();
+        }
+
+        template<std::size_t D, typename T, typename Allocator>
+        std::array<std::size_t, D> tileBounds(const DVectorView<D, T, Allocator> &view) {
+            std::array<std::size_t, D> bounds{};
+            boundsOf<D>(view, bounds);
+            return bounds;
+        }
+
+        template<std::size_t D, typename T>
+        DView<D, T> tileOf(const DView<D, T> &view, const std::array<std::size_t, D> &origin,
+                           const std::array<std::size_t, D> &tiles) noexcept {
+            T *first = view.data();
+            std::array<std::size_t, D> shape{};
+            for (std::size_t d = 0; d < D; ++d) {
+                first += origin[d] * view.strides()[d];
+                shape[d] = std::min(tiles[d], view.shape()[d] - origin[d]);
+            }
+            return {first, shape, view.strides()};
+        }
+
+        template<std::size_t D, typename T, typename Allocator>
+        DVectorView<D, T, Allocator> tileOf(const DVectorView<D, T, Allocator> &view,
+                                            const std::array<std::size_t, D> &origin,
+                                            const std::array<std::size_t, D> &tiles) noexcept {
+            std::array<std::size_t, D> offsets{}, extents{};
+            for (std::size_t d = 0; d < D; ++d) {
+                offsets[d] = view.offsets()[d] + origin[d] * view.steps()[d];
+                extents[d] = std::min(tiles[d], view.extents()[d] - origin[d]);
+            }
+            return {*view.vector(), offsets, extents, view.steps()};
+        }
+
+        /***
+         * @brief Call fn with the origin of every tile, in row-major order of the tiles
+         */
+        template<std::size_t L, std::size_t D, typename Fn>
+        void forEachOrigin(const std::array<std::size_t, D> &bounds, const std::array<std::size_t, D> &tiles,
+                           std::array<std::size_t, D> &origin, Fn &fn) {
+            constexpr std::size_t level = D - L;
+            for (origin[level] = 0; origin[level] < bounds[level]; origin[level] += tiles[level]) {
+                if constexpr (L == 1)
+                    fn(std::as_const(origin));
+                else
+                    forEachOrigin<L - 1>(bounds, tiles, origin, fn);
+            }
+        }
+
+    }
+
+    /***
+     * @brief Tile sizes fitting a cache level, used by for_each_tile when none are given.
+     *        Tiles of one or two dimensions fit half of the L1 data cache, while tiles of three or more dimensions,
+     *        whose planes are reused across a tile, fit half of the L2 cache. Each size is a power of two, and the
+     *        inner-most one spans at least a whole cache line.
+     * @tparam T Type of the elements visited
+     * @tparam D Number of dimensions of the tiles
+     * @return Size of the tiles for each dimension
+     */
+    template<typename T, std::size_t D>
+    std::array<std::size_t, D> default_tiles() noexcept {
+        static_assert(D > 0, "Tiles must have at least one dimension");
+        const auto &caches = detail::cacheSizes();
+        const std::size_t budget = std::max<std::size_t>((D <= 2 ? caches.l1 : caches.l2) / 2 / sizeof(T), 1);
+        auto volume = [](std::size_t side) {
+            std::size_t count = 1;
+            for (std::size_t d = 0; d < D; ++d)
+                count *= side;
+            return count;
+        };
+        // largest power of two whose D-th power is within budget
+        std::size_t side = 1;
+        while (volume(side * 2) <= budget)
+            side *= 2;
+        std::array<std::size_t, D> tiles{};
+        tiles.fill(side);
+        const std::size_t line = std::max<std::size_t>(detail::cacheLine / sizeof(T), 1);
+        if (side < line) {
+            // shrink the outer dimensions, so that each row of a tile is a whole cache line
+            side = 1;
+            if constexpr (D > 1)
+                while (volume(side * 2) / (side * 2) * line <= budget)
+                    side *= 2;
+            tiles.fill(side);
+            tiles[D - 1] = line;
+        }
+        return tiles;
+    }
+
+    /***
+     * @brief Visit a container in blocks, so that each block is processed while its elements are still cached.
+     *        Tiles are visited in row-major order, and those at the end of each dimension are cut to the size
+     *        of the container. For a jagged DVector, tiles cover the longest sub-vector of each dimension, and
+     *        hence they may view fewer (or no) elements.
+     * @code
+     * auto grid = std::make_unique<mdc::DArray<float, 2048, 2048>>();
+     * mdc::for_each_tile<64, 64>(*grid, [](mdc::DView<2, float> tile, const std::array<std::size_t, 2> &origin) {
+     *     for (std::size_t i = 0; i < tile.shape()[0]; ++i)
+     *         for (std::size_t j = 0; j < tile.shape()[1]; ++j)
+     *             tile(i, j) *= 2.0f;
+     * });
+     * @endcode
+     * @tparam Tiles Size of the tiles for each dimension, or none to use default_tiles()
+     * @param container DArray, DTensor, DVector, or a view over any of them
+     * @param fn Function called with a view over each tile (i.e. DView, or DVectorView for a DVector),
+     *           and optionally the position of its first element
+     * @see default_tiles()
+     */
+    template<std::size_t... Tiles, detail::Tileable C, typename Fn>
+    void for_each_tile(C &&container, Fn &&fn) {
+        constexpr std::size_t D = detail::tiledRank<C>;
+        static_assert(sizeof...(Tiles) == 0 || sizeof...(Tiles) == D,
+                      "A tile size must be given for each dimension of the container");
+        static_assert(((Tiles > 0) && ...), "Tile sizes must be positive");
+        using View = detail::WholeView<C>;
+        if constexpr (sizeof...(Tiles) == 0)
+            for_each_tile(container, default_tiles<typename View::value_type, D>(), fn);
+        else
+            for_each_tile(container, std::array<std::size_t, D>{Tiles...}, fn);
+    }
+
+    /***
+     * @brief Visit a container in blocks, with tile sizes chosen at runtime
+     * @param container DArray, DTensor, DVector, or a view over any of them
+     * @param tiles Size of the tiles for each dimension
+     * @param fn Function called with a view over each tile, and optionally the position of its first element
+     * @throws std::invalid_argument If any tile size is zero
+     * @see for_each_tile<Tiles...>(C &&container, Fn &&fn)
+     */
+    template<detail::Tileable C, typename Fn>
+    void for_each_tile(C &&container, const std::array<std::size_t, detail::tiledRank<C>> &tiles, Fn &&fn) {
+        constexpr std::size_t D = detail::tiledRank<C>;
+        using View = detail::WholeView<C>;
+        const View whole = detail::wholeView(container);
+        if constexpr (requires { whole.vector(); })
+            if (whole.vector() == nullptr)
+                return;
+        const auto bounds = detail::tileBounds(whole);
+        std::array<std::size_t, D> clamped{};
+        for (std::size_t d = 0; d < D; ++d) {
+            if (tiles[d] == 0)
+                throw std::invalid_argument("for_each_tile: tile sizes must be positive");
+            // tiles larger than the container would overflow the origin of the next tile
+            clamped[d] = std::min(tiles[d], std::max<std::size_t>(bounds[d], 1));
+        }
+        auto visit = [&](const std::array<std::size_t, D> &origin) {
+            auto tile = detail::tileOf(whole, origin, clamped);
+            if constexpr (std::is_invocable_v<Fn &, decltype(tile) &, const std::array<std::size_t, D> &>)
+                fn(tile, origin);
+            else
+                fn(tile);
+        };
+        std::array<std::size_t, D> origin{};
+        detail::forEachOrigin<D>(bounds, clamped, origin, visit);
+    }
+
+}
+
+
+#endif //DCONTAINERS_TILE_HPP
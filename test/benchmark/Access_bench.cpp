@@ -0,0 +1,172 @@
+/*
+ *   Copyright 2022 Alberto Guarnieri
+ *
+ *   Licensed under the Apache License, Version 2.0 (the "License");
+ *   you may not use this file except in compliance with the License.
+ *   You may obtain a copy of the License at
+ *
+ *       http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *   Unless required by applicable law or agreed to in writing, software
+ *   distributed under the License is distributed on an "AS IS" BASIS,
+ *   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *   See the License for the specific language governing permissions and
+ *   limitations under the License.
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <array>
+#include <cstdint>
+#include <memory>
+#include <vector>
+#include "DContainers/DArray.hpp"
+#include "DContainers/DTensor.hpp"
+#include "DContainers/DVector.hpp"
+
+#if __has_include(<mdspan>)
+#include <mdspan>
+#endif
+
+using mdc::DArray, mdc::DTensor, mdc::DVector;
+
+namespace {
+    constexpr std::size_t Size = 128;
+
+    constexpr std::size_t Cube = 32;
+
+    template<typename Container, typename Access>
+    void sumAll(benchmark::State &state, Container &container, Access access) {
+        for (auto _: state) {
+            std::int64_t sum = 0;
+            for (std::size_t i = 0; i < Size; ++i)
+                for (std::size_t j = 0; j < Size; ++j)
+                    sum += access(container, i, j);
+            benchmark::DoNotOptimize(sum);
+        }
+        state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * Size * Size));
+    }
+
+    template<typename Container, typename Access>
+    void sumCube(benchmark::State &state, Container &container, Access access) {
+        for (auto _: state) {
+            std::int64_t sum = 0;
+            for (std::size_t i = 0; i < Cube; ++i)
+                for (std::size_t j = 0; j < Cube; ++j)
+                    for (std::size_t k = 0; k < Cube; ++k)
+                        sum += access(container, i, j, k);
+            benchmark::DoNotOptimize(sum);
+        }
+        state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * Cube * Cube * Cube));
+    }
+}
+
+// Element-wise reads through the checked at() and the unchecked operator() of each container
+
+static void BM_DArrayAt(benchmark::State &state) {
+    auto dArray = std::make_unique<DArray<int, Size, Size>>();
+    sumAll(state, *dArray, [](const auto &c, std::size_t i, std::size_t j) { return c.at(i, j); });
+}
+BENCHMARK(BM_DArrayAt);
+
+static void BM_DArrayUnchecked(benchmark::State &state) {
+    auto dArray = std::make_unique<DArray<int, Size, Size>>();
+    sumAll(state, *dArray, [](const auto &c, std::size_t i, std::size_t j) { return c(i, j); });
+}
+BENCHMARK(BM_DArrayUnchecked);
+
+static void BM_DVectorAt(benchmark::State &state) {
+    DVector<2, int> dVector(Size, Size);
+    sumAll(state, dVector, [](const auto &c, std::size_t i, std::size_t j) { return c.at(i, j); });
+}
+BENCHMARK(BM_DVectorAt);
+
+static void BM_DVectorUnchecked(benchmark::State &state) {
+    DVector<2, int> dVector(Size, Size);
+    sumAll(state, dVector, [](const auto &c, std::size_t i, std::size_t j) { return c(i, j); });
+}
+BENCHMARK(BM_DVectorUnchecked);
+
+static void BM_DTensorAt(benchmark::State &state) {
+    DTensor<2, int> dTensor(Size, Size);
+    sumAll(state, dTensor, [](const auto &c, std::size_t i, std::size_t j) { return c.at(i, j); });
+}
+BENCHMARK(BM_DTensorAt);
+
+static void BM_DTensorUnchecked(benchmark::State &state) {
+    DTensor<2, int> dTensor(Size, Size);
+    sumAll(state, dTensor, [](const auto &c, std::size_t i, std::size_t j) { return c(i, j); });
+}
+BENCHMARK(BM_DTensorUnchecked);
+
+// Baselines: the same reads on standard containers, and on a flat buffer indexed by hand
+
+static void BM_StdArrayAt(benchmark::State &state) {
+    auto array = std::make_unique<std::array<std::array<int, Size>, Size>>();
+    sumAll(state, *array, [](const auto &c, std::size_t i, std::size_t j) { return c.at(i).at(j); });
+}
+BENCHMARK(BM_StdArrayAt);
+
+static void BM_StdArrayIndex(benchmark::State &state) {
+    auto array = std::make_unique<std::array<std::array<int, Size>, Size>>();
+    sumAll(state, *array, [](const auto &c, std::size_t i, std::size_t j) { return c[i][j]; });
+}
+BENCHMARK(BM_StdArrayIndex);
+
+static void BM_StdVectorAt(benchmark::State &state) {
+    std::vector<std::vector<int>> vector(Size, std::vector<int>(Size));
+    sumAll(state, vector, [](const auto &c, std::size_t i, std::size_t j) { return c.at(i).at(j); });
+}
+BENCHMARK(BM_StdVectorAt);
+
+static void BM_FlatVectorIndex(benchmark::State &state) {
+    std::vector<int> vector(Size * Size);
+    sumAll(state, vector, [](const auto &c, std::size_t i, std::size_t j) { return c[i * Size + j]; });
+}
+BENCHMARK(BM_FlatVectorIndex);
+
+#if defined(__cpp_lib_mdspan)
+static void BM_MdspanIndex(benchmark::State &state) {
+    std::vector<int> vector(Size * Size);
+    std::mdspan<const int, std::extents<std::size_t, Size, Size>> span(vector.data());
+    sumAll(state, span, [](const auto &c, std::size_t i, std::size_t j) { return c[i, j]; });
+}
+BENCHMARK(BM_MdspanIndex);
+#endif
+
+// Multi-index at() of three dimensions
+
+static void BM_DArrayAt3D(benchmark::State &state) {
+    auto dArray = std::make_unique<DArray<int, Cube, Cube, Cube>>();
+    sumCube(state, *dArray, [](const auto &c, std::size_t i, std::size_t j, std::size_t k) { return c.at(i, j, k); });
+}
+BENCHMARK(BM_DArrayAt3D);
+
+static void BM_DVectorAt3D(benchmark::State &state) {
+    DVector<3, int> dVector(Cube, Cube, Cube);
+    sumCube(state, dVector, [](const auto &c, std::size_t i, std::size_t j, std::size_t k) { return c.at(i, j, k); });
+}
+BENCHMARK(BM_DVectorAt3D);
+
+static void BM_DTensorAt3D(benchmark::State &state) {
+    DTensor<3, int> dTensor(Cube, Cube, Cube);
+    sumCube(state, dTensor, [](const auto &c, std::size_t i, std::size_t j, std::size_t k) { return c.at(i, j, k); });
+}
+BENCHMARK(BM_DTensorAt3D);
+
+static void BM_StdArrayAt3D(benchmark::State &state) {
+    auto array = std::make_unique<std::array<std::array<std::array<int, Cube>, Cube>, Cube>>();
+    sumCube(state, *array, [](const auto &c, std::size_t i, std::size_t j, std::size_t k) {
+        return c.at(i).at(j).at(k);
+    });
+}
+BENCHMARK(BM_StdArrayAt3D);
+
+static void BM_StdVectorAt3D(benchmark::State &state) {
+    std::vector<std::vector<std::vector<int>>> vector(Cube,
+                                                      std::vector<std::vector<int>>(Cube, std::vector<int>(Cube)));
+    sumCube(state, vector, [](const auto &c, std::size_t i, std::size_t j, std::size_t k) {
+        return c.at(i).at(j).at(k);
+    });
+}
+BENCHMARK(BM_StdVectorAt3D);
@@ -0,0 +1,51 @@
+/*
+ *   Copyright 2022 Alberto Guarnieri
+ *
+ *   Licensed under the Apache License, Version 2.0 (the "License");
+ *   you may not use this file except in compliance with the License.
+ *   You may obtain a copy of the License at
+ *
+ *       http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *   Unless required by applicable law or agreed to in writing, software
+ *   distributed under the License is distributed on an "AS IS" BASIS,
+ *   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *   See the License for the specific language governing permissions and
+ *   limitations under the License.
+ */
+
+#ifndef DCONTAINERS_ALLOCATIONCOUNTER_HPP
+#define DCONTAINERS_ALLOCATIONCOUNTER_HPP
+
+#include <cstddef>
+
+#include <benchmark/benchmark.h>
+
+namespace bench {
+
+    /***
+     * @return Number of calls to global operator new since the start of the program
+     */
+    std::size_t allocations() noexcept;
+
+    /***
+     * @brief Count heap allocations performed while running a benchmark,
+     *        reporting them as an average per iteration through the "allocs/iter" counter
+     */
+    class AllocationScope {
+    private:
+        benchmark::State &_state;
+        std::size_t _start;
+
+    public:
+        explicit AllocationScope(benchmark::State &state) : _state(state), _start(allocations()) {}
+
+        ~AllocationScope() {
+            _state.counters["allocs/iter"] = benchmark::Counter(static_cast<double>(allocations() - _start),
+                                                                benchmark::Counter::kAvgIterations);
+        }
+    };
+
+}
+
+#endif //DCONTAINERS_ALLOCATIONCOUNTER_HPP
@@ -0,0 +1,146 @@
+/*
+ *   Copyright 2022 Alberto Guarnieri
+ *
+ *   Licensed under the Apache License, Version 2.0 (the "License");
+ *   you may not use this file except in compliance with the License.
+ *   You may obtain a copy of the License at
+ *
+ *       http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *   Unless required by applicable law or agreed to in writing, software
+ *   distributed under the License is distributed on an "AS IS" BASIS,
+ *   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *   See the License for the specific language governing permissions and
+ *   limitations under the License.
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "AllocationCounter.hpp"
+#include "DContainers/Arena.hpp"
+#include "DContainers/DVector.hpp"
+#include "DContainers/Span.hpp"
+
+using mdc::DVector, mdc::Span;
+
+// Span extraction of the first 3 rows of a cubic DVector<3,int>,
+// expected allocations per call: 1 (rows) + 3 (sub-vectors) + 3*N (leaves)
+static void BM_DVectorSpanRows(benchmark::State &state) {
+    const auto n = static_cast<std::size_t>(state.range(0));
+    DVector<3, int> dVector(n, n, n);
+    bench::AllocationScope scope(state);
+    for (auto _: state) {
+        auto spanned = dVector.at(Span::of(0, 2), Span::all(), Span::all());
+        benchmark::DoNotOptimize(spanned.data());
+    }
+}
+BENCHMARK(BM_DVectorSpanRows)->Arg(8)->Arg(64);
+
+// Span extraction of a single element for each dimension, expected allocations per call: 3
+static void BM_DVectorSpanElement(benchmark::State &state) {
+    const auto n = static_cast<std::size_t>(state.range(0));
+    DVector<3, int> dVector(n, n, n);
+    bench::AllocationScope scope(state);
+    for (auto _: state) {
+        auto spanned = dVector.at(Span::of(1), Span::of(1), Span::of(1));
+        benchmark::DoNotOptimize(spanned.data());
+    }
+}
+BENCHMARK(BM_DVectorSpanElement)->Arg(8)->Arg(64);
+
+// Build and drop a cubic DVector<3,float> with the default allocator,
+// expected allocations per call: 1 + N + N*N, plus N + 2 for the sub-vectors copied into each row
+static void BM_DVectorBuildDefault(benchmark::State &state) {
+    const auto n = static_cast<std::size_t>(state.range(0));
+    bench::AllocationScope scope(state);
+    for (auto _: state) {
+        DVector<3, float> scratch(n, n, n);
+        benchmark::DoNotOptimize(scratch.data());
+    }
+}
+BENCHMARK(BM_DVectorBuildDefault)->Arg(8)->Arg(64);
+
+// Same as BM_DVectorBuildDefault, with all sub-vectors obtained from an Arena reset after each call,
+// expected allocations per call: 0
+static void BM_DVectorBuildArena(benchmark::State &state) {
+    const auto n = static_cast<std::size_t>(state.range(0));
+    mdc::pmr::Arena arena;
+    bench::AllocationScope scope(state);
+    for (auto _: state) {
+        {
+            mdc::pmr::DVector<3, float> scratch(std::allocator_arg, &arena, n, n, n);
+            benchmark::DoNotOptimize(scratch.data());
+        }
+        arena.reset();
+    }
+}
+BENCHMARK(BM_DVectorBuildArena)->Arg(8)->Arg(64);
+
+// Rectangular construction of a cubic DVector<3,double>, allocating each sub-vector once and zeroing the elements
+static void BM_DVectorConstructSizes(benchmark::State &state) {
+    const auto n = static_cast<std::size_t>(state.range(0));
+    for (auto _: state) {
+        DVector<3, double> dVector(n, n, n);
+        benchmark::DoNotOptimize(dVector.data());
+    }
+    state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations() * n * n * n * sizeof(double)));
+}
+BENCHMARK(BM_DVectorConstructSizes)->Arg(128);
+
+// Same as BM_DVectorConstructSizes, leaving elements uninitialized
+static void BM_DVectorConstructForOverwrite(benchmark::State &state) {
+    const auto n = static_cast<std::size_t>(state.range(0));
+    for (auto _: state) {
+        DVector<3, double, mdc::DefaultInitAllocator<double>> dVector(mdc::for_overwrite, {n, n, n});
+        benchmark::DoNotOptimize(dVector.data());
+    }
+    state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations() * n * n * n * sizeof(double)));
+}
+BENCHMARK(BM_DVectorConstructForOverwrite)->Arg(128);
+
+// Rectangular construction of a cubic DVector<3,double> from a generator of its elements
+static void BM_DVectorConstructGenerator(benchmark::State &state) {
+    const auto n = static_cast<std::size_t>(state.range(0));
+    for (auto _: state) {
+        DVector<3, double> dVector({n, n, n}, [](std::size_t i, std::size_t j, std::size_t k) {
+            return static_cast<double>(i + j + k);
+        });
+        benchmark::DoNotOptimize(dVector.data());
+    }
+    state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations() * n * n * n * sizeof(double)));
+}
+BENCHMARK(BM_DVectorConstructGenerator)->Arg(128);
+
+// Construction of a cubic DVector<3,double> from nested std::vectors, as a baseline
+static void BM_StdVectorConstructSizes(benchmark::State &state) {
+    const auto n = static_cast<std::size_t>(state.range(0));
+    for (auto _: state) {
+        std::vector<std::vector<std::vector<double>>> vector(n, std::vector<std::vector<double>>(
+                n, std::vector<double>(n)));
+        benchmark::DoNotOptimize(vector.data());
+    }
+    state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations() * n * n * n * sizeof(double)));
+}
+BENCHMARK(BM_StdVectorConstructSizes)->Arg(128);
+
+// Construction of a DVector<2,int> from a nested initializer_list
+static void BM_DVectorConstructList(benchmark::State &state) {
+    for (auto _: state) {
+        DVector<2, int> dVector{{1, 2, 3, 4}, {5, 6}, {7, 8, 9}, {10}};
+        benchmark::DoNotOptimize(dVector.data());
+    }
+}
+BENCHMARK(BM_DVectorConstructList);
+
+// Count of all elements of a cubic DVector<3,int>
+static void BM_DVectorTotal(benchmark::State &state) {
+    const auto n = static_cast<std::size_t>(state.range(0));
+    DVector<3, int> dVector(n, n, n);
+    for (auto _: state)
+        benchmark::DoNotOptimize(dVector.total());
+}
+BENCHMARK(BM_DVectorTotal)->Arg(8)->Arg(64);
@@ -0,0 +1,79 @@
+/*
+ *   Copyright 2022 Alberto Guarnieri
+ *
+ *   Licensed under the Apache License, Version 2.0 (the "License");
+ *   you may not use this file except in compliance with the License.
+ *   You may obtain a copy of the License at
+ *
+ *       http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *   Unless required by applicable law or agreed to in writing, software
+ *   distributed under the License is distributed on an "AS IS" BASIS,
+ *   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *   See the License for the specific language governing permissions and
+ *   limitations under the License.
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <sstream>
+
+#include "DContainers/DVector.hpp"
+
+using mdc::DVector;
+
+namespace {
+    constexpr std::size_t Size = 1000;
+
+    DVector<2, double> matrix() {
+        return {{Size, Size}, [](std::size_t i, std::size_t j) { return i * 0.37 + j / 7.0; }};
+    }
+}
+
+// Same layout of operator<<, writing each element through the stream, as a baseline
+static void BM_PrintElementwise(benchmark::State &state) {
+    const auto dVector = matrix();
+    for (auto _: state) {
+        std::ostringstream os;
+        for (std::size_t i = 0; i < Size; ++i) {
+            os << '|';
+            for (std::size_t j = 0; j < Size; ++j) {
+                os << dVector[i][j];
+                if (j < Size - 1)
+                    os << ", ";
+            }
+            os << (i < Size - 1 ? "|\n" : "|");
+        }
+        benchmark::DoNotOptimize(os.str().size());
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * Size * Size));
+}
+BENCHMARK(BM_PrintElementwise);
+
+// operator<<, going through mdc::Formatter
+static void BM_PrintFormatter(benchmark::State &state) {
+    const auto dVector = matrix();
+    for (auto _: state) {
+        std::ostringstream os;
+        os << dVector;
+        benchmark::DoNotOptimize(os.str().size());
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * Size * Size));
+}
+BENCHMARK(BM_PrintFormatter);
+
+// Shortest round-trip representation, as CSV
+static void BM_PrintCsv(benchmark::State &state) {
+    const auto dVector = matrix();
+    for (auto _: state) {
+        std::ostringstream os;
+        {
+            mdc::Formatter formatter(os, mdc::Format::csv());
+            formatter << dVector;
+        }
+        benchmark::DoNotOptimize(os.str().size());
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * Size * Size));
+}
+BENCHMARK(BM_PrintCsv);
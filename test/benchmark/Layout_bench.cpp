@@ -0,0 +1,66 @@
+/*
+ *   Copyright 2022 Alberto Guarnieri
+ *
+ *   Licensed under the Apache License, Version 2.0 (the "License");
+ *   you may not use this file except in compliance with the License.
+ *   You may obtain a copy of the License at
+ *
+ *       http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *   Unless required by applicable law or agreed to in writing, software
+ *   distributed under the License is distributed on an "AS IS" BASIS,
+ *   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *   See the License for the specific language governing permissions and
+ *   limitations under the License.
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <memory>
+#include "DContainers/Layout.hpp"
+
+using mdc::DGrid, mdc::Layout;
+
+namespace {
+    constexpr std::size_t Side = 2048;
+    constexpr std::size_t Cube = 128;
+}
+
+// Column-by-column traversal of a matrix, striding through row-major storage
+
+template<typename L>
+static void BM_ColumnSum(benchmark::State &state) {
+    auto grid = std::make_unique<DGrid<float, L, Side, Side>>(1.0f);
+    for (auto _: state) {
+        float sum = 0;
+        for (std::size_t j = 0; j < Side; ++j)
+            for (std::size_t i = 0; i < Side; ++i)
+                sum += (*grid)(i, j);
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * Side * Side));
+}
+BENCHMARK(BM_ColumnSum<Layout::RowMajor>);
+BENCHMARK(BM_ColumnSum<Layout::ColumnMajor>);
+BENCHMARK(BM_ColumnSum<Layout::Tiled<16>>);
+
+// 7-point neighbourhood of each interior element of a cube, touching three planes at once
+
+template<typename L>
+static void BM_Stencil3D(benchmark::State &state) {
+    auto grid = std::make_unique<DGrid<float, L, Cube, Cube, Cube>>(1.0f);
+    for (auto _: state) {
+        float sum = 0;
+        for (std::size_t i = 1; i < Cube - 1; ++i)
+            for (std::size_t j = 1; j < Cube - 1; ++j)
+                for (std::size_t k = 1; k < Cube - 1; ++k)
+                    sum += (*grid)(i, j, k) + (*grid)(i - 1, j, k) + (*grid)(i + 1, j, k) + (*grid)(i, j - 1, k) +
+                           (*grid)(i, j + 1, k) + (*grid)(i, j, k - 1) + (*grid)(i, j, k + 1);
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * (Cube - 2) * (Cube - 2) * (Cube - 2)));
+}
+BENCHMARK(BM_Stencil3D<Layout::RowMajor>);
+BENCHMARK(BM_Stencil3D<Layout::Tiled<8>>);
+BENCHMARK(BM_Stencil3D<Layout::Morton>);
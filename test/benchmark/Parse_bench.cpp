@@ -0,0 +1,75 @@
+/*
+ *   Copyright 2022 Alberto Guarnieri
+ *
+ *   Licensed under the Apache License, Version 2.0 (the "License");
+ *   you may not use this file except in compliance with the License.
+ *   You may obtain a copy of the License at
+ *
+ *       http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *   Unless required by applicable law or agreed to in writing, software
+ *   distributed under the License is distributed on an "AS IS" BASIS,
+ *   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *   See the License for the specific language governing permissions and
+ *   limitations under the License.
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <sstream>
+#include <string>
+
+#include "DContainers/Parse.hpp"
+
+using mdc::DVector;
+
+namespace {
+    constexpr std::size_t Rows = 20000, Columns = 50;
+
+    const std::string &csvText() {
+        static const std::string text = mdc::format(
+                DVector<2, double>({Rows, Columns}, [](std::size_t i, std::size_t j) { return i * 0.37 + j / 7.0; }),
+                mdc::Format::csv());
+        return text;
+    }
+}
+
+// Line by line, through std::getline and std::stod on each field, as a baseline
+static void BM_ParseGetline(benchmark::State &state) {
+    for (auto _: state) {
+        std::istringstream is(csvText());
+        DVector<2, double> rows;
+        std::string line, field;
+        while (std::getline(is, line)) {
+            auto &row = rows.emplace_back();
+            std::istringstream fields(line);
+            while (std::getline(fields, field, ','))
+                row.push_back(std::stod(field));
+        }
+        benchmark::DoNotOptimize(rows.data());
+    }
+    state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations() * csvText().size()));
+}
+BENCHMARK(BM_ParseGetline)->Unit(benchmark::kMillisecond);
+
+// Chunked reads from a stream, through std::from_chars
+static void BM_ParseStream(benchmark::State &state) {
+    for (auto _: state) {
+        std::istringstream is(csvText());
+        auto rows = mdc::io::parse<double>(is);
+        benchmark::DoNotOptimize(rows.data());
+    }
+    state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations() * csvText().size()));
+}
+BENCHMARK(BM_ParseStream)->Unit(benchmark::kMillisecond);
+
+// Text in memory, split into chunks parsed by the default thread pool
+static void BM_ParseParallel(benchmark::State &state) {
+    for (auto _: state) {
+        auto rows = mdc::parallel::parse<double>(csvText());
+        benchmark::DoNotOptimize(rows.data());
+    }
+    state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations() * csvText().size()));
+}
+BENCHMARK(BM_ParseParallel)->Unit(benchmark::kMillisecond);
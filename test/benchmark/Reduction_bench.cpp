@@ -0,0 +1,79 @@
+/*
+ *   Copyright 2022 Alberto Guarnieri
+ *
+ *   Licensed under the Apache License, Version 2.0 (the "License");
+ *   you may not use this file except in compliance with the License.
+ *   You may obtain a copy of the License at
+ *
+ *       http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *   Unless required by applicable law or agreed to in writing, software
+ *   distributed under the License is distributed on an "AS IS" BASIS,
+ *   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *   See the License for the specific language governing permissions and
+ *   limitations under the License.
+ */
+
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <memory>
+#include <numeric>
+#include "DContainers/Reduction.hpp"
+
+using mdc::DArray, mdc::DVector;
+
+namespace {
+    constexpr std::size_t Rows = 512, Columns = 512;
+
+    template<typename Reduce>
+    void reduceArray(benchmark::State &state, Reduce reduce) {
+        auto dArray = std::make_unique<DArray<double, Rows, Columns>>();
+        std::iota(dArray->flat_begin(), dArray->flat_end(), 0.0);
+        for (auto _: state)
+            benchmark::DoNotOptimize(reduce(*dArray));
+        state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations() * sizeof(*dArray)));
+    }
+}
+
+// Naive loops over the flat elements of a DArray, compared with the dispatched reduction kernels
+
+static void BM_DArraySumAccumulate(benchmark::State &state) {
+    reduceArray(state, [](const auto &a) { return std::accumulate(a.flat_begin(), a.flat_end(), 0.0); });
+}
+BENCHMARK(BM_DArraySumAccumulate);
+
+static void BM_DArraySum(benchmark::State &state) {
+    reduceArray(state, [](const auto &a) { return mdc::sum(a); });
+}
+BENCHMARK(BM_DArraySum);
+
+static void BM_DArrayMaxElement(benchmark::State &state) {
+    reduceArray(state, [](const auto &a) { return *std::max_element(a.flat_begin(), a.flat_end()); });
+}
+BENCHMARK(BM_DArrayMaxElement);
+
+static void BM_DArrayMax(benchmark::State &state) {
+    reduceArray(state, [](const auto &a) { return mdc::max(a); });
+}
+BENCHMARK(BM_DArrayMax);
+
+static void BM_DArrayArgmax(benchmark::State &state) {
+    reduceArray(state, [](const auto &a) { return mdc::argmax(a); });
+}
+BENCHMARK(BM_DArrayArgmax);
+
+static void BM_DArrayDot(benchmark::State &state) {
+    reduceArray(state, [](const auto &a) { return mdc::dot(a, a); });
+}
+BENCHMARK(BM_DArrayDot);
+
+static void BM_DVectorSum(benchmark::State &state) {
+    DVector<2, double> dVector(Rows, Columns);
+    for (auto _: state)
+        benchmark::DoNotOptimize(mdc::sum(dVector));
+    state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations() * Rows * Columns * sizeof(double)));
+}
+BENCHMARK(BM_DVectorSum);
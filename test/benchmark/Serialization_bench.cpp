@@ -0,0 +1,73 @@
+/*
+ *   Copyright 2022 Alberto Guarnieri
+ *
+ *   Licensed under the Apache License, Version 2.0 (the "License");
+ *   you may not use this file except in compliance with the License.
+ *   You may obtain a copy of the License at
+ *
+ *       http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *   Unless required by applicable law or agreed to in writing, software
+ *   distributed under the License is distributed on an "AS IS" BASIS,
+ *   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *   See the License for the specific language governing permissions and
+ *   limitations under the License.
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <sstream>
+
+#include "DContainers/Serialization.hpp"
+
+using mdc::DVector;
+
+namespace {
+
+    DVector<3, double> cube(std::size_t n) {
+        return {{n, n, n}, [](std::size_t i, std::size_t j, std::size_t k) { return i * 0.5 + j * 0.25 + k; }};
+    }
+
+}
+
+// Text snapshot of a cubic DVector<3,double> through operator<<, as baseline
+static void BM_SnapshotText(benchmark::State &state) {
+    const auto n = static_cast<std::size_t>(state.range(0));
+    const auto dVector = cube(n);
+    for (auto _: state) {
+        std::ostringstream os;
+        os << dVector;
+        benchmark::DoNotOptimize(os.str().size());
+    }
+    state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations() * n * n * n * sizeof(double)));
+}
+BENCHMARK(BM_SnapshotText)->Arg(64);
+
+// Binary snapshot of the same DVector through mdc::io::write
+static void BM_SnapshotBinary(benchmark::State &state) {
+    const auto n = static_cast<std::size_t>(state.range(0));
+    const auto dVector = cube(n);
+    for (auto _: state) {
+        std::ostringstream os(std::ios::binary);
+        mdc::io::write(os, dVector);
+        benchmark::DoNotOptimize(os.str().size());
+    }
+    state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations() * n * n * n * sizeof(double)));
+}
+BENCHMARK(BM_SnapshotBinary)->Arg(64);
+
+// Restore the binary snapshot of the same DVector through mdc::io::read
+static void BM_RestoreBinary(benchmark::State &state) {
+    const auto n = static_cast<std::size_t>(state.range(0));
+    std::ostringstream os(std::ios::binary);
+    mdc::io::write(os, cube(n));
+    const auto bytes = os.str();
+    for (auto _: state) {
+        std::istringstream is(bytes, std::ios::binary);
+        auto dVector = mdc::io::read<DVector<3, double>>(is);
+        benchmark::DoNotOptimize(dVector.data());
+    }
+    state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations() * n * n * n * sizeof(double)));
+}
+BENCHMARK(BM_RestoreBinary)->Arg(64);
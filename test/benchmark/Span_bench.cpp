@@ -0,0 +1,131 @@
+/*
+ *   Copyright 2022 Alberto Guarnieri
+ *
+ *   Licensed under the Apache License, Version 2.0 (the "License");
+ *   you may not use this file except in compliance with the License.
+ *   You may obtain a copy of the License at
+ *
+ *       http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *   Unless required by applicable law or agreed to in writing, software
+ *   distributed under the License is distributed on an "AS IS" BASIS,
+ *   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *   See the License for the specific language governing permissions and
+ *   limitations under the License.
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <array>
+#include <memory>
+#include <vector>
+#include "DContainers/DArray.hpp"
+#include "DContainers/DVector.hpp"
+#include "DContainers/Span.hpp"
+
+using mdc::DArray, mdc::DVector, mdc::Span;
+
+namespace {
+    constexpr std::size_t Size = 64;
+
+    template<typename Spanned>
+    void spanArray(benchmark::State &state, Spanned spanned) {
+        auto dArray = std::make_unique<DArray<int, Size, Size>>();
+        for (auto _: state) {
+            auto result = spanned(*dArray);
+            benchmark::DoNotOptimize(result);
+        }
+    }
+
+    template<typename Spanned>
+    void spanVector(benchmark::State &state, Spanned spanned) {
+        DVector<2, int> dVector(Size, Size);
+        for (auto _: state) {
+            auto result = spanned(dVector);
+            benchmark::DoNotOptimize(result.data());
+        }
+    }
+}
+
+// Each compile-time DSpanning overload of DArray, copying the rows spanned
+
+static void BM_DArraySpanAll(benchmark::State &state) {
+    spanArray(state, [](const auto &a) { return a.at(Span::all(), Span::all()); });
+}
+BENCHMARK(BM_DArraySpanAll);
+
+static void BM_DArraySpanIndex(benchmark::State &state) {
+    spanArray(state, [](const auto &a) { return a.at(Span::of<3>(), Span::all()); });
+}
+BENCHMARK(BM_DArraySpanIndex);
+
+static void BM_DArraySpanInterval(benchmark::State &state) {
+    spanArray(state, [](const auto &a) { return a.at(Span::of<8, 23>(), Span::all()); });
+}
+BENCHMARK(BM_DArraySpanInterval);
+
+static void BM_DArraySpanStep(benchmark::State &state) {
+    spanArray(state, [](const auto &a) { return a.at(Span::of<0, 63, 4>(), Span::all()); });
+}
+BENCHMARK(BM_DArraySpanStep);
+
+static void BM_DArraySpanSize(benchmark::State &state) {
+    spanArray(state, [](const auto &a) { return a.at(Span::of<16>(8, 23), Span::all()); });
+}
+BENCHMARK(BM_DArraySpanSize);
+
+// Runtime Span over DArray, as a view without copies
+static void BM_DArrayViewSpan(benchmark::State &state) {
+    spanArray(state, [](const auto &a) { return a.view(Span::of(8, 23), Span::all()); });
+}
+BENCHMARK(BM_DArrayViewSpan);
+
+// Runtime Span through at(), returning the same view
+static void BM_DArrayAtRuntimeSpan(benchmark::State &state) {
+    spanArray(state, [](const auto &a) { return a.at(Span::of(8, 23), Span::all()); });
+}
+BENCHMARK(BM_DArrayAtRuntimeSpan);
+
+// Baseline: the same 16 rows copied from a std::array by hand
+static void BM_StdArrayCopyRows(benchmark::State &state) {
+    auto array = std::make_unique<std::array<std::array<int, Size>, Size>>();
+    for (auto _: state) {
+        std::array<std::array<int, Size>, 16> result;
+        std::copy(array->begin() + 8, array->begin() + 24, result.begin());
+        benchmark::DoNotOptimize(result);
+    }
+}
+BENCHMARK(BM_StdArrayCopyRows);
+
+// Each runtime Spanning overload of DVector, copying the rows spanned
+
+static void BM_DVectorSpanAll(benchmark::State &state) {
+    spanVector(state, [](const auto &v) { return v.at(Span::all(), Span::all()); });
+}
+BENCHMARK(BM_DVectorSpanAll);
+
+static void BM_DVectorSpanIndex(benchmark::State &state) {
+    spanVector(state, [](const auto &v) { return v.at(Span::of(3), Span::all()); });
+}
+BENCHMARK(BM_DVectorSpanIndex);
+
+static void BM_DVectorSpanInterval(benchmark::State &state) {
+    spanVector(state, [](const auto &v) { return v.at(Span::of(8, 23), Span::all()); });
+}
+BENCHMARK(BM_DVectorSpanInterval);
+
+static void BM_DVectorSpanStep(benchmark::State &state) {
+    spanVector(state, [](const auto &v) { return v.at(Span::of(0, 63, 4), Span::all()); });
+}
+BENCHMARK(BM_DVectorSpanStep);
+
+// Baseline: the same 16 rows copied from nested std::vectors by hand
+static void BM_StdVectorCopyRows(benchmark::State &state) {
+    std::vector<std::vector<int>> vector(Size, std::vector<int>(Size));
+    for (auto _: state) {
+        std::vector<std::vector<int>> result(vector.begin() + 8, vector.begin() + 24);
+        benchmark::DoNotOptimize(result.data());
+    }
+}
+BENCHMARK(BM_StdVectorCopyRows);
@@ -0,0 +1,119 @@
+/*
+ *   Copyright 2022 Alberto Guarnieri
+ *
+ *   Licensed under the Apache License, Version 2.0 (the "License");
+ *   you may not use this file except in compliance with the License.
+ *   You may obtain a copy of the License at
+ *
+ *       http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *   Unless required by applicable law or agreed to in writing, software
+ *   distributed under the License is distributed on an "AS IS" BASIS,
+ *   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *   See the License for the specific language governing permissions and
+ *   limitations under the License.
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <memory>
+#include <numeric>
+#include "DContainers/Stencil.hpp"
+
+using mdc::DArray, mdc::DVector, mdc::Neighbourhood, mdc::Boundary;
+
+namespace {
+    constexpr std::size_t Side = 2048;
+    constexpr std::size_t Cube = 128;
+
+    // Clamp an index inside [0, extent), as done by hand around every neighbour access
+    std::size_t clamped(std::ptrdiff_t index, std::size_t extent) {
+        return static_cast<std::size_t>(std::clamp<std::ptrdiff_t>(index, 0, static_cast<std::ptrdiff_t>(extent) - 1));
+    }
+}
+
+// Jacobi iteration of a 5-point Laplacian, clamping each neighbour and reading it through at()
+
+static void BM_JacobiAt(benchmark::State &state) {
+    auto input = std::make_unique<DArray<float, Side, Side>>();
+    auto output = std::make_unique<DArray<float, Side, Side>>();
+    std::iota(input->flat_begin(), input->flat_end(), 0.0f);
+    for (auto _: state) {
+        for (std::size_t i = 0; i < Side; ++i)
+            for (std::size_t j = 0; j < Side; ++j) {
+                const auto x = static_cast<std::ptrdiff_t>(i), y = static_cast<std::ptrdiff_t>(j);
+                output->at(i, j) = 0.25f * (input->at(clamped(x - 1, Side), j) + input->at(clamped(x + 1, Side), j) +
+                                            input->at(i, clamped(y - 1, Side)) + input->at(i, clamped(y + 1, Side)));
+            }
+        benchmark::DoNotOptimize(output->data());
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * Side * Side));
+}
+BENCHMARK(BM_JacobiAt);
+
+static void BM_JacobiStencil(benchmark::State &state) {
+    auto input = std::make_unique<DArray<float, Side, Side>>();
+    auto output = std::make_unique<DArray<float, Side, Side>>();
+    std::iota(input->flat_begin(), input->flat_end(), 0.0f);
+    for (auto _: state) {
+        mdc::stencil<Neighbourhood::FivePoint>(*input, *output, [](const auto &n) {
+            return 0.25f * (n(-1, 0) + n(1, 0) + n(0, -1) + n(0, 1));
+        });
+        benchmark::DoNotOptimize(output->data());
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * Side * Side));
+}
+BENCHMARK(BM_JacobiStencil);
+
+static void BM_JacobiStencilDVector(benchmark::State &state) {
+    DVector<2, float> input(Side, Side), output(Side, Side);
+    for (auto &row: input)
+        std::iota(row.begin(), row.end(), 0.0f);
+    for (auto _: state) {
+        mdc::stencil<Neighbourhood::FivePoint>(input, output, [](const auto &n) {
+            return 0.25f * (n(-1, 0) + n(1, 0) + n(0, -1) + n(0, 1));
+        });
+        benchmark::DoNotOptimize(output.at(0).data());
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * Side * Side));
+}
+BENCHMARK(BM_JacobiStencilDVector);
+
+// Mean of the whole 3x3x3 neighbourhood of each element of a periodic cube
+
+static void BM_BoxBlurAt(benchmark::State &state) {
+    auto input = std::make_unique<DArray<float, Cube, Cube, Cube>>();
+    auto output = std::make_unique<DArray<float, Cube, Cube, Cube>>();
+    std::iota(input->flat_begin(), input->flat_end(), 0.0f);
+    for (auto _: state) {
+        for (std::size_t i = 0; i < Cube; ++i)
+            for (std::size_t j = 0; j < Cube; ++j)
+                for (std::size_t k = 0; k < Cube; ++k) {
+                    float sum = 0;
+                    for (std::size_t a = Cube - 1; a <= Cube + 1; ++a)
+                        for (std::size_t b = Cube - 1; b <= Cube + 1; ++b)
+                            for (std::size_t c = Cube - 1; c <= Cube + 1; ++c)
+                                sum += input->at((i + a) % Cube, (j + b) % Cube, (k + c) % Cube);
+                    output->at(i, j, k) = sum / 27.0f;
+                }
+        benchmark::DoNotOptimize(output->data());
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * Cube * Cube * Cube));
+}
+BENCHMARK(BM_BoxBlurAt);
+
+static void BM_BoxBlurStencil(benchmark::State &state) {
+    auto input = std::make_unique<DArray<float, Cube, Cube, Cube>>();
+    auto output = std::make_unique<DArray<float, Cube, Cube, Cube>>();
+    std::iota(input->flat_begin(), input->flat_end(), 0.0f);
+    for (auto _: state) {
+        mdc::stencil<Neighbourhood::TwentySevenPoint>(*input, *output, [](const auto &n) {
+            return n.apply([](auto... values) { return (values + ...) / 27.0f; });
+        }, Boundary::Wrap{});
+        benchmark::DoNotOptimize(output->data());
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * Cube * Cube * Cube));
+}
+BENCHMARK(BM_BoxBlurStencil);
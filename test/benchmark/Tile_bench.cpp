@@ -0,0 +1,116 @@
+/*
+ *   Copyright 2022 Alberto Guarnieri
+ *
+ *   Licensed under the Apache License, Version 2.0 (the "License");
+ *   you may not use this file except in compliance with the License.
+ *   You may obtain a copy of the License at
+ *
+ *       http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *   Unless required by applicable law or agreed to in writing, software
+ *   distributed under the License is distributed on an "AS IS" BASIS,
+ *   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *   See the License for the specific language governing permissions and
+ *   limitations under the License.
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <array>
+#include <cstdint>
+#include <memory>
+#include <numeric>
+#include "DContainers/Tile.hpp"
+
+using mdc::DArray, mdc::DView;
+
+namespace {
+    constexpr std::size_t Side = 2048;
+}
+
+// Symmetric part of a matrix, i.e. (A + A^T) / 2, reading the source both by rows and by columns
+
+static void BM_SymmetricNestedLoops(benchmark::State &state) {
+    auto source = std::make_unique<DArray<float, Side, Side>>();
+    auto destination = std::make_unique<DArray<float, Side, Side>>();
+    std::iota(source->flat_begin(), source->flat_end(), 0.0f);
+    for (auto _: state) {
+        for (std::size_t i = 0; i < Side; ++i)
+            for (std::size_t j = 0; j < Side; ++j)
+                (*destination)(i, j) = ((*source)(i, j) + (*source)(j, i)) * 0.5f;
+        benchmark::DoNotOptimize(destination->data());
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * Side * Side));
+}
+BENCHMARK(BM_SymmetricNestedLoops);
+
+// Same pass visiting the destination in tiles, so that the columns read from the source stay cached
+
+static void symmetricTiles(const DArray<float, Side, Side> &source, DArray<float, Side, Side> &destination,
+                           DView<2, float> tile, const std::array<std::size_t, 2> &origin) {
+    for (std::size_t i = 0; i < tile.shape()[0]; ++i)
+        for (std::size_t j = 0; j < tile.shape()[1]; ++j)
+            tile(i, j) = (source(origin[0] + i, origin[1] + j) + source(origin[1] + j, origin[0] + i)) * 0.5f;
+    benchmark::DoNotOptimize(destination.data());
+}
+
+template<std::size_t TileI, std::size_t TileJ>
+static void BM_SymmetricTiles(benchmark::State &state) {
+    auto source = std::make_unique<DArray<float, Side, Side>>();
+    auto destination = std::make_unique<DArray<float, Side, Side>>();
+    std::iota(source->flat_begin(), source->flat_end(), 0.0f);
+    for (auto _: state) {
+        mdc::for_each_tile<TileI, TileJ>(*destination, [&](DView<2, float> tile,
+                                                           const std::array<std::size_t, 2> &origin) {
+            symmetricTiles(*source, *destination, tile, origin);
+        });
+        benchmark::DoNotOptimize(destination->data());
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * Side * Side));
+}
+BENCHMARK(BM_SymmetricTiles<16, 16>);
+BENCHMARK(BM_SymmetricTiles<64, 64>);
+
+static void BM_SymmetricDefaultTiles(benchmark::State &state) {
+    auto source = std::make_unique<DArray<float, Side, Side>>();
+    auto destination = std::make_unique<DArray<float, Side, Side>>();
+    std::iota(source->flat_begin(), source->flat_end(), 0.0f);
+    for (auto _: state) {
+        mdc::for_each_tile(*destination, [&](DView<2, float> tile, const std::array<std::size_t, 2> &origin) {
+            symmetricTiles(*source, *destination, tile, origin);
+        });
+        benchmark::DoNotOptimize(destination->data());
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * Side * Side));
+}
+BENCHMARK(BM_SymmetricDefaultTiles);
+
+// Row-order pass, not helped by blocking, to measure the cost of visiting tiles
+
+static void BM_ScaleNestedLoops(benchmark::State &state) {
+    auto grid = std::make_unique<DArray<float, Side, Side>>();
+    std::iota(grid->flat_begin(), grid->flat_end(), 0.0f);
+    for (auto _: state) {
+        for (std::size_t i = 0; i < Side; ++i)
+            for (std::size_t j = 0; j < Side; ++j)
+                (*grid)(i, j) *= 0.5f;
+        benchmark::DoNotOptimize(grid->data());
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * Side * Side));
+}
+BENCHMARK(BM_ScaleNestedLoops);
+
+static void BM_ScaleTiles(benchmark::State &state) {
+    auto grid = std::make_unique<DArray<float, Side, Side>>();
+    std::iota(grid->flat_begin(), grid->flat_end(), 0.0f);
+    for (auto _: state) {
+        mdc::for_each_tile(*grid, [](DView<2, float> tile) {
+            for (std::size_t i = 0; i < tile.shape()[0]; ++i)
+                for (std::size_t j = 0; j < tile.shape()[1]; ++j)
+                    tile(i, j) *= 0.5f;
+        });
+        benchmark::DoNotOptimize(grid->data());
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * Side * Side));
+}
+BENCHMARK(BM_ScaleTiles);
@@ -0,0 +1,71 @@
+/*
+ *   Copyright 2022 Alberto Guarnieri
+ *
+ *   Licensed under the Apache License, Version 2.0 (the "License");
+ *   you may not use this file except in compliance with the License.
+ *   You may obtain a copy of the License at
+ *
+ *       http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *   Unless required by applicable law or agreed to in writing, software
+ *   distributed under the License is distributed on an "AS IS" BASIS,
+ *   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *   See the License for the specific language governing permissions and
+ *   limitations under the License.
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <memory>
+#include <numeric>
+#include "DContainers/DArray.hpp"
+#include "DContainers/DTensor.hpp"
+
+using mdc::DArray, mdc::DTensor;
+
+namespace {
+    constexpr std::size_t Side = 2048;
+    // DArray copies are returned by value, hence on the stack
+    constexpr std::size_t StackSide = 512;
+}
+
+// Transpose of a matrix by nested loops over the destination, reading the source column by column
+
+static void BM_TransposeNestedLoops(benchmark::State &state) {
+    auto source = std::make_unique<DArray<float, Side, Side>>();
+    auto destination = std::make_unique<DArray<float, Side, Side>>();
+    std::iota(source->flat_begin(), source->flat_end(), 0.0f);
+    for (auto _: state) {
+        for (std::size_t i = 0; i < Side; ++i)
+            for (std::size_t j = 0; j < Side; ++j)
+                (*destination)(i, j) = (*source)(j, i);
+        benchmark::DoNotOptimize(destination->data());
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * Side * Side));
+}
+BENCHMARK(BM_TransposeNestedLoops);
+
+// Transpose of the same matrix through a transposed view, copied in blocks
+
+static void BM_TransposeMaterialize(benchmark::State &state) {
+    DTensor<2, float> source(Side, Side);
+    std::iota(source.flat_begin(), source.flat_end(), 0.0f);
+    for (auto _: state) {
+        auto destination = source.transpose().materialize();
+        benchmark::DoNotOptimize(destination.data());
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * Side * Side));
+}
+BENCHMARK(BM_TransposeMaterialize);
+
+static void BM_TransposeDArray(benchmark::State &state) {
+    auto source = std::make_unique<DArray<float, StackSide, StackSide>>();
+    std::iota(source->flat_begin(), source->flat_end(), 0.0f);
+    for (auto _: state) {
+        auto destination = std::make_unique<DArray<float, StackSide, StackSide>>(source->transposed());
+        benchmark::DoNotOptimize(destination->data());
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * StackSide * StackSide));
+}
+BENCHMARK(BM_TransposeDArray);
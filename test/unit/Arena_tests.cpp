@@ -0,0 +1,102 @@
+/*
+ *   Copyright 2022 Alberto Guarnieri
+ *
+ *   Licensed under the Apache License, Version 2.0 (the "License");
+ *   you may not use this file except in compliance with the License.
+ *   You may obtain a copy of the License at
+ *
+ *       http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *   Unless required by applicable law or agreed to in writing, software
+ *   distributed under the License is distributed on an "AS IS" BASIS,
+ *   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *   See the License for the specific language governing permissions and
+ *   limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <memory_resource>
+#include "DContainers/Arena.hpp"
+#include "DContainers/DVector.hpp"
+
+using mdc::pmr::Arena;
+
+// Upstream resource counting the chunks requested by an Arena
+class CountingResource : public std::pmr::memory_resource {
+public:
+    std::size_t allocations = 0, deallocations = 0;
+
+private:
+    void *do_allocate(std::size_t bytes, std::size_t alignment) override {
+        ++allocations;
+        return std::pmr::new_delete_resource()->allocate(bytes, alignment);
+    }
+
+    void do_deallocate(void *pointer, std::size_t bytes, std::size_t alignment) override {
+        ++deallocations;
+        std::pmr::new_delete_resource()->deallocate(pointer, bytes, alignment);
+    }
+
+    bool do_is_equal(const std::pmr::memory_resource &other) const noexcept override {
+        return this == &other;
+    }
+};
+
+class ArenaTest : public ::testing::Test {
+protected:
+    CountingResource upstream;
+    Arena arena{1024, &upstream};
+};
+
+TEST_F(ArenaTest, ResetKeepsChunks) {
+    for (int request = 0; request < 10; ++request) {
+        {
+            mdc::pmr::DVector<3, float> scratch(std::allocator_arg, &arena, 8, 8, 8);
+            scratch.at(7,7,7) = 1.0f;
+            EXPECT_EQ(scratch.at(3).get_allocator().resource(), &arena);
+        }
+        arena.reset();
+    }
+    EXPECT_GT(arena.chunks(), 1);
+    EXPECT_EQ(upstream.allocations, arena.chunks());
+    EXPECT_EQ(upstream.deallocations, 0);
+
+    arena.release();
+    EXPECT_EQ(arena.chunks(), 0);
+    EXPECT_EQ(arena.capacity(), 0);
+    EXPECT_EQ(upstream.deallocations, upstream.allocations);
+}
+
+TEST_F(ArenaTest, PooledBlocksReused) {
+    void *first = arena.allocate(24, alignof(int));
+    arena.deallocate(first, 24, alignof(int));
+    // blocks are rounded to a power of two, hence a request of 32 bytes reuses the block of 24
+    EXPECT_EQ(arena.allocate(32, alignof(int)), first);
+    EXPECT_NE(arena.allocate(32, alignof(int)), first);
+
+    void *large = arena.allocate(Arena::maxPooledSize + 1, alignof(int));
+    arena.deallocate(large, Arena::maxPooledSize + 1, alignof(int));
+    EXPECT_NE(arena.allocate(Arena::maxPooledSize + 1, alignof(int)), large);
+
+    void *aligned = arena.allocate(8, 64);
+    EXPECT_EQ(reinterpret_cast<std::uintptr_t>(aligned) % 64, 0);
+}
+
+TEST_F(ArenaTest, GrowingRows) {
+    mdc::pmr::DVector<2, int> rows(&arena);
+    for (int i = 0; i < 16; ++i) {
+        rows.emplace_back();
+        for (int j = 0; j < 100; ++j)
+            rows.back().push_back(j);
+    }
+    EXPECT_EQ(rows.total(), 1600);
+    EXPECT_EQ(rows.at(15,99), 99);
+    // buffers released while rows grow are reused by the following rows
+    EXPECT_LT(arena.capacity(), 16 * 2 * 512 + 4096);
+    EXPECT_FALSE(arena.is_equal(*std::pmr::new_delete_resource()));
+    EXPECT_TRUE(arena.is_equal(arena));
+}
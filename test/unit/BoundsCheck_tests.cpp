@@ -0,0 +1,48 @@
+/*
+ *   Copyright 2022 Alberto Guarnieri
+ *
+ *   Licensed under the Apache License, Version 2.0 (the "License");
+ *   you may not use this file except in compliance with the License.
+ *   You may obtain a copy of the License at
+ *
+ *       http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *   Unless required by applicable law or agreed to in writing, software
+ *   distributed under the License is distributed on an "AS IS" BASIS,
+ *   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *   See the License for the specific language governing permissions and
+ *   limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include <type_traits>
+#include "DContainers/BoundsCheck.hpp"
+#include "DContainers/DArray.hpp"
+#include "DContainers/DVector.hpp"
+
+using mdc::BoundsCheck, mdc::DArray, mdc::DVector;
+
+TEST(BoundsCheckTest, NonePolicy) {
+    EXPECT_FALSE(BoundsCheck::None::enabled);
+    BoundsCheck::None::check(10, 2);
+}
+
+TEST(BoundsCheckTest, AssertPolicy) {
+    EXPECT_TRUE(BoundsCheck::Assert::enabled);
+    BoundsCheck::Assert::check(1, 2);
+    EXPECT_DEATH(BoundsCheck::Assert::check(2, 2), "index 2 is out of range \\(extent=2\\)");
+}
+
+TEST(BoundsCheckTest, DefaultPolicy) {
+#if defined(DCONTAINERS_BOUNDS_CHECK) || (!defined(NDEBUG) && !defined(DCONTAINERS_NO_BOUNDS_CHECK))
+    EXPECT_TRUE((std::is_same_v<BoundsCheck::Default, BoundsCheck::Assert>));
+
+    DArray<int, 2, 3> array;
+    EXPECT_DEATH(array(1, 3), "out of range");
+    DVector<2, int> vector(2, 3);
+    EXPECT_DEATH(vector(2, 0), "out of range");
+#else
+    EXPECT_TRUE((std::is_same_v<BoundsCheck::Default, BoundsCheck::None>));
+#endif
+}
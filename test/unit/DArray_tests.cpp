@@ -16,7 +16,11 @@
 
 #include <gtest/gtest.h>
 
+#include <algorithm>
+#include <numeric>
+#include <ranges>
 #include <complex>
+#include <cstdint>
 #include <string>
 #include <utility>
 #include "DContainers/DArray.hpp"
@@ -231,3 +235,146 @@ TEST_F(DArrayTest, ArrayPrinting) {
     // restore console output
     std::cout.rdbuf(console);
 }
+
+TEST_F(DArrayTest, StridedSpanView) {
+    DArray<int, 2, 1, 2> spanI3Array = i3Array.at(Span::all(), Span::of<1>(), Span::of<0, 2, 2>());
+    DArray<int, 2, 1, 2> expectedViewI3Array = {
+            {
+                    {4, 6}
+            },
+            {
+                    {10, 12}
+            }
+    };
+    EXPECT_EQ(spanI3Array, expectedViewI3Array);
+    EXPECT_EQ(spanI3Array, i3Array.at(Span::all(), Span::of<1>(), Span::of<2>(0, 2, 2)));
+
+    DArray<float, 3> spanF1Array = f1Array.at(Span::of<0, 4, 2>());
+    DArray<float, 3> expectedViewF1Array = {-0.1f, -10.9f, 3.14f};
+    EXPECT_EQ(spanF1Array, expectedViewF1Array);
+    EXPECT_EQ((f1Array.at(Span::of<2>(1, 4, 3))), (DArray<float, 2>{15.4f, 3.14f}));
+}
+
+TEST_F(DArrayTest, UncheckedFetch) {
+    EXPECT_EQ(d2Array(0,1), 1.5);
+    EXPECT_EQ(i3Array(1,1,2), 12);
+    EXPECT_FLOAT_EQ(f1Array(4), 3.14f);
+    EXPECT_EQ(complexTypeArray(1,0).first, "1,0");
+
+    i3Array(0,1,1) = -5;
+    EXPECT_EQ(i3Array.at(0,1,1), -5);
+    EXPECT_EQ(&i3Array(1,0), &i3Array.at(1,0));
+
+    const auto &constArray = d2Array;
+    EXPECT_EQ(constArray(1,2), 5.5);
+}
+
+TEST_F(DArrayTest, FlatElements) {
+    EXPECT_EQ(i3Array.elements().size(), 12);
+    EXPECT_EQ(std::reduce(i3Array.flat_begin(), i3Array.flat_end()), 78);
+    EXPECT_EQ(i3Array.flat_begin(), &i3Array.at(0,0,0));
+    EXPECT_EQ(i3Array.flat_end() - 1, &i3Array.at(1,1,2));
+
+    std::ranges::transform(i3Array.elements(), i3Array.flat_begin(), [](int x) { return x * 2; });
+    EXPECT_EQ(i3Array.at(1,0,2), 18);
+
+    const auto &constArray = d2Array;
+    static_assert(std::ranges::contiguous_range<decltype(constArray.elements())>);
+    EXPECT_EQ(*std::ranges::max_element(constArray.elements()), 5.5);
+    EXPECT_EQ(std::ranges::count(f1Array.elements(), 0.0f), 1);
+}
+
+namespace {
+
+    constexpr DArray<std::uint32_t, 256> crcTable([](std::size_t i) {
+        auto crc = static_cast<std::uint32_t>(i);
+        for (int bit = 0; bit < 8; ++bit)
+            crc = (crc & 1) ? (crc >> 1) ^ 0xEDB88320u : crc >> 1;
+        return crc;
+    });
+
+    constexpr DArray<int, 3, 4> grid([](std::size_t i, std::size_t j) { return static_cast<int>(i * 4 + j); });
+
+    constexpr auto filled() {
+        DArray<int, 2, 3> result;
+        mdc::fill(result, 7);
+        return result;
+    }
+
+    constexpr DArray<double, 2, 2> weights{{1.0, 2.0}, {3.0, 4.0}};
+    constexpr DArray<double, 2, 2> combined = weights * 2.0 + weights;
+
+}
+
+TEST_F(DArrayTest, ConstantExpressions) {
+    static_assert(crcTable[0] == 0);
+    static_assert(crcTable[1] == 0x77073096u);
+    static_assert(crcTable[255] == 0x2D02EF8Du);
+
+    static_assert(grid.at(2, 3) == 11);
+    static_assert(grid(1, 0) == 4);
+    static_assert(grid.total() == 12);
+
+    constexpr auto column = grid.at(Span::all(), Span::of<1>());
+    static_assert(column.at(2, 0) == 9);
+    constexpr auto corner = grid.at(Span::of<1, 2>(), Span::of<2, 3>());
+    static_assert(corner.at(0, 0) == 6 && corner.at(1, 1) == 11);
+    constexpr auto odd = grid.at(Span::of<0>(), Span::of<1, 3, 2>());
+    static_assert(odd.at(0, 1) == 3);
+
+    constexpr auto sevens = filled();
+    static_assert(sevens.at(1, 2) == 7);
+
+    constexpr auto halves = mdc::transform(grid, [](int x) { return x / 2.0; });
+    static_assert(std::is_same_v<std::remove_const_t<decltype(halves)>, DArray<double, 3, 4>>);
+    static_assert(halves.at(2, 3) == 5.5);
+
+    static_assert(combined.at(1, 0) == 9.0);
+    static_assert(mdc::evaluate(mdc::fma(weights, weights, 1.0)).at(1, 1) == 17.0);
+    static_assert(mdc::evaluate(mdc::where(weights > 2.0, weights, 0.0)).at(0, 1) == 0.0);
+
+    // results computed at compile time and at run time agree
+    DArray<double, 3, 4> runtimeHalves = mdc::transform(grid, [](int x) { return x / 2.0; });
+    EXPECT_EQ(runtimeHalves, halves);
+    DArray<std::uint32_t, 256> runtimeTable([](std::size_t i) { return crcTable[i]; });
+    EXPECT_EQ(runtimeTable, crcTable);
+}
+
+TEST_F(DArrayTest, PermutedCopy) {
+    DArray<int, 3, 2, 2> permuted = i3Array.permuted<2, 0, 1>();
+    for (std::size_t i = 0; i < 2; ++i)
+        for (std::size_t j = 0; j < 2; ++j)
+            for (std::size_t k = 0; k < 3; ++k)
+                EXPECT_EQ(permuted.at(k, i, j), i3Array.at(i, j, k));
+
+    auto transposed = d2Array.transposed();
+    static_assert(std::is_same_v<decltype(transposed), DArray<double, 3, 2>>);
+    EXPECT_EQ(transposed.at(2, 1), d2Array.at(1, 2));
+    EXPECT_EQ(transposed.transposed(), d2Array);
+}
+
+TEST_F(DArrayTest, RuntimeSpanning) {
+    std::size_t from = 1, to = 2;
+    mdc::DView<3, int> window = i3Array.at(Span::all(), Span::of(from), Span::of(from, to));
+    EXPECT_EQ(window.shape(), (mdc::DView<3, int>::shape_type{2, 1, 2}));
+    EXPECT_EQ(window.at(1, 0, 1), i3Array.at(1, 1, 2));
+    EXPECT_EQ(window.data(), &i3Array.at(0, 1, 1));
+
+    // views refer to the array, no copy is made
+    window.at(0, 0, 0) = -5;
+    EXPECT_EQ(i3Array.at(0, 1, 1), -5);
+
+    // runtime and compile-time spans can be mixed, intervals past the end are truncated
+    const auto &constArray = d2Array;
+    mdc::DView<2, const double> strided = constArray.at(Span::of<1>(), Span::of(0, 10, 2));
+    EXPECT_EQ(strided.shape(), (mdc::DView<2, const double>::shape_type{1, 2}));
+    EXPECT_EQ(strided.at(0, 1), d2Array.at(1, 2));
+
+    mdc::DView<1, float> tail = f1Array.at(Span::of(2, 4));
+    EXPECT_EQ(tail.size(), 3);
+    EXPECT_EQ(tail.at(0), f1Array.at(2));
+
+    // compile-time spans alone still return copies
+    DArray<int, 2, 1, 2> copy = i3Array.at(Span::all(), Span::of<1>(), Span::of<1, 2>());
+    EXPECT_EQ(copy.at(0, 0, 0), -5);
+}
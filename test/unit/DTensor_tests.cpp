@@ -0,0 +1,166 @@
+/*
+ *   Copyright 2022 Alberto Guarnieri
+ *
+ *   Licensed under the Apache License, Version 2.0 (the "License");
+ *   you may not use this file except in compliance with the License.
+ *   You may obtain a copy of the License at
+ *
+ *       http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *   Unless required by applicable law or agreed to in writing, software
+ *   distributed under the License is distributed on an "AS IS" BASIS,
+ *   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *   See the License for the specific language governing permissions and
+ *   limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <numeric>
+#include <ranges>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include "DContainers/DTensor.hpp"
+#include "DContainers/Span.hpp"
+
+using mdc::DTensor, mdc::DVector, mdc::Span;
+
+class DTensorTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        d2Tensor.at(0,0) = 0.5;
+        d2Tensor.at(0,1) = 1.5;
+        d2Tensor.at(0,2) = 2.5;
+        d2Tensor.at(1,0) = 3.5;
+        d2Tensor.at(1,1) = 4.5;
+        d2Tensor.at(1,2) = 5.5;
+
+        i3Tensor = {
+                {
+                        {1, 2, 3},
+                        {4, 5, 6}
+                },
+                {
+                        {7, 8, 9},
+                        {10, 11, 12}
+                },
+        };
+    }
+
+    DTensor<2, double> d2Tensor{2,3};
+    DTensor<2, std::string> s2Tensor{2};
+    DTensor<3, int> i3Tensor;
+};
+
+TEST_F(DTensorTest, TensorShape) {
+    EXPECT_EQ(d2Tensor.total(), 6);
+    EXPECT_EQ(s2Tensor.total(), 4);
+    EXPECT_EQ(i3Tensor.total(), 12);
+
+    EXPECT_EQ(i3Tensor.shape(), (DTensor<3, int>::shape_type{2, 2, 3}));
+    EXPECT_EQ(i3Tensor.strides(), (DTensor<3, int>::shape_type{6, 3, 1}));
+    EXPECT_EQ(d2Tensor.extent(1), 3);
+
+    DTensor<3, int> empty;
+    EXPECT_EQ(empty.total(), 0);
+}
+
+TEST_F(DTensorTest, ElementsFetch) {
+    EXPECT_EQ(d2Tensor.at(0,0), 0.5);
+    EXPECT_EQ(d2Tensor.at(1,2), 5.5);
+
+    EXPECT_EQ(i3Tensor.at(0,0,0), 1);
+    EXPECT_EQ(i3Tensor.at(0,1,2), 6);
+    EXPECT_EQ(i3Tensor.at(1,1,2), 12);
+
+    EXPECT_THROW(d2Tensor.at(2,0), std::out_of_range);
+    EXPECT_THROW(d2Tensor.at(0,3), std::out_of_range);
+    EXPECT_THROW(i3Tensor.at(0,-1,0), std::out_of_range);
+}
+
+TEST_F(DTensorTest, ContiguousStorage) {
+    const int* data = i3Tensor.data();
+    for (int i = 0; i < 12; ++i)
+        EXPECT_EQ(data[i], i + 1);
+
+    i3Tensor.at(1,0,1) = 20;
+    EXPECT_EQ(i3Tensor.data()[7], 20);
+}
+
+TEST_F(DTensorTest, FillConstructor) {
+    DTensor<3, std::string> filled({2, 1, 2}, "value");
+    EXPECT_EQ(filled.total(), 4);
+    EXPECT_EQ(filled.at(1,0,1), "value");
+}
+
+TEST_F(DTensorTest, NonRectangularInitialization) {
+    EXPECT_THROW((DTensor<2, int>{{1, 2}, {3}}), std::invalid_argument);
+}
+
+TEST_F(DTensorTest, DVectorConversion) {
+    DVector<3, int> i3Vector = {
+            {
+                    {1, 2, 3},
+                    {4, 5, 6}
+            },
+            {
+                    {7, 8, 9},
+                    {10, 11, 12}
+            },
+    };
+    DTensor<3, int> fromVector(i3Vector);
+    EXPECT_EQ(fromVector, i3Tensor);
+    EXPECT_EQ((static_cast<DVector<3, int>>(i3Tensor)), i3Vector);
+
+    i3Vector.at(1,1).push_back(13);
+    EXPECT_THROW((DTensor<3, int>{i3Vector}), std::invalid_argument);
+}
+
+TEST_F(DTensorTest, SpanViewMethods) {
+    DTensor<3, int> spanI3Tensor = i3Tensor.at(Span::all(), Span::of(1), Span::of(1, 2));
+    DTensor<3, int> expectedViewI3Tensor = {
+            {
+                    {5, 6}
+            },
+            {
+                    {11, 12}
+            }
+    };
+    EXPECT_EQ(spanI3Tensor, expectedViewI3Tensor);
+    EXPECT_EQ(spanI3Tensor, i3Tensor.at(Span::all(), Span::of<1>(), Span::of<1,2>()));
+
+    DTensor<2, double> spanD2Tensor = d2Tensor.at(Span::of(1, 5), Span::of(2, 10));
+    DTensor<2, double> expectedViewD2Tensor = {{5.5}};
+    EXPECT_EQ(spanD2Tensor, expectedViewD2Tensor);
+
+    EXPECT_EQ(d2Tensor.at(Span::of(3), Span::all()).total(), 0);
+    EXPECT_EQ(i3Tensor.at(Span::all(), Span::all(), Span::all()), i3Tensor);
+}
+
+TEST_F(DTensorTest, TensorPrinting) {
+    std::ostringstream tensorStream, vectorStream;
+    tensorStream << i3Tensor;
+    vectorStream << static_cast<DVector<3, int>>(i3Tensor);
+    EXPECT_EQ(tensorStream.str(), "DTensor<3>{\n|1, 2, 3|\n|4, 5, 6|,\n\n|7, 8, 9|\n|10, 11, 12|\n}");
+    EXPECT_EQ(vectorStream.str(), "DVector<3>{\n|1, 2, 3|\n|4, 5, 6|,\n\n|7, 8, 9|\n|10, 11, 12|\n}");
+}
+
+TEST_F(DTensorTest, UncheckedFetch) {
+    EXPECT_EQ(d2Tensor(0,1), 1.5);
+    EXPECT_EQ(i3Tensor(1,1,2), 12);
+
+    i3Tensor(0,1,1) = -5;
+    EXPECT_EQ(i3Tensor.at(0,1,1), -5);
+
+    const auto &constTensor = d2Tensor;
+    EXPECT_EQ(constTensor(1,2), 5.5);
+}
+
+TEST_F(DTensorTest, FlatElements) {
+    EXPECT_EQ(std::reduce(i3Tensor.flat_begin(), i3Tensor.flat_end()), 78);
+    std::ranges::fill(d2Tensor.elements(), 1.0);
+    EXPECT_EQ(d2Tensor.at(1,2), 1.0);
+    EXPECT_EQ(std::ranges::size(i3Tensor.elements()), i3Tensor.total());
+}
@@ -16,8 +16,16 @@
 
 #include <gtest/gtest.h>
 
+#include <algorithm>
+#include <numeric>
+#include <ranges>
+#include <vector>
 #include <complex>
+#include <memory>
+#include <memory_resource>
+#include <stdexcept>
 #include <string>
+#include <type_traits>
 #include <utility>
 #include "DContainers/DVector.hpp"
 #include "DContainers/Span.hpp"
@@ -73,6 +81,30 @@ TEST_F(DVectorTest, VectorTotal) {
     EXPECT_EQ(complexTypeVector.total(), 4);
 }
 
+TEST_F(DVectorTest, VectorShape) {
+    EXPECT_EQ(d2Vector.shape(), (DVector<2, double>::shape_type{2, 3}));
+    EXPECT_EQ(i3Vector.shape(), (DVector<3, int>::shape_type{2, 2, 5}));
+    EXPECT_EQ(f1Vector.shape(), (DVector<1, float>::shape_type{5}));
+
+    EXPECT_EQ(i3Vector.max_extent(0), 2);
+    EXPECT_EQ(i3Vector.max_extent(2), 5);
+    EXPECT_EQ(f1Vector.max_extent(0), 5);
+    EXPECT_THROW(i3Vector.max_extent(3), std::out_of_range);
+    EXPECT_THROW(f1Vector.max_extent(1), std::out_of_range);
+
+    EXPECT_TRUE(d2Vector.is_rectangular());
+    EXPECT_TRUE(s2Vector.is_rectangular());
+    EXPECT_FALSE(i3Vector.is_rectangular());
+    EXPECT_TRUE(f1Vector.is_rectangular());
+    EXPECT_TRUE((DVector<3, int>{{}, {}}.is_rectangular()));
+    EXPECT_FALSE((DVector<3, int>{{}, {{1}}}.is_rectangular()));
+
+    DVector<3, int> sparse = {{}, {{}, {1}, {}}, {}, {{2, 3}}};
+    EXPECT_EQ(sparse.shape(), (DVector<3, int>::shape_type{4, 3, 2}));
+    EXPECT_EQ(sparse.total(), 3);
+    EXPECT_EQ((DVector<3, int>().shape()), (DVector<3, int>::shape_type{0, 0, 0}));
+}
+
 TEST_F(DVectorTest, ElementsFetch) {
     EXPECT_EQ(d2Vector.at(0,0), 0.5);
     EXPECT_EQ(d2Vector.at(0,1), 1.5);
@@ -234,4 +266,116 @@ TEST_F(DVectorTest, VectorPrinting) {
 
     // restore console output
     std::cout.rdbuf(console);
-}
\ No newline at end of file
+}
+
+TEST_F(DVectorTest, SpanViewShape) {
+    DVector<3, int> spanI3Vector = i3Vector.at(Span::of(1), Span::all(), Span::of(0, 1));
+    EXPECT_EQ(spanI3Vector.size(), 1);
+    EXPECT_EQ(spanI3Vector.at(0).size(), 2);
+    EXPECT_EQ(spanI3Vector.capacity(), 1);
+    EXPECT_EQ(spanI3Vector.at(0).capacity(), 2);
+
+    DVector<2, double> emptyVector;
+    EXPECT_TRUE(emptyVector.at(Span::all(), Span::all()).empty());
+}
+
+TEST_F(DVectorTest, StridedSpanView) {
+    DVector<3, int> spanI3Vector = i3Vector.at(Span::all(), Span::of(1), Span::of(0, 4, 2));
+    DVector<3, int> expectedViewI3Vector = {
+            {
+                    {4, 6}
+            },
+            {
+                    {10, 12, 14}
+            }
+    };
+    EXPECT_EQ(spanI3Vector, expectedViewI3Vector);
+
+    DVector<1, float> spanF1Vector = f1Vector.at(Span::of(1, 10, 3));
+    DVector<1, float> expectedViewF1Vector = {15.4, 3.14};
+    EXPECT_EQ(spanF1Vector, expectedViewF1Vector);
+    EXPECT_EQ(f1Vector.at(Span::of<0, 4, 2>()).size(), 3);
+}
+
+TEST_F(DVectorTest, UncheckedFetch) {
+    EXPECT_EQ(d2Vector(0,1), 1.5);
+    EXPECT_EQ(i3Vector(1,1,4), 14);
+    EXPECT_FLOAT_EQ(f1Vector(4), 3.14f);
+    EXPECT_EQ(s2Vector(1,0), "1,0");
+
+    i3Vector(0,1,3) = -7;
+    EXPECT_EQ(i3Vector.at(0,1,3), -7);
+    EXPECT_EQ(&i3Vector(1,0), &i3Vector.at(1,0));
+
+    const auto &constVector = d2Vector;
+    EXPECT_EQ(constVector(1,2), 5.5);
+}
+
+TEST_F(DVectorTest, FlatElements) {
+    std::vector<int> flattened(i3Vector.flat_begin(), i3Vector.flat_end());
+    EXPECT_EQ(flattened, (std::vector<int>{1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14}));
+    EXPECT_EQ(std::reduce(f1Vector.flat_begin(), f1Vector.flat_end()), f1Vector.at(0) + f1Vector.at(1)
+            + f1Vector.at(2) + f1Vector.at(3) + f1Vector.at(4));
+
+    static_assert(std::ranges::forward_range<decltype(i3Vector.elements())>);
+    std::ranges::transform(i3Vector.elements(), i3Vector.flat_begin(), [](int x) { return -x; });
+    EXPECT_EQ(i3Vector.at(1,1,4), -14);
+    EXPECT_EQ(std::ranges::distance(i3Vector.elements()), i3Vector.total());
+
+    const auto &constVector = d2Vector;
+    EXPECT_EQ(*std::ranges::max_element(constVector.elements()), 5.5);
+
+    DVector<3, int> sparse = {{}, {{}, {1}, {}}, {}, {{2, 3}}, {{}}};
+    EXPECT_TRUE((std::ranges::equal(sparse.elements(), std::vector<int>{1, 2, 3})));
+    EXPECT_TRUE((DVector<3, int>{{}, {{}}}.elements().empty()));
+    EXPECT_TRUE((DVector<2, int>().elements().empty()));
+}
+
+TEST_F(DVectorTest, BulkConstruction) {
+    DVector<3, std::string> filled({2, 3, 1}, "value");
+    EXPECT_EQ(filled.shape(), (DVector<3, std::string>::shape_type{2, 3, 1}));
+    EXPECT_TRUE(filled.is_rectangular());
+    EXPECT_EQ(filled.at(1,2,0), "value");
+    EXPECT_EQ((DVector<1, int>({3}, 7)), (DVector<1, int>{7, 7, 7}));
+
+    DVector<3, int> generated({2, 2, 3}, [](std::size_t i, std::size_t j, std::size_t k) {
+        return static_cast<int>(i * 6 + j * 3 + k + 1);
+    });
+    EXPECT_EQ(generated, (DVector<3, int>{{{1, 2, 3}, {4, 5, 6}}, {{7, 8, 9}, {10, 11, 12}}}));
+    EXPECT_EQ((DVector<1, double>({3}, [](std::size_t i) { return i * 0.5; })), (DVector<1, double>{0.0, 0.5, 1.0}));
+
+    DVector<2, double> overwritten(mdc::for_overwrite, {4, 2});
+    EXPECT_EQ(overwritten.shape(), (DVector<2, double>::shape_type{4, 2}));
+    DVector<3, double, mdc::DefaultInitAllocator<double>> uninitialized(mdc::for_overwrite, {2, 3, 4});
+    EXPECT_EQ(uninitialized.total(), 24);
+    uninitialized.at(1,2,3) = 1.5;
+    EXPECT_EQ(uninitialized.at(1,2,3), 1.5);
+    static_assert(std::is_same_v<decltype(uninitialized.at(0,0).get_allocator()), mdc::DefaultInitAllocator<double>>);
+
+    DVector<2, int> cube(3);
+    EXPECT_EQ(cube.shape(), (DVector<2, int>::shape_type{3, 3}));
+    EXPECT_EQ((DVector<3, int>(2, 0, 4).shape()), (DVector<3, int>::shape_type{2, 0, 0}));
+}
+
+TEST_F(DVectorTest, MemoryResource) {
+    std::pmr::monotonic_buffer_resource resource;
+    mdc::pmr::DVector<3, int> pmrVector(std::allocator_arg, &resource, 2, 3, 4);
+    EXPECT_EQ(pmrVector.total(), 24);
+    EXPECT_EQ(pmrVector.at(1,2).get_allocator().resource(), &resource);
+
+    pmrVector.at(1).emplace_back(5);
+    pmrVector.emplace_back();
+    EXPECT_EQ(pmrVector.at(1,3).size(), 5);
+    EXPECT_EQ(pmrVector.at(1,3).get_allocator().resource(), &resource);
+    EXPECT_EQ(pmrVector.at(2).get_allocator().resource(), &resource);
+
+    auto spanned = pmrVector.at(Span::of(1), Span::all(), Span::of(0, 1));
+    EXPECT_EQ(spanned.at(0,3).size(), 2);
+    EXPECT_EQ(spanned.at(0,3).get_allocator().resource(), &resource);
+    EXPECT_EQ(pmrVector.view(Span::all(), Span::of(0), Span::all()).materialize().at(0,0).get_allocator().resource(),
+              &resource);
+
+    mdc::pmr::DVector<2, int> cube(std::allocator_arg, &resource, 3);
+    EXPECT_EQ(cube.total(), 9);
+    EXPECT_EQ(cube.at(2).get_allocator().resource(), &resource);
+}
@@ -0,0 +1,275 @@
+/*
+ *   Copyright 2022 Alberto Guarnieri
+ *
+ *   Licensed under the Apache License, Version 2.0 (the "License");
+ *   you may not use this file except in compliance with the License.
+ *   You may obtain a copy of the License at
+ *
+ *       http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *   Unless required by applicable law or agreed to in writing, software
+ *   distributed under the License is distributed on an "AS IS" BASIS,
+ *   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *   See the License for the specific language governing permissions and
+ *   limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <iterator>
+#include <numeric>
+#include <stdexcept>
+#include <string>
+#include "DContainers/DArray.hpp"
+#include "DContainers/DTensor.hpp"
+#include "DContainers/DVector.hpp"
+#include "DContainers/DView.hpp"
+#include "DContainers/Span.hpp"
+
+using mdc::DArray, mdc::DTensor, mdc::DVector, mdc::DView, mdc::DVectorView, mdc::Span;
+
+class DViewTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        i3Array = {
+                {
+                        {1, 2, 3},
+                        {4, 5, 6}
+                },
+                {
+                        {7, 8, 9},
+                        {10, 11, 12}
+                },
+        };
+
+        i3Vector = {
+                {
+                        {1, 2, 3},
+                        {4, 5, 6, 7}
+                },
+                {
+                        {8, 9},
+                        {10, 11, 12, 13, 14}
+                },
+        };
+
+        f1Array = { -0.1f, 15.4f, -10.9f, 0.0f, 3.14f };
+    }
+
+    DArray<int, 2, 2, 3> i3Array;
+    DVector<3, int> i3Vector;
+    DArray<float, 5> f1Array;
+};
+
+TEST_F(DViewTest, ArrayViewFetch) {
+    DView<3, int> view = i3Array.view();
+    EXPECT_EQ(view.total(), 12);
+    EXPECT_EQ(view.shape(), (DView<3, int>::shape_type{2, 2, 3}));
+    EXPECT_TRUE(view.contiguous());
+    EXPECT_EQ(view.at(1,1,2), 12);
+    EXPECT_EQ(&view.at(0,1,0), &i3Array.at(0,1,0));
+
+    EXPECT_THROW(view.at(2,0,0), std::out_of_range);
+    EXPECT_THROW(view.at(0,0,3), std::out_of_range);
+
+    DView<2, int> plane = view.at(1);
+    EXPECT_EQ(plane.at(0,2), 9);
+    DView<1, int> row = view.at(0,1);
+    EXPECT_EQ(row.at(0), 4);
+}
+
+TEST_F(DViewTest, ArraySpanView) {
+    auto view = i3Array.view(Span::all(), Span::of<1>(), Span::of(1, 2));
+    EXPECT_EQ(view.shape(), (DView<3, int>::shape_type{2, 1, 2}));
+    EXPECT_FALSE(view.contiguous());
+    EXPECT_EQ(view.at(0,0,0), 5);
+    EXPECT_EQ(view.at(1,0,1), 12);
+
+    DArray<int, 2, 1, 2> copied = i3Array.at(Span::all(), Span::of<1>(), Span::of<1,2>());
+    EXPECT_EQ(view.materialize(), (DTensor<3, int>{{{5, 6}}, {{11, 12}}}));
+    EXPECT_EQ(view.materialize().at(1,0,1), copied.at(1,0,1));
+
+    auto f1View = f1Array.view(Span::of(1, 10));
+    EXPECT_EQ(f1View.total(), 4);
+    EXPECT_FLOAT_EQ(f1View.at(3), 3.14f);
+    EXPECT_EQ(f1Array.view(Span::of(7)).total(), 0);
+}
+
+TEST_F(DViewTest, WriteThroughView) {
+    auto view = i3Array.view(Span::of(1), Span::all(), Span::of(0, 1));
+    view.at(0,1,1) = -11;
+    EXPECT_EQ(i3Array.at(1,1,1), -11);
+
+    for (auto plane: view)
+        for (auto row: plane)
+            for (auto &element: row)
+                element = 0;
+    EXPECT_EQ(i3Array.at(1,0,0), 0);
+    EXPECT_EQ(i3Array.at(1,1,1), 0);
+    EXPECT_EQ(i3Array.at(1,1,2), 12);
+    EXPECT_EQ(i3Array.at(0,0,0), 1);
+}
+
+TEST_F(DViewTest, ViewIteration) {
+    const auto &constArray = i3Array;
+    DView<3, const int> view = constArray.view();
+    int expected = 1;
+    for (auto plane: view)
+        for (auto row: plane)
+            for (const auto &element: row)
+                EXPECT_EQ(element, expected++);
+
+    auto row = view.at(1, 0);
+    static_assert(std::random_access_iterator<decltype(row.begin())>);
+    EXPECT_EQ(std::accumulate(row.begin(), row.end(), 0), 24);
+    EXPECT_EQ(view.end() - view.begin(), 2);
+}
+
+TEST_F(DViewTest, TensorView) {
+    DTensor<2, double> tensor({4, 4}, 1.0);
+    auto block = tensor.view(Span::of(1, 2), Span::of(1, 2));
+    for (auto row: block)
+        std::fill(row.begin(), row.end(), 2.0);
+    EXPECT_EQ(tensor.at(1,1), 2.0);
+    EXPECT_EQ(tensor.at(2,2), 2.0);
+    EXPECT_EQ(tensor.at(0,0), 1.0);
+    EXPECT_EQ(tensor.at(3,2), 1.0);
+
+    DView<2, const double> constView = block;
+    EXPECT_EQ(constView.at(0,0), 2.0);
+    EXPECT_EQ(block.at(Span::of(1), Span::all()).materialize(), (DTensor<2, double>{{2.0, 2.0}}));
+}
+
+TEST_F(DViewTest, VectorView) {
+    DVectorView<3, int> view = i3Vector.view(Span::all(), Span::of(1), Span::of(1, 3));
+    EXPECT_EQ(view.size(), 2);
+    EXPECT_EQ(view.total(), 6);
+    EXPECT_EQ(view.at(0,0,2), 7);
+    EXPECT_EQ(view.at(1,0,1), 12);
+    EXPECT_THROW(view.at(1,0,3), std::out_of_range);
+
+    auto jaggedView = i3Vector.view(Span::all(), Span::all(), Span::of(2, 3));
+    EXPECT_EQ(jaggedView.at(0).total(), 3);
+    EXPECT_EQ(jaggedView.at(1,0).size(), 0);
+    EXPECT_EQ(jaggedView.at(1,1,1), 13);
+
+    DVector<3, int> expected = {
+            {
+                    {5, 6, 7}
+            },
+            {
+                    {11, 12, 13}
+            }
+    };
+    EXPECT_EQ(view.materialize(), expected);
+    EXPECT_EQ(view.materialize(), i3Vector.at(Span::all(), Span::of(1), Span::of(1, 3)));
+
+    view.at(1,0,0) = 0;
+    EXPECT_EQ(i3Vector.at(1,1,1), 0);
+}
+
+TEST_F(DViewTest, VectorViewIteration) {
+    const auto &constVector = i3Vector;
+    auto view = constVector.view(Span::of(1), Span::all(), Span::all());
+    std::size_t rows = 0;
+    int expected = 8;
+    for (auto plane: view)
+        for (auto row: plane) {
+            ++rows;
+            for (const auto &element: row)
+                EXPECT_EQ(element, expected++);
+        }
+    EXPECT_EQ(rows, 2);
+    EXPECT_EQ(view.total(), 7);
+
+    auto row = i3Vector.at(0).view(Span::of(1, 8), Span::all());
+    std::fill(row.at(0).begin(), row.at(0).end(), -1);
+    EXPECT_EQ(i3Vector.at(0,1), (DVector<1, int>{-1, -1, -1, -1}));
+    EXPECT_EQ(i3Vector.at(0,0), (DVector<1, int>{1, 2, 3}));
+}
+
+TEST_F(DViewTest, StridedView) {
+    DTensor<2, int> grid({6, 6}, 0);
+    auto view = grid.view(Span::of(0, 5, 2), Span::of(1, 5, 2));
+    EXPECT_EQ(view.shape(), (DView<2, int>::shape_type{3, 3}));
+    EXPECT_EQ(view.strides(), (DView<2, int>::shape_type{12, 2}));
+    for (auto row: view)
+        for (auto &element: row)
+            element = 1;
+    EXPECT_EQ(grid.at(0,1), 1);
+    EXPECT_EQ(grid.at(4,5), 1);
+    EXPECT_EQ(grid.at(1,1), 0);
+    EXPECT_EQ(grid.at(0,2), 0);
+
+    auto decimated = view.at(Span::of(0, 2, 2), Span::all());
+    EXPECT_EQ(decimated.shape(), (DView<2, int>::shape_type{2, 3}));
+    EXPECT_EQ(&decimated.at(1,2), &grid.at(4,5));
+
+    auto vectorView = i3Vector.view(Span::all(), Span::all(), Span::of(0, 4, 2));
+    EXPECT_EQ(vectorView.at(1,1).size(), 3);
+    EXPECT_EQ(vectorView.at(1,0).size(), 1);
+    EXPECT_EQ(vectorView.at(1,1,2), 14);
+    EXPECT_EQ(vectorView.at(Span::all(), Span::all(), Span::of(1, 2)).at(1,1,0), 12);
+    EXPECT_EQ(vectorView.materialize(), i3Vector.at(Span::all(), Span::all(), Span::of(0, 4, 2)));
+}
+
+TEST_F(DViewTest, UncheckedFetch) {
+    auto view = i3Array.view(Span::all(), Span::of(1), Span::of(0, 2, 2));
+    EXPECT_EQ(view(1,0,1), 12);
+    view(0,0,0) = -4;
+    EXPECT_EQ(i3Array.at(0,1,0), -4);
+
+    auto vectorView = i3Vector.view(Span::of(1), Span::all(), Span::of(1, 4));
+    EXPECT_EQ(vectorView(0,1,3), 14);
+    EXPECT_EQ(&vectorView(0,0,0), &i3Vector.at(1,0,1));
+}
+
+TEST_F(DViewTest, PermutedView) {
+    DView<3, int> permuted = i3Array.permute<2, 0, 1>();
+    EXPECT_EQ(permuted.shape(), (DView<3, int>::shape_type{3, 2, 2}));
+    EXPECT_FALSE(permuted.contiguous());
+    for (std::size_t i = 0; i < 2; ++i)
+        for (std::size_t j = 0; j < 2; ++j)
+            for (std::size_t k = 0; k < 3; ++k)
+                EXPECT_EQ(permuted.at(k, i, j), i3Array.at(i, j, k));
+
+    // no copy: writes reach the array
+    permuted.at(2, 1, 0) = -9;
+    EXPECT_EQ(i3Array.at(1, 0, 2), -9);
+
+    auto transposed = i3Array.transpose();
+    EXPECT_EQ(transposed.shape(), (DView<3, int>::shape_type{3, 2, 2}));
+    EXPECT_EQ(transposed.at(0, 1, 1), 10);
+    EXPECT_EQ(transposed.transpose().shape(), i3Array.view().shape());
+
+    EXPECT_EQ(i3Array.view().permute({1, 2, 0}).at(1, 2, 0), 6);
+    EXPECT_THROW(i3Array.view().permute({0, 0, 1}), std::invalid_argument);
+
+    DTensor<2, int> matrix{{1, 2, 3}, {4, 5, 6}};
+    const auto &constMatrix = matrix;
+    DView<2, const int> columns = constMatrix.transpose();
+    EXPECT_EQ(columns.at(2, 1), 6);
+    EXPECT_EQ((matrix.permute<1, 0>().at(0, 1)), 4);
+}
+
+TEST_F(DViewTest, BlockedMaterialization) {
+    // large enough to span several blocks in both dimensions, with partial blocks at the borders
+    DTensor<2, int> matrix(150, 70);
+    std::iota(matrix.flat_begin(), matrix.flat_end(), 0);
+    DTensor<2, int> transposed = matrix.transpose().materialize();
+    EXPECT_EQ(transposed.shape(), (DTensor<2, int>::shape_type{70, 150}));
+    bool equal = true;
+    for (std::size_t i = 0; i < 150; ++i)
+        for (std::size_t j = 0; j < 70; ++j)
+            equal = equal && transposed.at(j, i) == matrix.at(i, j);
+    EXPECT_TRUE(equal);
+
+    DTensor<3, int> cube(40, 3, 50);
+    std::iota(cube.flat_begin(), cube.flat_end(), 0);
+    DTensor<3, int> rotated = cube.permute<2, 1, 0>().materialize();
+    EXPECT_EQ(rotated.at(49, 2, 39), cube.at(39, 2, 49));
+    EXPECT_EQ(rotated.at(7, 1, 3), cube.at(3, 1, 7));
+    EXPECT_EQ(cube.view(Span::of(0, 9, 3), Span::all(), Span::of(1)).transpose().materialize().at(0, 2, 3),
+              cube.at(9, 2, 1));
+}
@@ -0,0 +1,123 @@
+/*
+ *   Copyright 2022 Alberto Guarnieri
+ *
+ *   Licensed under the Apache License, Version 2.0 (the "License");
+ *   you may not use this file except in compliance with the License.
+ *   You may obtain a copy of the License at
+ *
+ *       http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *   Unless required by applicable law or agreed to in writing, software
+ *   distributed under the License is distributed on an "AS IS" BASIS,
+ *   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *   See the License for the specific language governing permissions and
+ *   limitations under the License.
+ */
+
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <map>
+#include <type_traits>
+#include <vector>
+#include "DContainers/DArray.hpp"
+#include "DContainers/Expression.hpp"
+
+using mdc::DArray, mdc::ArrayExpression;
+
+class ExpressionTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        d2First = {
+                {1.0, 2.0, 3.0},
+                {4.0, 5.0, 6.0}
+        };
+        d2Second = {
+                {0.5, 0.5, 0.5},
+                {2.0, -2.0, 1.0}
+        };
+        i1Array = {-3, 0, 7, -1};
+    }
+
+    DArray<double, 2, 3> d2First;
+    DArray<double, 2, 3> d2Second;
+    DArray<int, 4> i1Array;
+};
+
+TEST_F(ExpressionTest, Arithmetic) {
+    DArray<double, 2, 3> sum = d2First + d2Second;
+    EXPECT_EQ(sum.at(0,0), 1.5);
+    EXPECT_EQ(sum.at(1,1), 3.0);
+
+    DArray<double, 2, 3> compound = (d2First - d2Second) * 2.0 + d2First / d2Second;
+    for (std::size_t i = 0; i < 2; ++i)
+        for (std::size_t j = 0; j < 3; ++j)
+            EXPECT_DOUBLE_EQ(compound.at(i,j), (d2First.at(i,j) - d2Second.at(i,j)) * 2.0
+                                               + d2First.at(i,j) / d2Second.at(i,j));
+
+    DArray<int, 4> negated = -i1Array + 1;
+    EXPECT_EQ(negated, (DArray<int, 4>{4, 1, -6, 2}));
+
+    d2First = d2First * d2First;
+    EXPECT_EQ(d2First.at(1,2), 36.0);
+}
+
+TEST_F(ExpressionTest, LazyEvaluation) {
+    auto expression = d2First + d2Second * 3.0;
+    static_assert(std::is_same_v<decltype(expression)::shape, std::index_sequence<2, 3>>);
+    static_assert(!std::is_same_v<decltype(expression), DArray<double, 2, 3>>);
+
+    d2Second.at(0,0) = 10.0;
+    EXPECT_EQ(expression[0], 31.0);
+    EXPECT_EQ(mdc::evaluate(expression).at(0,0), 31.0);
+}
+
+TEST_F(ExpressionTest, Functions) {
+    DArray<int, 4> absolute = mdc::abs(i1Array);
+    EXPECT_EQ(absolute, (DArray<int, 4>{3, 0, 7, 1}));
+
+    DArray<double, 2, 3> fused = mdc::fma(d2First, d2Second, 1.0);
+    EXPECT_DOUBLE_EQ(fused.at(1,1), -9.0);
+
+    DArray<int, 4> clamped = mdc::where(i1Array < 0, 0, i1Array);
+    EXPECT_EQ(clamped, (DArray<int, 4>{0, 0, 7, 0}));
+
+    DArray<bool, 2, 3> greater = d2First > d2Second * 2.0;
+    EXPECT_TRUE(greater.at(0,1));
+    EXPECT_FALSE(greater.at(1,0));
+    DArray<bool, 4> zeros = mdc::equal(i1Array, 0);
+    EXPECT_EQ(zeros, (DArray<bool, 4>{false, true, false, false}));
+    EXPECT_TRUE(d2First == d2First);
+}
+
+TEST_F(ExpressionTest, WholeArrayOrdering) {
+    // two DArrays are ordered lexicographically, like std::array
+    DArray<int, 2> first{1, 5}, second{2, 0};
+    static_assert(std::is_same_v<decltype(first < second), bool>);
+    static_assert(std::is_same_v<decltype(first >= second), bool>);
+    EXPECT_TRUE(first < second);
+    EXPECT_FALSE(first > second);
+
+    std::vector<DArray<int, 2>> sorted{second, first};
+    std::sort(sorted.begin(), sorted.end());
+    EXPECT_EQ(sorted.front(), first);
+    std::map<DArray<int, 2>, int> keys{{second, 2}, {first, 1}};
+    EXPECT_EQ(keys.begin()->second, 1);
+
+    DArray<bool, 2> less = mdc::less(first, second);
+    EXPECT_EQ(less, (DArray<bool, 2>{true, false}));
+    EXPECT_EQ((DArray<bool, 2>(mdc::greater_equal(first, second))), (DArray<bool, 2>{false, true}));
+    EXPECT_EQ((DArray<bool, 2>(first < second * 2)), (DArray<bool, 2>{true, false}));
+}
+
+template<typename L, typename R>
+concept Summable = requires(const L &lhs, const R &rhs) { lhs + rhs; };
+
+TEST_F(ExpressionTest, CompileTimeShape) {
+    static_assert(Summable<DArray<double, 2, 3>, DArray<float, 2, 3>>);
+    static_assert(Summable<DArray<double, 2, 3>, int>);
+    static_assert(!Summable<DArray<double, 2, 3>, DArray<double, 3, 2>>);
+    static_assert(!Summable<DArray<double, 6>, DArray<double, 2, 3>>);
+    static_assert(!Summable<decltype(std::declval<DArray<int, 4>>() * 2), DArray<int, 5>>);
+}
@@ -0,0 +1,150 @@
+/*
+ *   Copyright 2022 Alberto Guarnieri
+ *
+ *   Licensed under the Apache License, Version 2.0 (the "License");
+ *   you may not use this file except in compliance with the License.
+ *   You may obtain a copy of the License at
+ *
+ *       http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *   Unless required by applicable law or agreed to in writing, software
+ *   distributed under the License is distributed on an "AS IS" BASIS,
+ *   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *   See the License for the specific language governing permissions and
+ *   limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <iomanip>
+#include <limits>
+#include <sstream>
+#include <string>
+#include "DContainers/DArray.hpp"
+#include "DContainers/DTensor.hpp"
+#include "DContainers/DVector.hpp"
+#include "DContainers/JaggedDVector.hpp"
+
+using mdc::DArray, mdc::DTensor, mdc::DVector, mdc::Format;
+
+class FormatTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        i3Vector = {
+                {
+                        {1, 2, 3},
+                        {4, 5, 6, 7}
+                },
+                {
+                        {8, 9},
+                        {10, 11, 12, 13, 14}
+                },
+        };
+
+        d2Array = {
+                {0.5, 1.0 / 3.0, -2.0},
+                {1e-7, 4.25, 1e20}
+        };
+    }
+
+    template<typename C>
+    static std::string streamed(const C &container) {
+        std::ostringstream os;
+        os << container;
+        return os.str();
+    }
+
+    DVector<3, int> i3Vector;
+    DArray<double, 2, 3> d2Array;
+};
+
+TEST_F(FormatTest, StreamLayout) {
+    const std::string i3Text = "DVector<3>{\n|1, 2, 3|\n|4, 5, 6, 7|,\n\n|8, 9|\n|10, 11, 12, 13, 14|\n}";
+    EXPECT_EQ(streamed(i3Vector), i3Text);
+    EXPECT_EQ(streamed(mdc::compact(i3Vector)), "Jagged" + i3Text);
+    EXPECT_EQ(streamed(d2Array), "|0.5, 0.333333, -2|\n|1e-07, 4.25, 1e+20|");
+    EXPECT_EQ(streamed(DTensor<3, int>({2, 1, 2}, 7)), "DTensor<3>{\n|7, 7|,\n\n|7, 7|\n}");
+    EXPECT_EQ(streamed(DArray<short, 2, 1, 2>{{{{1, 2}}}, {{{3, 4}}}}), "DArray<2,1,2>{\n|1, 2|,\n\n|3, 4|\n}");
+    EXPECT_EQ(streamed(DVector<1, char>{'a', 'b'}), "|a, b|");
+    EXPECT_EQ(streamed(DVector<2, int>()), "");
+    EXPECT_EQ(streamed(DVector<3, int>()), "DVector<3>{\n\n}");
+}
+
+TEST_F(FormatTest, StreamFlags) {
+    std::ostringstream os;
+    os << std::fixed << std::setprecision(2) << d2Array;
+    EXPECT_EQ(os.str(), "|0.50, 0.33, -2.00|\n|0.00, 4.25, 100000000000000000000.00|");
+
+    std::ostringstream scientific;
+    scientific << std::scientific << std::setprecision(1) << d2Array.at(0);
+    EXPECT_EQ(scientific.str(), "|5.0e-01, 3.3e-01, -2.0e+00|");
+
+    // flags not supported by std::to_chars are still honored by the stream
+    std::ostringstream showpos;
+    showpos << std::showpos << DArray<int, 3>{1, -2, 0};
+    EXPECT_EQ(showpos.str(), "|+1, -2, +0|");
+    std::ostringstream hex;
+    hex << std::hex << DVector<1, int>{255, 16};
+    EXPECT_EQ(hex.str(), "|ff, 10|");
+}
+
+TEST_F(FormatTest, StreamWidth) {
+    // as for a single value, the width pads the first text written and does not leak to the next value
+    std::ostringstream os;
+    os << std::setw(8) << DArray<int, 2>{1, 2} << 42;
+    EXPECT_EQ(os.str(), "       |1, 2|42");
+
+    std::ostringstream left;
+    left << std::left << std::setfill('.') << std::setw(12) << DArray<int, 1, 2>{{{1, 2}}} << 42;
+    EXPECT_EQ(left.str(), "|...........1, 2|42");
+
+    std::ostringstream header;
+    header << std::setw(10) << DTensor<3, int>({1, 1, 1}, 7) << std::setw(3) << 5;
+    EXPECT_EQ(header.str(), "  DTensor<3>{\n|7|\n}  5");
+
+    std::ostringstream showpos;
+    showpos << std::showpos << std::setw(4) << DVector<1, int>{1, 2};
+    EXPECT_EQ(showpos.str(), "   |+1, +2|");
+}
+
+TEST_F(FormatTest, Formats) {
+    EXPECT_EQ(mdc::format(d2Array), "|0.5, 0.3333333333333333, -2|\n|1e-07, 4.25, 1e+20|");
+    EXPECT_EQ(mdc::format(d2Array, {.precision = 3}), "|0.5, 0.333, -2|\n|1e-07, 4.25, 1e+20|");
+    EXPECT_EQ(mdc::format(i3Vector, Format::csv()), "1,2,3\n4,5,6,7\n\n8,9\n10,11,12,13,14");
+    EXPECT_EQ(mdc::format(DVector<2, float>{{1.5f, 2}, {3}}, Format::tsv()), "1.5\t2\n3");
+    EXPECT_EQ(mdc::format(i3Vector, Format::json()), "[[[1,2,3],[4,5,6,7]],[[8,9],[10,11,12,13,14]]]");
+    EXPECT_EQ(mdc::format(DVector<1, double>{1.0, std::numeric_limits<double>::infinity(), NAN}, Format::json()),
+              "[1,null,null]");
+    EXPECT_EQ(mdc::format(DArray<char, 4>{'a', '"', '\\', '\n'}, Format::json()), R"(["a","\"","\\","\n"])");
+    EXPECT_EQ(mdc::format(DVector<1, std::string>{"x\ty", std::string(1, '\x01')}, Format::json()),
+              R"(["x\ty","\u0001"])");
+
+    auto fixed = Format::csv();
+    fixed.floating = std::chars_format::fixed;
+    fixed.precision = 1;
+    EXPECT_EQ(mdc::format(d2Array.at(1), fixed), "0.0,4.2,100000000000000000000.0");
+}
+
+TEST_F(FormatTest, ChunkedFlush) {
+    // larger than the buffer, which is written to the stream in chunks
+    DVector<2, long> large({300, 300}, [](std::size_t i, std::size_t j) { return static_cast<long>(i * 1000 + j); });
+    std::string expected;
+    for (std::size_t i = 0; i < 300; ++i) {
+        expected += i > 0 ? "\n|" : "|";
+        for (std::size_t j = 0; j < 300; ++j)
+            expected += (j > 0 ? ", " : "") + std::to_string(i * 1000 + j);
+        expected += '|';
+    }
+    ASSERT_GT(expected.size(), mdc::Formatter::flushSize);
+    EXPECT_EQ(streamed(large), expected);
+    EXPECT_EQ(mdc::format(large), expected);
+
+    std::ostringstream os;
+    {
+        mdc::Formatter formatter(os, Format::csv());
+        formatter << large.at(0) << large.at(1);
+        EXPECT_LT(os.str().size(), 10);
+    }
+    EXPECT_EQ(os.str().substr(0, 8), "0,1,2,3,");
+}
@@ -0,0 +1,133 @@
+/*
+ *   Copyright 2022 Alberto Guarnieri
+ *
+ *   Licensed under the Apache License, Version 2.0 (the "License");
+ *   you may not use this file except in compliance with the License.
+ *   You may obtain a copy of the License at
+ *
+ *       http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *   Unless required by applicable law or agreed to in writing, software
+ *   distributed under the License is distributed on an "AS IS" BASIS,
+ *   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *   See the License for the specific language governing permissions and
+ *   limitations under the License.
+ */
+
+
+#include <gtest/gtest.h>
+
+#include <numeric>
+#include <ranges>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include "DContainers/JaggedDVector.hpp"
+#include "DContainers/Span.hpp"
+
+using mdc::DVector, mdc::JaggedDVector, mdc::JaggedView, mdc::Span;
+
+class JaggedDVectorTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        i3Vector = {
+                {
+                        {1, 2, 3},
+                        {4, 5, 6, 7}
+                },
+                {
+                        {8, 9},
+                        {10, 11, 12, 13, 14}
+                },
+        };
+        i3Jagged = mdc::compact(i3Vector);
+    }
+
+    DVector<3, int> i3Vector;
+    JaggedDVector<3, int> i3Jagged;
+    JaggedDVector<2, std::string> s2Jagged = {{"a", "b", "c"}, {}, {"d"}};
+    JaggedDVector<1, float> f1Jagged = {-0.1f, 15.4f, -10.9f};
+};
+
+TEST_F(JaggedDVectorTest, CompactStorage) {
+    EXPECT_EQ(i3Jagged.total(), 14);
+    EXPECT_EQ(i3Jagged.size(), 2);
+    EXPECT_EQ(i3Jagged.values(), (std::vector<int>{1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14}));
+    EXPECT_EQ(i3Jagged.offsets(0), (std::vector<std::size_t>{0, 2, 4}));
+    EXPECT_EQ(i3Jagged.offsets(1), (std::vector<std::size_t>{0, 3, 7, 9, 14}));
+    EXPECT_THROW(i3Jagged.offsets(2), std::out_of_range);
+
+    EXPECT_EQ(s2Jagged.total(), 4);
+    EXPECT_EQ(s2Jagged.offsets(0), (std::vector<std::size_t>{0, 3, 3, 4}));
+    EXPECT_EQ(f1Jagged.size(), 3);
+    EXPECT_TRUE((JaggedDVector<3, int>().empty()));
+}
+
+TEST_F(JaggedDVectorTest, ElementsFetch) {
+    EXPECT_EQ(i3Jagged.at(0,0,0), 1);
+    EXPECT_EQ(i3Jagged.at(0,1,3), 7);
+    EXPECT_EQ(i3Jagged.at(1,0,1), 9);
+    EXPECT_EQ(i3Jagged.at(1,1,4), 14);
+    EXPECT_EQ(s2Jagged.at(2,0), "d");
+    EXPECT_FLOAT_EQ(f1Jagged.at(1), 15.4f);
+
+    EXPECT_THROW(i3Jagged.at(0,0,3), std::out_of_range);
+    EXPECT_THROW(i3Jagged.at(2,0,0), std::out_of_range);
+    EXPECT_THROW(s2Jagged.at(1,0), std::out_of_range);
+
+    i3Jagged.at(1,0,0) = -8;
+    EXPECT_EQ(i3Jagged.values().at(7), -8);
+    i3Jagged(1,1,0) = -10;
+    EXPECT_EQ(i3Jagged(1,1,0), -10);
+
+    JaggedView<1, int> row = i3Jagged.at(0,1);
+    EXPECT_EQ(row.size(), 4);
+    EXPECT_EQ(std::accumulate(row.begin(), row.end(), 0), 22);
+    EXPECT_EQ(i3Jagged.at(1).total(), 7);
+}
+
+TEST_F(JaggedDVectorTest, DVectorConversion) {
+    EXPECT_EQ((static_cast<DVector<3, int>>(i3Jagged)), i3Vector);
+    EXPECT_EQ((JaggedDVector<3, int>{{{1, 2, 3}, {4, 5, 6, 7}}, {{8, 9}, {10, 11, 12, 13, 14}}}), i3Jagged);
+
+    JaggedDVector<2, std::string> built;
+    built.push_back({"a", "b", "c"});
+    built.push_back({});
+    built.push_back({"d"});
+    EXPECT_EQ(built, s2Jagged);
+}
+
+TEST_F(JaggedDVectorTest, SpanMethods) {
+    auto spanned = i3Jagged.at(Span::all(), Span::of(1), Span::of(1, 3));
+    EXPECT_EQ((static_cast<DVector<3, int>>(spanned)), i3Vector.at(Span::all(), Span::of(1), Span::of(1, 3)));
+    EXPECT_EQ(spanned.total(), 6);
+
+    auto strided = i3Jagged.at(Span::all(), Span::all(), Span::of(0, 10, 2));
+    EXPECT_EQ((static_cast<DVector<3, int>>(strided)),
+              i3Vector.at(Span::all(), Span::all(), Span::of(0, 10, 2)));
+
+    EXPECT_EQ(s2Jagged.at(Span::of(1, 5), Span::all()), (JaggedDVector<2, std::string>{{}, {"d"}}));
+    EXPECT_TRUE(f1Jagged.at(Span::of(4)).empty());
+}
+
+TEST_F(JaggedDVectorTest, FlatElements) {
+    EXPECT_EQ(std::reduce(i3Jagged.flat_begin(), i3Jagged.flat_end()), 105);
+    EXPECT_EQ(i3Jagged.at(1).elements().size(), 7);
+    EXPECT_EQ(i3Jagged.at(1).elements().front(), 8);
+
+    int expected = 1;
+    for (auto plane: i3Jagged)
+        for (auto row: plane)
+            for (int element: row)
+                EXPECT_EQ(element, expected++);
+    static_assert(std::ranges::random_access_range<JaggedView<3, const int>>);
+}
+
+TEST_F(JaggedDVectorTest, JaggedPrinting) {
+    std::ostringstream jaggedStream, vectorStream;
+    jaggedStream << i3Jagged;
+    vectorStream << i3Vector;
+    EXPECT_EQ(jaggedStream.str(), "JaggedDVector<3>{\n|1, 2, 3|\n|4, 5, 6, 7|,\n\n|8, 9|\n|10, 11, 12, 13, 14|\n}");
+    EXPECT_EQ(vectorStream.str(), "DVector<3>{\n|1, 2, 3|\n|4, 5, 6, 7|,\n\n|8, 9|\n|10, 11, 12, 13, 14|\n}");
+}
@@ -0,0 +1,153 @@
+/*
+ *   Copyright 2022 Alberto Guarnieri
+ *
+ *   Licensed under the Apache License, Version 2.0 (the "License");
+ *   you may not use this file except in compliance with the License.
+ *   You may obtain a copy of the License at
+ *
+ *       http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *   Unless required by applicable law or agreed to in writing, software
+ *   distributed under the License is distributed on an "AS IS" BASIS,
+ *   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *   See the License for the specific language governing permissions and
+ *   limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <sstream>
+#include <stdexcept>
+#include <vector>
+#include "DContainers/Layout.hpp"
+
+using mdc::DArray, mdc::DGrid, mdc::Layout;
+
+namespace {
+
+    // Every valid index must have its own offset, inside the storage
+    template<typename L, std::size_t... E>
+    bool isBijective() {
+        using Mapping = typename L::template Mapping<E...>;
+        std::vector<bool> used(Mapping::size, false);
+        bool valid = true;
+        auto visit = [&](auto... indices) {
+            const auto offset = Mapping::offset({indices...});
+            valid = valid && offset < Mapping::size && !used[offset];
+            if (offset < Mapping::size)
+                used[offset] = true;
+        };
+        mdc::detail::forEachIndex<sizeof...(E)>(std::array<std::size_t, sizeof...(E)>{E...}, visit);
+        return valid;
+    }
+
+}
+
+class LayoutTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        for (std::size_t i = 0; i < 3; ++i)
+            for (std::size_t j = 0; j < 5; ++j)
+                for (std::size_t k = 0; k < 6; ++k)
+                    i3Array.at(i, j, k) = static_cast<int>(i * 100 + j * 10 + k);
+    }
+
+    DArray<int, 3, 5, 6> i3Array;
+};
+
+TEST_F(LayoutTest, MappingOffsets) {
+    using Column = Layout::ColumnMajor::Mapping<4, 3>;
+    EXPECT_EQ(Column::size, 12);
+    EXPECT_EQ(Column::offset({1, 0}), 1);
+    EXPECT_EQ(Column::offset({0, 1}), 4);
+
+    using Tile = Layout::Tiled<2>::Mapping<4, 4>;
+    EXPECT_EQ(Tile::size, 16);
+    EXPECT_EQ(Tile::offset({1, 1}), 3);
+    EXPECT_EQ(Tile::offset({0, 2}), 4);
+    EXPECT_EQ(Tile::offset({2, 0}), 8);
+
+    using Padded = Layout::Tiled<4, 2>::Mapping<5, 3>;
+    EXPECT_EQ(Padded::size, 32);
+
+    using Z = Layout::Morton::Mapping<4, 4>;
+    EXPECT_EQ(Z::size, 16);
+    EXPECT_EQ(Z::offset({0, 1}), 1);
+    EXPECT_EQ(Z::offset({1, 0}), 2);
+    EXPECT_EQ(Z::offset({1, 1}), 3);
+    EXPECT_EQ(Z::offset({2, 0}), 8);
+    EXPECT_EQ(Z::offset({3, 3}), 15);
+
+    // dimensions with fewer bits stop contributing to the interleaving
+    using Wide = Layout::Morton::Mapping<2, 8>;
+    EXPECT_EQ(Wide::size, 16);
+    EXPECT_EQ(Wide::offset({1, 0}), 2);
+    EXPECT_EQ(Wide::offset({0, 2}), 4);
+    EXPECT_EQ(Wide::offset({1, 7}), 15);
+}
+
+TEST_F(LayoutTest, MappingsAreBijective) {
+    EXPECT_TRUE((isBijective<Layout::RowMajor, 3, 5, 6>()));
+    EXPECT_TRUE((isBijective<Layout::ColumnMajor, 3, 5, 6>()));
+    EXPECT_TRUE((isBijective<Layout::Tiled<2, 4, 4>, 3, 5, 6>()));
+    EXPECT_TRUE((isBijective<Layout::Tiled<8>, 17, 9>()));
+    EXPECT_TRUE((isBijective<Layout::Morton, 3, 5, 6>()));
+    EXPECT_TRUE((isBijective<Layout::Morton, 1, 33>()));
+}
+
+TEST_F(LayoutTest, GridAccess) {
+    DGrid<int, Layout::Morton, 3, 5, 6> grid(i3Array);
+    EXPECT_EQ(grid.at(2, 4, 5), 245);
+    EXPECT_EQ(grid(1, 3, 0), 130);
+    EXPECT_THROW(grid.at(3, 0, 0), std::out_of_range);
+    EXPECT_THROW(grid.at(0, 0, 6), std::out_of_range);
+
+    grid.at(0, 1, 2) = -1;
+    EXPECT_EQ(grid(0, 1, 2), -1);
+    EXPECT_EQ(grid.total(), 90);
+    EXPECT_EQ(grid.size(), 3);
+    EXPECT_EQ(grid.extent(2), 6);
+    EXPECT_EQ(grid.storage().size(), 256);
+}
+
+TEST_F(LayoutTest, ConversionRoundTrip) {
+    DGrid<int, Layout::ColumnMajor, 3, 5, 6> column(i3Array);
+    DGrid<int, Layout::Tiled<2, 2, 4>, 3, 5, 6> tiled(i3Array);
+    EXPECT_EQ((static_cast<DArray<int, 3, 5, 6>>(column)), i3Array);
+    EXPECT_EQ((static_cast<DArray<int, 3, 5, 6>>(tiled)), i3Array);
+
+    // column-major storage holds the first dimension contiguously
+    EXPECT_EQ(column.data()[0], 0);
+    EXPECT_EQ(column.data()[1], 100);
+    EXPECT_EQ(column.data()[3], 10);
+
+    DGrid<int, Layout::Tiled<2, 2, 4>, 3, 5, 6> generated([](std::size_t i, std::size_t j, std::size_t k) {
+        return static_cast<int>(i * 100 + j * 10 + k);
+    });
+    EXPECT_EQ(generated, tiled);
+    generated.at(2, 4, 5) = 0;
+    EXPECT_NE(generated, tiled);
+}
+
+TEST_F(LayoutTest, GridPrinting) {
+    DGrid<int, Layout::Morton, 3, 5, 6> grid(i3Array);
+    std::stringstream expected, printed;
+    expected << i3Array;
+    printed << grid;
+    EXPECT_EQ(printed.str().substr(5), expected.str().substr(6));
+    EXPECT_EQ(printed.str().substr(0, 5), "DGrid");
+
+    DGrid<double, Layout::ColumnMajor, 2, 2> matrix(0.5);
+    printed.str("");
+    printed << matrix;
+    EXPECT_EQ(printed.str(), "|0.5, 0.5|\n|0.5, 0.5|");
+}
+
+TEST_F(LayoutTest, ConstantExpressions) {
+    constexpr DGrid<int, Layout::Tiled<2>, 4, 4> grid([](std::size_t i, std::size_t j) {
+        return static_cast<int>(i * 4 + j);
+    });
+    static_assert(grid.at(3, 2) == 14);
+    static_assert(grid.data()[4] == 2);
+}
@@ -0,0 +1,141 @@
+/*
+ *   Copyright 2022 Alberto Guarnieri
+ *
+ *   Licensed under the Apache License, Version 2.0 (the "License");
+ *   you may not use this file except in compliance with the License.
+ *   You may obtain a copy of the License at
+ *
+ *       http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *   Unless required by applicable law or agreed to in writing, software
+ *   distributed under the License is distributed on an "AS IS" BASIS,
+ *   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *   See the License for the specific language governing permissions and
+ *   limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include "DContainers/Mapped.hpp"
+#include "DContainers/Span.hpp"
+
+#ifdef DCONTAINERS_MMAP
+
+#include <filesystem>
+#include <cstdint>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <vector>
+
+using mdc::DArray, mdc::DTensor, mdc::DVector, mdc::JaggedDVector, mdc::Span;
+using mdc::MappedDArray, mdc::MappedDVector;
+
+class MappedTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        i3Vector = {
+                {
+                        {1, 2, 3},
+                        {4, 5, 6, 7}
+                },
+                {},
+                {
+                        {},
+                        {8, 9},
+                        {10, 11, 12, 13, 14}
+                },
+        };
+
+        d2Array = {
+                {0.5, 1.5, 2.5},
+                {3.5, 4.5, 5.5}
+        };
+
+        path = std::filesystem::temp_directory_path() /
+               ("DContainers_" + std::string(::testing::UnitTest::GetInstance()->current_test_info()->name()));
+    }
+
+    void TearDown() override {
+        std::filesystem::remove(path);
+    }
+
+    template<typename C>
+    void store(const C &container) const {
+        std::ofstream os(path, std::ios::binary);
+        mdc::io::write(os, container);
+    }
+
+    DVector<3, int> i3Vector;
+    DArray<double, 2, 3> d2Array;
+    std::filesystem::path path;
+};
+
+TEST_F(MappedTest, DArrayReadOnly) {
+    store(d2Array);
+    const MappedDArray<const double, 2, 3> mapped(path);
+    EXPECT_EQ(*mapped, d2Array);
+    EXPECT_EQ(mapped.at(1, 2), 5.5);
+    EXPECT_EQ(mapped(0, 1), 1.5);
+    EXPECT_EQ(mapped.total(), 6);
+    EXPECT_EQ((mapped.at(Span::all(), Span::of<1>())), (DArray<double, 2, 1>{{1.5}, {4.5}}));
+    EXPECT_EQ(mapped.view(Span::of(1, 1), Span::all()).at(0, 0), 3.5);
+    EXPECT_EQ(reinterpret_cast<std::uintptr_t>(mapped.flat_begin()) % mdc::io::payloadAlignment, 0);
+}
+
+TEST_F(MappedTest, DArrayReadWrite) {
+    store(d2Array);
+    {
+        MappedDArray<double, 2, 3> mapped(path);
+        mapped.at(0, 0) = -1.0;
+        mapped->at(1).at(2) = 42.0;
+        mapped.sync();
+    }
+    std::ifstream is(path, std::ios::binary);
+    const auto stored = mdc::io::read<DArray<double, 2, 3>>(is);
+    EXPECT_EQ(stored.at(0, 0), -1.0);
+    EXPECT_EQ(stored.at(1, 2), 42.0);
+    EXPECT_EQ(stored.at(0, 1), 1.5);
+}
+
+TEST_F(MappedTest, DVector) {
+    store(i3Vector);
+    const MappedDVector<3, const int> mapped(path);
+    EXPECT_EQ(mapped.size(), 3);
+    EXPECT_EQ(mapped.total(), 14);
+    EXPECT_EQ(mapped.at(0, 1, 3), 7);
+    EXPECT_EQ(mapped(2, 2, 4), 14);
+    EXPECT_EQ(mapped.at(2).size(), 3);
+    EXPECT_TRUE(mapped.at(1).empty());
+    EXPECT_THROW(mapped.at(2, 0, 0), std::out_of_range);
+    EXPECT_EQ(mapped.view().materialize(), i3Vector);
+    EXPECT_EQ((mapped.at(Span::all(), Span::of(1, 2), Span::of(0, 1))),
+              (mdc::compact(i3Vector).at(Span::all(), Span::of(1, 2), Span::of(0, 1))));
+
+    std::vector<int> elements(mapped.flat_begin(), mapped.flat_end());
+    EXPECT_EQ(elements, mdc::compact(i3Vector).values());
+
+    // dense containers can be mapped as well
+    store(DTensor<2, short>({3, 4}, 5));
+    MappedDVector<2, short> dense(path);
+    dense.at(2, 3) = 6;
+    EXPECT_EQ(dense.size(), 3);
+    EXPECT_EQ(dense.at(1).size(), 4);
+    EXPECT_EQ(dense.elements().back(), 6);
+}
+
+TEST_F(MappedTest, Mismatch) {
+    EXPECT_THROW((MappedDArray<const double, 2, 3>(path)), std::system_error);
+    store(d2Array);
+    EXPECT_THROW((MappedDArray<const double, 3, 2>(path)), std::runtime_error);
+    EXPECT_THROW((MappedDArray<const float, 2, 3>(path)), std::runtime_error);
+    EXPECT_THROW((MappedDVector<3, const double>(path)), std::runtime_error);
+
+    store(i3Vector);
+    EXPECT_THROW((MappedDArray<const int, 3, 5>(path)), std::runtime_error);
+    std::filesystem::resize_file(path, std::filesystem::file_size(path) - 1);
+    EXPECT_THROW((MappedDVector<3, const int>(path)), std::runtime_error);
+}
+
+#endif
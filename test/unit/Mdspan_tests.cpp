@@ -0,0 +1,100 @@
+/*
+ *   Copyright 2022 Alberto Guarnieri
+ *
+ *   Licensed under the Apache License, Version 2.0 (the "License");
+ *   you may not use this file except in compliance with the License.
+ *   You may obtain a copy of the License at
+ *
+ *       http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *   Unless required by applicable law or agreed to in writing, software
+ *   distributed under the License is distributed on an "AS IS" BASIS,
+ *   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *   See the License for the specific language governing permissions and
+ *   limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <numeric>
+#include <type_traits>
+#include "DContainers/Mdspan.hpp"
+#include "DContainers/Span.hpp"
+
+#if defined(DCONTAINERS_MDSPAN)
+
+using mdc::DArray, mdc::DTensor, mdc::DView, mdc::DGrid, mdc::Layout, mdc::Span;
+
+class MdspanTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        std::iota(i3Array.flat_begin(), i3Array.flat_end(), 0);
+        std::iota(buffer.begin(), buffer.end(), 0.0);
+    }
+
+    DArray<int, 2, 3, 4> i3Array;
+    std::array<double, 12> buffer;
+};
+
+TEST_F(MdspanTest, ArrayToMdspan) {
+    auto span = mdc::to_mdspan(i3Array);
+    static_assert(decltype(span)::extents_type::static_extent(2) == 4);
+    EXPECT_EQ(span.data_handle(), i3Array.flat_begin());
+    EXPECT_EQ((span[std::array<std::size_t, 3>{1, 2, 3}]), i3Array.at(1, 2, 3));
+
+    span[std::array<std::size_t, 3>{0, 1, 2}] = -1;
+    EXPECT_EQ(i3Array.at(0, 1, 2), -1);
+
+    const auto &constArray = i3Array;
+    auto constSpan = mdc::to_mdspan(constArray);
+    static_assert(std::is_same_v<decltype(constSpan.data_handle()), const int *>);
+}
+
+TEST_F(MdspanTest, TensorAndViewToMdspan) {
+    DTensor<2, int> dTensor{{1, 2, 3}, {4, 5, 6}};
+    auto span = mdc::to_mdspan(dTensor);
+    EXPECT_EQ(span.extent(0), 2);
+    EXPECT_EQ((span[std::array<std::size_t, 2>{1, 0}]), 4);
+
+    auto transposed = mdc::to_mdspan(dTensor.transpose());
+    EXPECT_EQ(transposed.extent(0), 3);
+    EXPECT_EQ(transposed.stride(0), 1);
+    EXPECT_EQ((transposed[std::array<std::size_t, 2>{2, 1}]), 6);
+
+    DGrid<int, Layout::ColumnMajor, 2, 3> grid(static_cast<const DArray<int, 2, 3> &>(DArray<int, 2, 3>{
+            {1, 2, 3}, {4, 5, 6}}));
+    auto columns = mdc::to_mdspan(grid);
+    EXPECT_EQ(columns.stride(1), 2);
+    EXPECT_EQ((columns[std::array<std::size_t, 2>{1, 2}]), 6);
+}
+
+TEST_F(MdspanTest, MdspanToView) {
+    using Extents = mdc::detail::md::dextents<std::size_t, 2>;
+    mdc::detail::md::mdspan<double, Extents> span(buffer.data(), std::array<std::size_t, 2>{3, 4});
+    DView<2, double> view = mdc::from_mdspan(span);
+    EXPECT_EQ(view.shape(), (DView<2, double>::shape_type{3, 4}));
+    EXPECT_EQ(view.at(2, 1), 9.0);
+
+    auto column = view.at(Span::all(), Span::of(1));
+    EXPECT_EQ(column.at(2, 0), 9.0);
+    column.at(0, 0) = -1.0;
+    EXPECT_EQ(buffer[1], -1.0);
+
+    mdc::detail::md::mdspan<double, Extents, mdc::detail::md::layout_left> left(
+            buffer.data(), std::array<std::size_t, 2>{3, 4});
+    EXPECT_EQ(mdc::from_mdspan(left).at(1, 2), 7.0);
+}
+
+TEST_F(MdspanTest, MdspanAsDArray) {
+    mdc::detail::md::mdspan<double, mdc::detail::md::extents<std::size_t, 3, 4>> span(buffer.data());
+    DArray<double, 3, 4> &dArray = mdc::as_darray(span);
+    EXPECT_EQ(&dArray.at(0, 0), buffer.data());
+    EXPECT_EQ(dArray.at(2, 3), 11.0);
+    EXPECT_EQ(dArray.at(Span::of<1>(), Span::of<2, 3>()).at(0, 1), 7.0);
+
+    dArray.at(1, 1) = 0.5;
+    EXPECT_EQ(buffer[5], 0.5);
+}
+
+#endif
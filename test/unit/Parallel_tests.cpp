@@ -0,0 +1,119 @@
+/*
+ *   Copyright 2022 Alberto Guarnieri
+ *
+ *   Licensed under the Apache License, Version 2.0 (the "License");
+ *   you may not use this file except in compliance with the License.
+ *   You may obtain a copy of the License at
+ *
+ *       http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *   Unless required by applicable law or agreed to in writing, software
+ *   distributed under the License is distributed on an "AS IS" BASIS,
+ *   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *   See the License for the specific language governing permissions and
+ *   limitations under the License.
+ */
+
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <numeric>
+#include <stdexcept>
+#include <thread>
+#include "DContainers/Parallel.hpp"
+
+using mdc::DArray, mdc::DVector;
+using mdc::parallel::ThreadPool;
+
+class ParallelTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        // A single huge row among many small ones, which static chunking of the outer dimension cannot balance
+        for (std::size_t i = 0; i < 500; ++i)
+            jagged.emplace_back(i % 7, 1);
+        jagged.at(123) = DVector<1, int>(100000, 1);
+        jagged.emplace_back();
+    }
+
+    ThreadPool pool{3};
+    DVector<2, int> jagged;
+};
+
+TEST_F(ParallelTest, PoolRun) {
+    std::vector<std::atomic<int>> counters(100);
+    pool.run(counters.size(), [&](std::size_t i) { counters[i] += static_cast<int>(i); });
+    for (std::size_t i = 0; i < counters.size(); ++i)
+        EXPECT_EQ(counters[i], static_cast<int>(i));
+
+    std::atomic<int> nested = 0;
+    pool.run(8, [&](std::size_t) { pool.run(8, [&](std::size_t) { ++nested; }); });
+    EXPECT_EQ(nested, 64);
+
+    EXPECT_THROW(pool.run(16, [](std::size_t i) { if (i == 5) throw std::runtime_error("task"); }),
+                 std::runtime_error);
+}
+
+TEST_F(ParallelTest, BalancedPartition) {
+    const auto partition = mdc::parallel::detail::partitionOf(jagged, 16);
+    EXPECT_GT(partition.tasks(), 8);
+    EXPECT_LE(partition.tasks(), 17);
+    // The huge row is split among several tasks
+    std::size_t cutsInsideRow = 0;
+    for (const auto &cut: partition.cuts)
+        if (cut[0] == 123)
+            ++cutsInsideRow;
+    EXPECT_GT(cutsInsideRow, 4);
+}
+
+TEST_F(ParallelTest, ForEach) {
+    const auto total = jagged.total();
+    mdc::parallel::for_each(jagged, [](int &element) { element *= 2; }, pool);
+    EXPECT_EQ(mdc::parallel::reduce(jagged, std::size_t{0}, std::plus<>(), pool), 2 * total);
+    EXPECT_EQ(jagged.at(123, 99999), 2);
+    EXPECT_EQ(jagged.at(6, 5), 2);
+
+    auto dArray = std::make_unique<DArray<int, 64, 32, 16>>();
+    mdc::parallel::for_each_indexed(*dArray, [](const std::array<std::size_t, 3> &index, int &element) {
+        element = static_cast<int>(index[0] * 10000 + index[1] * 100 + index[2]);
+    }, pool);
+    EXPECT_EQ(dArray->at(0,0,0), 0);
+    EXPECT_EQ(dArray->at(63,31,15), 633115);
+    EXPECT_EQ(dArray->at(17,3,9), 170309);
+}
+
+TEST_F(ParallelTest, IndexedJagged) {
+    mdc::parallel::for_each_indexed(jagged, [](const std::array<std::size_t, 2> &index, int &element) {
+        element = static_cast<int>(index[0] + index[1]);
+    }, pool);
+    EXPECT_EQ(jagged.at(123, 54321), 123 + 54321);
+    EXPECT_EQ(jagged.at(499, 1), 500);
+}
+
+TEST_F(ParallelTest, TransformReduce) {
+    DVector<2, double> halves = mdc::parallel::transform(jagged, [](int element) { return element / 2.0; }, pool);
+    EXPECT_EQ(halves.size(), jagged.size());
+    EXPECT_EQ(halves.at(123).size(), 100000);
+    EXPECT_EQ(halves.total(), jagged.total());
+    EXPECT_EQ(halves.at(123, 500), 0.5);
+
+    DArray<int, 100, 100> dArray;
+    std::iota(dArray.flat_begin(), dArray.flat_end(), 0);
+    EXPECT_EQ(mdc::parallel::reduce(dArray, 0L, std::plus<>(), pool), 10000L * 9999 / 2);
+    EXPECT_EQ(mdc::parallel::reduce(dArray, 0, [](int a, int b) { return std::max(a, b); }, pool), 9999);
+    auto squares = mdc::parallel::transform(dArray, [](int element) { return static_cast<long>(element) * element; });
+    EXPECT_EQ(squares.at(99, 99), 9999L * 9999);
+
+    EXPECT_EQ(mdc::parallel::reduce(DVector<3, int>(), 7, std::plus<>(), pool), 7);
+}
+
+TEST_F(ParallelTest, Generate) {
+    auto cube = mdc::parallel::generate<long, 3>({40, 30, 20}, [](std::size_t i, std::size_t j, std::size_t k) {
+        return static_cast<long>(i * 600 + j * 20 + k);
+    }, pool);
+    EXPECT_EQ(cube.shape(), (DVector<3, long>::shape_type{40, 30, 20}));
+    EXPECT_EQ(cube.at(39,29,19), 23999);
+    EXPECT_EQ(cube, (DVector<3, long>({40, 30, 20}, [](std::size_t i, std::size_t j, std::size_t k) {
+        return static_cast<long>(i * 600 + j * 20 + k);
+    })));
+}
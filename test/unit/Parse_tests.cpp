@@ -0,0 +1,119 @@
+/*
+ *   Copyright 2022 Alberto Guarnieri
+ *
+ *   Licensed under the Apache License, Version 2.0 (the "License");
+ *   you may not use this file except in compliance with the License.
+ *   You may obtain a copy of the License at
+ *
+ *       http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *   Unless required by applicable law or agreed to in writing, software
+ *   distributed under the License is distributed on an "AS IS" BASIS,
+ *   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *   See the License for the specific language governing permissions and
+ *   limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <sstream>
+#include <string>
+#include "DContainers/Parse.hpp"
+
+using mdc::DArray, mdc::DVector;
+namespace io = mdc::io;
+
+class ParseTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        d2Vector = {
+                {0.5, -1.25, 3},
+                {},
+                {1e-7, 0.1},
+                {42}
+        };
+    }
+
+    template<typename F>
+    static void expectError(F &&parse, std::size_t line, std::size_t field) {
+        try {
+            parse();
+            FAIL() << "expected io::ParseError";
+        } catch (const io::ParseError &error) {
+            EXPECT_EQ(error.line(), line) << error.what();
+            EXPECT_EQ(error.field(), field) << error.what();
+        }
+    }
+
+    DVector<2, double> d2Vector;
+};
+
+TEST_F(ParseTest, RaggedRows) {
+    const std::string text = "0.5, -1.25, +3\r\n\n1e-7,0.1\n42";
+    EXPECT_EQ(io::parse<double>(text), (DVector<2, double>{{0.5, -1.25, 3}, {1e-7, 0.1}, {42}}));
+
+    io::ParseOptions keepEmpty;
+    keepEmpty.skipEmptyLines = false;
+    std::istringstream is(text);
+    EXPECT_EQ(io::parse<double>(is, keepEmpty), d2Vector);
+
+    // shortest representations written by Format::csv() are read back exactly
+    const auto csv = mdc::format(d2Vector, mdc::Format::csv());
+    EXPECT_EQ(io::parse<double>(csv, keepEmpty), d2Vector);
+}
+
+TEST_F(ParseTest, Options) {
+    auto tsv = io::ParseOptions::tsv();
+    tsv.skipRows = 1;
+    tsv.comment = '#';
+    EXPECT_EQ(io::parse<std::int64_t>("a\tb\n# comment\n1\t-2\n3\t4\n", tsv),
+              (DVector<2, std::int64_t>{{1, -2}, {3, 4}}));
+
+    // chunks smaller than a line are grown
+    io::ParseOptions tiny;
+    tiny.chunkSize = 3;
+    std::istringstream is("10,20,30,40\n5\n60,70\n");
+    EXPECT_EQ(io::parse<int>(is, tiny), (DVector<2, int>{{10, 20, 30, 40}, {5}, {60, 70}}));
+}
+
+TEST_F(ParseTest, FixedShape) {
+    DArray<float, 2, 3> array;
+    std::istringstream is("1,2,3\n4,5,6\n");
+    io::parse(is, array);
+    EXPECT_EQ(array, (DArray<float, 2, 3>{{1.f, 2.f, 3.f}, {4.f, 5.f, 6.f}}));
+
+    expectError([&] { io::parse("1,2,3\n4,5\n", array); }, 2, 0);
+    expectError([&] { io::parse("1,2,3\n4,5,6,7\n", array); }, 2, 4);
+    expectError([&] { io::parse("1,2,3\n", array); }, 1, 0);
+    expectError([&] { io::parse("1,2,3\n4,5,6\n7,8,9", array); }, 3, 0);
+}
+
+TEST_F(ParseTest, Errors) {
+    expectError([] { io::parse<int>("1,2\n3,x\n"); }, 2, 2);
+    expectError([] { io::parse<int>("1,2,\n"); }, 1, 3);
+    expectError([] { io::parse<int>("1,,2\n"); }, 1, 2);
+    expectError([] { io::parse<int>("1.5\n"); }, 1, 1);
+    expectError([] { io::parse<std::uint8_t>("255\n256\n"); }, 2, 1);
+    EXPECT_THROW(io::parse<int>("1 2"), std::runtime_error);
+}
+
+TEST_F(ParseTest, ParallelChunks) {
+    DVector<2, double> large({4000, 25}, [](std::size_t i, std::size_t j) { return i * 0.001 - j * 7.5; });
+    large[17].resize(3);
+    large[2500].clear();
+    io::ParseOptions keepEmpty;
+    keepEmpty.skipEmptyLines = false;
+    keepEmpty.skipRows = 1;
+    const auto text = "header\n" + mdc::format(large, mdc::Format::csv());
+    ASSERT_GT(text.size(), 4 * mdc::parallel::detail::minParseChunk);
+
+    mdc::parallel::ThreadPool pool(3);
+    EXPECT_EQ(mdc::parallel::parse<double>(text, keepEmpty, pool), large);
+    EXPECT_EQ(io::parse<double>(text, keepEmpty), large);
+
+    // lines are counted from the beginning of the text, whichever chunk fails
+    auto broken = text;
+    broken[broken.rfind('\n') - 1] = 'z';
+    expectError([&] { mdc::parallel::parse<double>(broken, keepEmpty, pool); }, 4000, 25);
+}
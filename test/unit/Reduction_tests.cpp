@@ -0,0 +1,172 @@
+/*
+ *   Copyright 2022 Alberto Guarnieri
+ *
+ *   Licensed under the Apache License, Version 2.0 (the "License");
+ *   you may not use this file except in compliance with the License.
+ *   You may obtain a copy of the License at
+ *
+ *       http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *   Unless required by applicable law or agreed to in writing, software
+ *   distributed under the License is distributed on an "AS IS" BASIS,
+ *   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *   See the License for the specific language governing permissions and
+ *   limitations under the License.
+ */
+
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <numeric>
+#include <stdexcept>
+#include <vector>
+#include "DContainers/Reduction.hpp"
+#include "DContainers/Span.hpp"
+
+using mdc::DArray, mdc::DTensor, mdc::DVector, mdc::JaggedDVector, mdc::Span;
+namespace simd = mdc::simd;
+
+class ReductionTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        i3Vector = {
+                {
+                        {1, 2, 3},
+                        {4, 5, 6, 7}
+                },
+                {
+                        {},
+                        {10, 11, 14, 13, 12}
+                },
+        };
+
+        d2Array = {
+                {0.5, -1.5, 2.5},
+                {3.5, 4.5, -5.5}
+        };
+
+        for (std::size_t i = 0; i < values.size(); ++i)
+            values[i] = static_cast<double>((i * 37) % 1013) - 500.0;
+    }
+
+    DVector<3, int> i3Vector;
+    DArray<double, 2, 3> d2Array;
+    std::vector<double> values = std::vector<double>(5000);
+};
+
+TEST_F(ReductionTest, KernelsForEachIsa) {
+    const auto expectedSum = std::accumulate(values.begin(), values.end(), 0.0);
+    const auto expectedDot = std::inner_product(values.begin(), values.end(), values.begin(), 0.0);
+    const auto expectedMax = std::max_element(values.begin(), values.end());
+    std::vector<std::int32_t> integers(values.begin(), values.end());
+
+    for (auto isa: {simd::Isa::Scalar, simd::Isa::SSE2, simd::Isa::AVX2, simd::Isa::AVX512}) {
+        for (std::size_t count: {std::size_t{1}, std::size_t{7}, std::size_t{63}, values.size()}) {
+            EXPECT_DOUBLE_EQ(simd::sum(values.data(), count, isa),
+                             std::accumulate(values.begin(), values.begin() + count, 0.0));
+            EXPECT_EQ(simd::min(integers.data(), count, isa),
+                      *std::min_element(integers.begin(), integers.begin() + count));
+        }
+        EXPECT_DOUBLE_EQ(simd::sum(values.data(), values.size(), isa), expectedSum);
+        EXPECT_DOUBLE_EQ(simd::dot(values.data(), values.data(), values.size(), isa), expectedDot);
+        EXPECT_EQ(simd::max(values.data(), values.size(), isa), *expectedMax);
+        EXPECT_EQ(simd::argmax(values.data(), values.size(), isa).first, expectedMax - values.begin());
+        EXPECT_EQ(simd::sum(integers.data(), integers.size(), isa),
+                  std::accumulate(integers.begin(), integers.end(), std::int32_t{0}));
+    }
+    EXPECT_EQ(simd::sum(values.data(), 0), 0.0);
+}
+
+TEST_F(ReductionTest, ContainerReductions) {
+    EXPECT_EQ(mdc::sum(i3Vector), 88);
+    EXPECT_EQ(mdc::min(i3Vector), 1);
+    EXPECT_EQ(mdc::max(i3Vector), 14);
+    EXPECT_EQ(mdc::argmax(i3Vector), 9);
+
+    EXPECT_DOUBLE_EQ(mdc::sum(d2Array), 4.0);
+    EXPECT_EQ(mdc::min(d2Array), -5.5);
+    EXPECT_EQ(mdc::argmax(d2Array), 4);
+    EXPECT_DOUBLE_EQ(mdc::norm2(d2Array), std::sqrt(mdc::dot(d2Array, d2Array)));
+
+    DTensor<2, double> tensor;
+    EXPECT_EQ(tensor.total(), 0);
+    EXPECT_EQ(mdc::sum(tensor), 0.0);
+    EXPECT_THROW(mdc::max(tensor), std::invalid_argument);
+    EXPECT_THROW(mdc::argmax(DVector<2, int>(3, 0)), std::invalid_argument);
+
+    auto jagged = mdc::compact(i3Vector);
+    EXPECT_EQ(mdc::sum(jagged), 88);
+    EXPECT_EQ(mdc::sum(jagged.at(1)), 60);
+}
+
+TEST_F(ReductionTest, ViewReductions) {
+    auto column = d2Array.view(Span::all(), Span::of(1));
+    EXPECT_DOUBLE_EQ(mdc::sum(column), 3.0);
+    EXPECT_EQ(mdc::argmax(column), 1);
+
+    auto strided = i3Vector.view(Span::all(), Span::of(1), Span::of(0, 4, 2));
+    EXPECT_EQ(mdc::sum(strided), 4 + 6 + 10 + 14 + 12);
+    EXPECT_EQ(mdc::max(strided), 14);
+    EXPECT_EQ(mdc::min(i3Vector.view(Span::of(1), Span::all(), Span::all())), 10);
+
+    DTensor<3, int> large({4, 50, 60}, 1);
+    large.at(3, 49, 59) = 2;
+    EXPECT_EQ(mdc::sum(large.view(Span::of(1, 3), Span::of(0, 40), Span::of(10, 59))), 3 * 41 * 50);
+    EXPECT_EQ(mdc::argmax(large), large.total() - 1);
+}
+
+TEST_F(ReductionTest, DotProduct) {
+    DVector<2, double> d2Vector = {
+            {1.0, 2.0, 3.0},
+            {4.0, 5.0, 6.0}
+    };
+    EXPECT_DOUBLE_EQ(mdc::dot(d2Array, d2Vector), 0.5 - 3.0 + 7.5 + 14.0 + 22.5 - 33.0);
+    EXPECT_DOUBLE_EQ(mdc::dot(d2Vector, DTensor<2, double>(d2Vector)), 91.0);
+    EXPECT_DOUBLE_EQ(mdc::dot(d2Array.view(Span::all(), Span::of(0)), d2Vector.view(Span::all(), Span::of(2))),
+                     0.5 * 3.0 + 3.5 * 6.0);
+
+    d2Vector.at(1).push_back(7.0);
+    EXPECT_THROW(mdc::dot(d2Array, d2Vector), std::invalid_argument);
+
+    // same number of elements, laid out in a different shape
+    EXPECT_THROW(mdc::dot(DArray<int, 2, 6>{}, DTensor<2, int>({3, 4}, 1)), std::invalid_argument);
+    EXPECT_THROW(mdc::dot(DTensor<2, int>({4, 3}, 1), DTensor<2, int>({3, 4}, 1)), std::invalid_argument);
+    EXPECT_THROW(mdc::dot(mdc::compact(DVector<2, int>{{1, 2}, {3}}), mdc::compact(DVector<2, int>{{1}, {2, 3}})),
+                 std::invalid_argument);
+    EXPECT_EQ(mdc::dot(DArray<int, 3, 4>{}, DTensor<2, int>({3, 4}, 1)), 0);
+}
+
+TEST_F(ReductionTest, NaNs) {
+    const double nan = std::numeric_limits<double>::quiet_NaN();
+    for (auto isa: {simd::Isa::Scalar, simd::Isa::SSE2, simd::Isa::AVX2, simd::Isa::AVX512}) {
+        std::vector<double> leading{nan, nan, 1.0};
+        EXPECT_EQ(simd::argmax(leading.data(), leading.size(), isa).first, 0);
+
+        // the first NaN wins, wherever it lies among vector lanes and blocks
+        for (std::size_t position: {std::size_t{0}, std::size_t{5}, std::size_t{39}, std::size_t{2500}}) {
+            auto copy = values;
+            copy[position] = nan;
+            copy[position + 7] = nan;
+            EXPECT_EQ(simd::argmax(copy.data(), position < 40 ? 40 : copy.size(), isa).first, position);
+            EXPECT_TRUE(std::isnan(simd::max(copy.data(), copy.size(), isa)));
+            EXPECT_TRUE(std::isnan(simd::min(copy.data(), copy.size(), isa)));
+        }
+    }
+
+    DTensor<2, double> tensor({3, 4}, 1.0);
+    tensor.at(2, 0) = 2.0;
+    tensor.at(1, 2) = nan;
+    tensor.at(2, 3) = nan;
+    EXPECT_EQ(mdc::argmax(tensor), 6);
+    EXPECT_EQ(mdc::argmax(tensor.transpose()), 7);
+    EXPECT_TRUE(std::isnan(mdc::max(tensor.transpose())));
+    EXPECT_TRUE(std::isnan(mdc::min(tensor)));
+
+    DVector<2, double> rows{{1.0, 2.0}, {nan, 3.0}, {nan}};
+    EXPECT_EQ(mdc::argmax(rows), 2);
+    EXPECT_TRUE(std::isnan(mdc::max(rows)));
+}
@@ -0,0 +1,195 @@
+/*
+ *   Copyright 2022 Alberto Guarnieri
+ *
+ *   Licensed under the Apache License, Version 2.0 (the "License");
+ *   you may not use this file except in compliance with the License.
+ *   You may obtain a copy of the License at
+ *
+ *       http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *   Unless required by applicable law or agreed to in writing, software
+ *   distributed under the License is distributed on an "AS IS" BASIS,
+ *   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *   See the License for the specific language governing permissions and
+ *   limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include "DContainers/Serialization.hpp"
+
+using mdc::DArray, mdc::DTensor, mdc::DVector, mdc::JaggedDVector;
+namespace io = mdc::io;
+
+class SerializationTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        i3Vector = {
+                {
+                        {1, 2, 3},
+                        {4, 5, 6, 7}
+                },
+                {},
+                {
+                        {},
+                        {8, 9},
+                        {10, 11, 12, 13, 14}
+                },
+        };
+
+        d2Array = {
+                {0.5, 1.5, 2.5},
+                {3.5, 4.5, 5.5}
+        };
+    }
+
+    template<typename C>
+    static std::string serialized(const C &container) {
+        std::ostringstream os(std::ios::binary);
+        io::write(os, container);
+        return os.str();
+    }
+
+    template<typename C>
+    static C deserialized(const std::string &bytes) {
+        std::istringstream is(bytes, std::ios::binary);
+        return io::read<C>(is);
+    }
+
+    DVector<3, int> i3Vector;
+    DArray<double, 2, 3> d2Array;
+};
+
+TEST_F(SerializationTest, DenseRoundTrip) {
+    const auto bytes = serialized(d2Array);
+    EXPECT_EQ(bytes.size(), io::payloadAlignment + sizeof(d2Array));
+    EXPECT_EQ(bytes.substr(0, 4), "MDCB");
+    EXPECT_EQ((deserialized<DArray<double, 2, 3>>(bytes)), d2Array);
+
+    DTensor<3, std::int16_t> tensor({2, 3, 4}, 7);
+    tensor.at(1,2,3) = -1;
+    EXPECT_EQ((deserialized<DTensor<3, std::int16_t>>(serialized(tensor))), tensor);
+
+    // dense containers can be read as DVector or JaggedDVector
+    auto dVector = deserialized<DVector<2, double>>(bytes);
+    EXPECT_EQ(dVector, (DVector<2, double>{{0.5, 1.5, 2.5}, {3.5, 4.5, 5.5}}));
+    EXPECT_EQ((deserialized<JaggedDVector<2, double>>(bytes)), mdc::compact(dVector));
+}
+
+TEST_F(SerializationTest, JaggedRoundTrip) {
+    const auto bytes = serialized(i3Vector);
+    EXPECT_EQ((deserialized<DVector<3, int>>(bytes)), i3Vector);
+    EXPECT_EQ((deserialized<JaggedDVector<3, int>>(bytes)), mdc::compact(i3Vector));
+    EXPECT_EQ(serialized(mdc::compact(i3Vector)), bytes);
+
+    std::istringstream is(bytes, std::ios::binary);
+    const auto header = io::read_header(is);
+    EXPECT_EQ(header.layout, io::Layout::Jagged);
+    EXPECT_EQ(header.kind, io::ElementKind::Signed);
+    EXPECT_EQ(header.rank, 3);
+    EXPECT_EQ(header.count, 14);
+    EXPECT_EQ(header.offsets[0], (std::vector<std::uint64_t>{0, 2, 2, 5}));
+    EXPECT_EQ(header.offsets[1], (std::vector<std::uint64_t>{0, 3, 7, 7, 9, 14}));
+    EXPECT_EQ(header.payloadOffset % io::payloadAlignment, 0);
+
+    EXPECT_EQ((deserialized<DVector<1, float>>(serialized(DVector<1, float>{1.0f, -2.0f}))),
+              (DVector<1, float>{1.0f, -2.0f}));
+    EXPECT_TRUE((deserialized<DVector<2, int>>(serialized(DVector<2, int>())).empty()));
+}
+
+TEST_F(SerializationTest, FileDescriptor) {
+    std::FILE *file = std::tmpfile();
+    ASSERT_NE(file, nullptr);
+    const int fd = fileno(file);
+    DVector<3, double> large({40, 30, 20}, [](std::size_t i, std::size_t j, std::size_t k) {
+        return static_cast<double>(i * 600 + j * 20 + k);
+    });
+    io::write(fd, large);
+    io::write(fd, i3Vector);
+    ASSERT_EQ(lseek(fd, 0, SEEK_SET), 0);
+    EXPECT_EQ((io::read<DVector<3, double>>(fd)), large);
+    EXPECT_EQ((io::read<DVector<3, int>>(fd)), i3Vector);
+    EXPECT_THROW((io::read<DVector<3, int>>(fd)), std::runtime_error);
+    std::fclose(file);
+}
+
+TEST_F(SerializationTest, Mismatch) {
+    const auto bytes = serialized(i3Vector);
+    EXPECT_THROW((deserialized<DVector<3, unsigned>>(bytes)), std::runtime_error);
+    EXPECT_THROW((deserialized<DVector<3, long>>(bytes)), std::runtime_error);
+    EXPECT_THROW((deserialized<DVector<2, int>>(bytes)), std::runtime_error);
+    EXPECT_THROW((deserialized<DTensor<3, int>>(bytes)), std::runtime_error);
+    EXPECT_THROW((deserialized<DArray<double, 3, 2>>(serialized(d2Array))), std::runtime_error);
+
+    EXPECT_THROW((deserialized<DVector<3, int>>(bytes.substr(0, bytes.size() - 1))), std::runtime_error);
+    EXPECT_THROW((deserialized<DVector<3, int>>("not a container")), std::runtime_error);
+    auto corrupted = bytes;
+    corrupted[56] = 9;
+    EXPECT_THROW((deserialized<DVector<3, int>>(corrupted)), std::runtime_error);
+
+    // extents whose product wraps to the number of elements
+    auto wrapped = serialized(DTensor<2, int>(std::array<std::size_t, 2>{0, 0}));
+    const std::uint64_t extent = std::uint64_t{1} << 32;
+    std::memcpy(wrapped.data() + 48, &extent, sizeof(extent));
+    std::memcpy(wrapped.data() + 56, &extent, sizeof(extent));
+    EXPECT_THROW((deserialized<DTensor<2, int>>(wrapped)), std::runtime_error);
+
+    // empty dense containers whose outer extents are not backed by any element
+    auto hollow = serialized(DTensor<2, int>(std::array<std::size_t, 2>{5, 0}));
+    const auto rows = deserialized<DVector<2, int>>(hollow);
+    EXPECT_EQ(rows.size(), 5);
+    EXPECT_EQ(rows.total(), 0);
+    std::memcpy(hollow.data() + 48, &extent, sizeof(extent));
+    EXPECT_NO_THROW((deserialized<DTensor<2, int>>(hollow)));
+    EXPECT_THROW((deserialized<DVector<2, int>>(hollow)), std::runtime_error);
+    EXPECT_THROW((deserialized<JaggedDVector<2, int>>(hollow)), std::runtime_error);
+}
+
+TEST_F(SerializationTest, OversizedHeaders) {
+    // counts claimed by a header are checked against the bytes left before allocating
+    const std::uint64_t huge = std::uint64_t{1} << 40;
+    auto values = serialized(DVector<1, int>{1, 2, 3});
+    std::memcpy(values.data() + 32, &huge, sizeof(huge));
+    EXPECT_THROW((deserialized<DVector<1, int>>(values)), std::runtime_error);
+    EXPECT_THROW((deserialized<JaggedDVector<1, int>>(values)), std::runtime_error);
+
+    auto offsets = serialized(i3Vector);
+    std::memcpy(offsets.data() + 48, &huge, sizeof(huge));
+    EXPECT_THROW((deserialized<DVector<3, int>>(offsets)), std::runtime_error);
+
+    auto dense = serialized(DTensor<2, int>(std::array<std::size_t, 2>{2, 2}, 1));
+    const std::uint64_t extent = std::uint64_t{1} << 20;
+    std::memcpy(dense.data() + 32, &huge, sizeof(huge));
+    std::memcpy(dense.data() + 48, &extent, sizeof(extent));
+    std::memcpy(dense.data() + 56, &extent, sizeof(extent));
+    EXPECT_THROW((deserialized<DTensor<2, int>>(dense)), std::runtime_error);
+
+    // sources which cannot seek are read in bounded chunks, failing on the first short read
+    int fds[2];
+    ASSERT_EQ(pipe(fds), 0);
+    ASSERT_EQ(::write(fds[1], values.data(), values.size()), static_cast<ssize_t>(values.size()));
+    close(fds[1]);
+    EXPECT_THROW((io::read<JaggedDVector<1, int>>(fds[0])), std::runtime_error);
+    close(fds[0]);
+}
+
+TEST_F(SerializationTest, OppositeByteOrder) {
+    DArray<std::uint32_t, 2, 2> array = {{{1u, 2u}, {0x01020304u, 0xAABBCCDDu}}};
+    auto bytes = serialized(array);
+    // rewrite the serialized array as if produced with the opposite byte order
+    std::reverse(bytes.begin() + 4, bytes.begin() + 6);
+    const auto payloadOffset = io::payloadAlignment;
+    for (std::size_t field = 8; field < payloadOffset; field += 8)
+        std::reverse(bytes.begin() + field, bytes.begin() + field + 8);
+    for (std::size_t element = payloadOffset; element < bytes.size(); element += 4)
+        std::reverse(bytes.begin() + element, bytes.begin() + element + 4);
+    EXPECT_EQ((deserialized<DArray<std::uint32_t, 2, 2>>(bytes)), array);
+}
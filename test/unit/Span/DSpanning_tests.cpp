@@ -67,3 +67,15 @@ TEST_F(DSpanTest, EqualityCheck) {
 TEST_F(DSpanTest, SizeMismatch_ThrowLengthError) {
     EXPECT_THROW(DSpanning<SpanSize::Interval<4>>(3, 7), std::length_error);
 }
+
+TEST_F(DSpanTest, StepCheck) {
+    auto strided = DSpanning<SpanSize::Interval<1,9,4>>{};
+    EXPECT_EQ(strided.from, 1);
+    EXPECT_EQ(strided.step, 4);
+    EXPECT_EQ(decltype(strided)::Size, 3);
+    EXPECT_EQ(strided, Spanning(1, 9, 4));
+
+    auto stridedSize = DSpanning<SpanSize::Interval<3>>{1, 10, 4};
+    EXPECT_EQ(stridedSize, strided);
+    EXPECT_THROW(DSpanning<SpanSize::Interval<2>>(1, 9, 4), std::length_error);
+}
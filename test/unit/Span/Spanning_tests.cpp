@@ -48,3 +48,19 @@ TEST_F(SpanTest, EqualityCheck) {
     EXPECT_EQ(index, Spanning(5));
     EXPECT_EQ(index, Spanning(5, 5));
 }
+
+TEST_F(SpanTest, StepCheck) {
+    EXPECT_EQ(interval.step, 1);
+    EXPECT_EQ(all.step, 1);
+
+    Spanning strided(2, 9, 3);
+    EXPECT_EQ(strided.step, 3);
+    EXPECT_EQ(strided.size(), 3);
+    EXPECT_EQ(strided.last(), 8);
+    EXPECT_EQ(strided, Spanning(2, 8, 3));
+    EXPECT_NE(strided, Spanning(2, 8));
+    EXPECT_EQ(Spanning(5, 6, 4), index);
+    EXPECT_NE(all, Spanning(0, 0));
+
+    EXPECT_THROW(Spanning(0, 4, 0), std::invalid_argument);
+}
@@ -43,3 +43,15 @@ TEST(SpannedTest, EqualityIndexCheck) {
     EXPECT_EQ(Span::of<5>(), DSpanning<SpanSize::Index<5>>{});
     EXPECT_EQ(Span::of(5), Span::of<5>());
 }
+
+TEST(SpannedTest, EqualityStepCheck) {
+    EXPECT_EQ(Span::of(0, 8, 2), Spanning(0, 8, 2));
+
+    auto wrapStrided = Span::of<0,8,2>();
+    auto cmpStrided = DSpanning<SpanSize::Interval<0,9,2>>();
+    EXPECT_EQ(wrapStrided, cmpStrided);
+    EXPECT_EQ(wrapStrided, Span::of(0, 8, 2));
+
+    auto wrapStridedSize = Span::of<5>(0, 8, 2);
+    EXPECT_EQ(wrapStrided, wrapStridedSize);
+}
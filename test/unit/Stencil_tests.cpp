@@ -0,0 +1,186 @@
+/*
+ *   Copyright 2022 Alberto Guarnieri
+ *
+ *   Licensed under the Apache License, Version 2.0 (the "License");
+ *   you may not use this file except in compliance with the License.
+ *   You may obtain a copy of the License at
+ *
+ *       http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *   Unless required by applicable law or agreed to in writing, software
+ *   distributed under the License is distributed on an "AS IS" BASIS,
+ *   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *   See the License for the specific language governing permissions and
+ *   limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <stdexcept>
+#include "DContainers/Stencil.hpp"
+
+using mdc::DArray, mdc::DTensor, mdc::DVector, mdc::Neighbourhood, mdc::Boundary;
+
+namespace {
+
+    // Sum of the 5-point neighbourhood of an element, reading each neighbour through resolve
+    template<typename Resolve>
+    int crossSum(std::size_t i, std::size_t j, Resolve resolve) {
+        constexpr std::array<std::array<int, 2>, 5> offsets{{{0, 0}, {-1, 0}, {1, 0}, {0, -1}, {0, 1}}};
+        int sum = 0;
+        for (const auto &offset: offsets)
+            sum += resolve(static_cast<int>(i) + offset[0], static_cast<int>(j) + offset[1]);
+        return sum;
+    }
+
+}
+
+class StencilTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        for (std::size_t i = 0; i < 4; ++i)
+            for (std::size_t j = 0; j < 5; ++j)
+                i2Array.at(i, j) = static_cast<int>(i * 10 + j);
+    }
+
+    DArray<int, 4, 5> i2Array;
+};
+
+TEST_F(StencilTest, Neighbourhoods) {
+    EXPECT_EQ(Neighbourhood::FivePoint::size, 5);
+    EXPECT_EQ(Neighbourhood::FivePoint::indexOf({0, -1}), 3);
+    EXPECT_EQ(Neighbourhood::NinePoint::indexOf({0, 0}), 4);
+    EXPECT_EQ(Neighbourhood::NinePoint::indexOf({2, 0}), 9);
+    EXPECT_EQ(Neighbourhood::SevenPoint::size, 7);
+    EXPECT_EQ(Neighbourhood::TwentySevenPoint::indexOf({0, 0, 0}), 13);
+    EXPECT_EQ((Neighbourhood::TwentySevenPoint::low), (std::array<std::size_t, 3>{1, 1, 1}));
+
+    constexpr std::array<std::array<std::ptrdiff_t, 2>, 3> upwind{{{0, 0}, {-2, 0}, {0, -1}}};
+    using Upwind = Neighbourhood::Custom<upwind>;
+    EXPECT_EQ(Upwind::low, (std::array<std::size_t, 2>{2, 1}));
+    EXPECT_EQ(Upwind::high, (std::array<std::size_t, 2>{0, 0}));
+}
+
+TEST_F(StencilTest, BoundaryPolicies) {
+    auto kernel = [](const auto &n) {
+        return n[0] + n(-1, 0) + n(1, 0) + n(0, -1) + n(0, 1);
+    };
+    DArray<int, 4, 5> output;
+
+    mdc::stencil<Neighbourhood::FivePoint>(i2Array, output, kernel);
+    for (std::size_t i = 0; i < 4; ++i)
+        for (std::size_t j = 0; j < 5; ++j)
+            EXPECT_EQ(output.at(i, j), crossSum(i, j, [&](int a, int b) {
+                return i2Array.at(std::clamp(a, 0, 3), std::clamp(b, 0, 4));
+            }));
+
+    mdc::stencil<Neighbourhood::FivePoint>(i2Array, output, kernel, Boundary::Wrap{});
+    for (std::size_t i = 0; i < 4; ++i)
+        for (std::size_t j = 0; j < 5; ++j)
+            EXPECT_EQ(output.at(i, j), crossSum(i, j, [&](int a, int b) {
+                return i2Array.at((a + 4) % 4, (b + 5) % 5);
+            }));
+
+    mdc::stencil<Neighbourhood::FivePoint>(i2Array, output, kernel, Boundary::Constant{-100});
+    for (std::size_t i = 0; i < 4; ++i)
+        for (std::size_t j = 0; j < 5; ++j)
+            EXPECT_EQ(output.at(i, j), crossSum(i, j, [&](int a, int b) {
+                return a < 0 || a > 3 || b < 0 || b > 4 ? -100 : i2Array.at(a, b);
+            }));
+
+    // ghost cells of the output are not written
+    mdc::fill(output, 7);
+    mdc::stencil<Neighbourhood::FivePoint>(i2Array, output, kernel, Boundary::Ghost{});
+    for (std::size_t i = 0; i < 4; ++i)
+        for (std::size_t j = 0; j < 5; ++j)
+            EXPECT_EQ(output.at(i, j), i == 0 || i == 3 || j == 0 || j == 4 ? 7 : 5 * i2Array.at(i, j));
+}
+
+TEST_F(StencilTest, KernelPosition) {
+    DArray<int, 4, 5> output;
+    mdc::stencil<Neighbourhood::NinePoint>(i2Array, output, [](const auto &n, const std::array<std::size_t, 2> &p) {
+        return n[4] - static_cast<int>(p[0] * 10 + p[1]) + n(-1, -1) - n(1, 1);
+    }, Boundary::Clamp{});
+    EXPECT_EQ(output.at(1, 1), -22);
+    EXPECT_EQ(output.at(0, 0), -11);
+    EXPECT_EQ(output.at(3, 4), -11);
+
+    // custom neighbourhoods reaching farther than one element
+    constexpr std::array<std::array<std::ptrdiff_t, 2>, 2> far{{{-2, 0}, {0, 3}}};
+    mdc::stencil<Neighbourhood::Custom<far>>(i2Array, output, [](const auto &n) {
+        return n[0] * 100 + n[1];
+    }, Boundary::Constant{0});
+    EXPECT_EQ(output.at(2, 1), 124);
+    EXPECT_EQ(output.at(3, 0), 1033);
+    EXPECT_EQ(output.at(3, 2), 1200);
+}
+
+TEST_F(StencilTest, ThreeDimensions) {
+    DArray<int, 3, 4, 5> input, output;
+    for (std::size_t i = 0; i < 3; ++i)
+        for (std::size_t j = 0; j < 4; ++j)
+            for (std::size_t k = 0; k < 5; ++k)
+                input.at(i, j, k) = static_cast<int>(i * 100 + j * 10 + k);
+
+    mdc::stencil<Neighbourhood::TwentySevenPoint>(input, output, [](const auto &n) {
+        return n.apply([](auto... values) { return (values + ...); });
+    }, Boundary::Wrap{});
+    for (std::size_t i = 0; i < 3; ++i)
+        for (std::size_t j = 0; j < 4; ++j)
+            for (std::size_t k = 0; k < 5; ++k) {
+                int expected = 0;
+                for (std::size_t a = 2; a <= 4; ++a)
+                    for (std::size_t b = 3; b <= 5; ++b)
+                        for (std::size_t c = 4; c <= 6; ++c)
+                            expected += input.at((i + a) % 3, (j + b) % 4, (k + c) % 5);
+                EXPECT_EQ(output.at(i, j, k), expected);
+            }
+
+    DArray<int, 3, 4, 5> looped;
+    mdc::stencil<Neighbourhood::SevenPoint>(input, looped, [](const auto &n) {
+        int sum = 0;
+        for (std::size_t k = 0; k < Neighbourhood::SevenPoint::size; ++k)
+            sum += n[k];
+        return sum;
+    }, Boundary::Wrap{});
+    EXPECT_EQ(looped.at(1, 2, 3), 7 * 123);
+    EXPECT_EQ(looped.at(0, 0, 0), 200 + 100 + 30 + 10 + 4 + 1);
+}
+
+TEST_F(StencilTest, DenseVectors) {
+    DVector<2, int> input(4, 5), output(4, 5);
+    DTensor<2, double> tensor({4, 5}, 0.0);
+    for (std::size_t i = 0; i < 4; ++i)
+        for (std::size_t j = 0; j < 5; ++j)
+            input.at(i, j) = i2Array.at(i, j);
+
+    auto laplacian = [](const auto &n) {
+        return n(-1, 0) + n(1, 0) + n(0, -1) + n(0, 1) - 4 * n(0, 0);
+    };
+    DArray<int, 4, 5> expected;
+    mdc::stencil<Neighbourhood::FivePoint>(i2Array, expected, laplacian, Boundary::Constant{1});
+    mdc::stencil<Neighbourhood::FivePoint>(input, output, laplacian, Boundary::Constant{1});
+    mdc::stencil<Neighbourhood::FivePoint>(input, tensor, laplacian, Boundary::Constant{1});
+    for (std::size_t i = 0; i < 4; ++i)
+        for (std::size_t j = 0; j < 5; ++j) {
+            EXPECT_EQ(output.at(i, j), expected.at(i, j));
+            EXPECT_EQ(tensor.at(i, j), expected.at(i, j));
+        }
+
+    DVector<2, int> jagged{{1, 2}, {3}};
+    EXPECT_THROW(mdc::stencil<Neighbourhood::FivePoint>(jagged, output, laplacian), std::invalid_argument);
+    DVector<2, int> emptyFirst{{}, {1}};
+    EXPECT_THROW(mdc::stencil<Neighbourhood::FivePoint>(emptyFirst, emptyFirst, laplacian), std::invalid_argument);
+    DArray<int, 5, 4> transposed;
+    EXPECT_THROW(mdc::stencil<Neighbourhood::FivePoint>(input, transposed, laplacian), std::invalid_argument);
+
+    // grids smaller than the neighbourhood have no interior
+    DArray<int, 1, 1> single{{3}}, result;
+    mdc::stencil<Neighbourhood::NinePoint>(single, result, [](const auto &n) {
+        return n[0] + n[8];
+    });
+    EXPECT_EQ(result.at(0, 0), 6);
+}
@@ -0,0 +1,163 @@
+/*
+ *   Copyright 2022 Alberto Guarnieri
+ *
+ *   Licensed under the Apache License, Version 2.0 (the "License");
+ *   you may not use this file except in compliance with the License.
+ *   You may obtain a copy of the License at
+ *
+ *       http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *   Unless required by applicable law or agreed to in writing, software
+ *   distributed under the License is distributed on an "AS IS" BASIS,
+ *   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *   See the License for the specific language governing permissions and
+ *   limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <cstddef>
+#include <stdexcept>
+#include <vector>
+#include "DContainers/Layout.hpp"
+#include "DContainers/Span.hpp"
+#include "DContainers/Tile.hpp"
+
+using mdc::DArray, mdc::DTensor, mdc::DVector, mdc::DView, mdc::DVectorView;
+
+namespace {
+
+    // Call fn with each element of a view, in row-major order
+    template<std::size_t D, typename T, typename Fn>
+    void forEachElement(const DView<D, T> &view, Fn fn) {
+        auto visit = [&](auto... indices) {
+            fn(view(indices...));
+        };
+        mdc::detail::forEachIndex<D>(view.shape(), visit);
+    }
+
+}
+
+class TileTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        for (std::size_t i = 0; i < 5; ++i)
+            for (std::size_t j = 0; j < 7; ++j)
+                i2Array.at(i, j) = static_cast<int>(i * 10 + j);
+
+        i2Vector = {
+                {1, 2, 3},
+                {4, 5, 6, 7, 8},
+                {},
+                {9}
+        };
+    }
+
+    DArray<int, 5, 7> i2Array;
+    DVector<2, int> i2Vector;
+};
+
+TEST_F(TileTest, TilesCoverArray) {
+    std::vector<std::array<std::size_t, 2>> origins, shapes;
+    mdc::for_each_tile<2, 3>(i2Array, [&](DView<2, int> tile, const std::array<std::size_t, 2> &origin) {
+        EXPECT_EQ(tile.at(0, 0), static_cast<int>(origin[0] * 10 + origin[1]));
+        origins.push_back(origin);
+        shapes.push_back(tile.shape());
+        forEachElement(tile, [](int &element) { element = -element - 1; });
+    });
+    ASSERT_EQ(origins.size(), 9);
+    EXPECT_EQ(origins[1], (std::array<std::size_t, 2>{0, 3}));
+    EXPECT_EQ(origins[3], (std::array<std::size_t, 2>{2, 0}));
+    EXPECT_EQ(shapes[2], (std::array<std::size_t, 2>{2, 1}));
+    EXPECT_EQ(shapes[8], (std::array<std::size_t, 2>{1, 1}));
+
+    // every element is visited exactly once
+    for (std::size_t i = 0; i < 5; ++i)
+        for (std::size_t j = 0; j < 7; ++j)
+            EXPECT_EQ(i2Array.at(i, j), -static_cast<int>(i * 10 + j) - 1);
+}
+
+TEST_F(TileTest, RuntimeTiles) {
+    DArray<int, 3, 4, 5> i3Array;
+    int count = 0, tiles = 0;
+    mdc::for_each_tile(i3Array, {2, 2, 4}, [&](DView<3, int> tile) {
+        ++tiles;
+        forEachElement(tile, [&](int &element) { element = count++; });
+    });
+    EXPECT_EQ(tiles, 8);
+    EXPECT_EQ(count, 60);
+    // tiles are visited in row-major order
+    EXPECT_EQ(i3Array.at(0, 0, 0), 0);
+    EXPECT_EQ(i3Array.at(0, 0, 4), 16);
+    EXPECT_EQ(i3Array.at(2, 3, 4), 59);
+
+    EXPECT_THROW(mdc::for_each_tile(i3Array, {2, 0, 4}, [](DView<3, int>) {}), std::invalid_argument);
+
+    // tiles larger than the container view it as a whole
+    tiles = 0;
+    const DArray<int, 5, 7> &constArray = i2Array;
+    mdc::for_each_tile(constArray, {100, 100}, [&](DView<2, const int> tile) {
+        ++tiles;
+        EXPECT_EQ(tile.total(), 35);
+    });
+    EXPECT_EQ(tiles, 1);
+}
+
+TEST_F(TileTest, TilesCoverViews) {
+    DTensor<2, int> tensor({6, 6}, 1);
+    int sum = 0;
+    mdc::for_each_tile<4, 4>(tensor.transpose(), [&](DView<2, int> tile) {
+        forEachElement(tile, [&](int element) { sum += element; });
+    });
+    EXPECT_EQ(sum, 36);
+
+    std::vector<std::array<std::size_t, 2>> shapes;
+    mdc::for_each_tile<2, 2>(i2Array.at(mdc::Span::of(1, 3), mdc::Span::all()), [&](DView<2, int> tile) {
+        shapes.push_back(tile.shape());
+    });
+    ASSERT_EQ(shapes.size(), 8);
+    EXPECT_EQ(shapes[7], (std::array<std::size_t, 2>{1, 1}));
+}
+
+TEST_F(TileTest, TilesCoverJaggedVector) {
+    std::vector<int> visited;
+    int tiles = 0;
+    mdc::for_each_tile<2, 2>(i2Vector, [&](DVectorView<2, int> tile, const std::array<std::size_t, 2> &origin) {
+        ++tiles;
+        for (auto row: tile)
+            for (int &element: row) {
+                visited.push_back(element);
+                element *= 2;
+            }
+        if (origin == std::array<std::size_t, 2>{2, 4}) {
+            EXPECT_EQ(tile.total(), 0);
+        }
+    });
+    // tiles span the longest row
+    EXPECT_EQ(tiles, 6);
+    EXPECT_EQ(visited, (std::vector<int>{1, 2, 4, 5, 3, 6, 7, 8, 9}));
+    EXPECT_EQ(i2Vector.at(1, 4), 16);
+    EXPECT_EQ(i2Vector.at(3, 0), 18);
+
+    DVector<2, int> empty;
+    mdc::for_each_tile(empty, {2, 2}, [](DVectorView<2, int>) { FAIL(); });
+}
+
+TEST_F(TileTest, DefaultTiles) {
+    const auto tiles = mdc::default_tiles<float, 2>();
+    const auto &caches = mdc::detail::cacheSizes();
+    EXPECT_LE(tiles[0] * tiles[1] * sizeof(float), caches.l1);
+    EXPECT_GE(tiles[1] * sizeof(float), mdc::detail::cacheLine);
+    EXPECT_EQ(tiles[0] & (tiles[0] - 1), 0);
+
+    const auto cube = mdc::default_tiles<double, 3>();
+    EXPECT_LE(cube[0] * cube[1] * cube[2] * sizeof(double), caches.l2);
+    EXPECT_GE(cube[2] * sizeof(double), mdc::detail::cacheLine);
+
+    std::size_t total = 0;
+    mdc::for_each_tile(i2Array, [&](DView<2, int> tile) {
+        total += tile.total();
+    });
+    EXPECT_EQ(total, 35);
+}